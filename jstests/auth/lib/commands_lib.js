@@ -322,6 +322,29 @@ var authCommandsLib = {
               roles: roles_clusterManager,
           }]
         },
+        {
+          testname: "analyze",
+          command: {analyze: "x", key: "a"},
+          skipSharded: true,
+          setup: function(db) {
+              assert.writeOK(db.x.save({a: 1}));
+          },
+          teardown: function(db) {
+              db.x.drop();
+          },
+          testcases: [
+              {
+                runOnDb: firstDbName,
+                roles: roles_dbAdmin,
+                privileges: [{resource: {db: firstDbName, collection: "x"}, actions: ["analyze"]}],
+              },
+              {
+                runOnDb: secondDbName,
+                roles: roles_dbAdminAny,
+                privileges: [{resource: {db: secondDbName, collection: "x"}, actions: ["analyze"]}],
+              },
+          ]
+        },
 
         {
           testname: "applyOps_empty",
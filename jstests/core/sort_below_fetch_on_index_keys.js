@@ -0,0 +1,48 @@
+/**
+ * Tests queries whose blocking sort is placed below the FETCH stage because the index provides the
+ * sort key, while the query itself is not covered. In this case the sort is performed on the index
+ * keys and only the documents which survive the sort are fetched.
+ *
+ * @tags: [
+ *   assumes_unsharded_collection,
+ * ]
+ */
+(function() {
+"use strict";
+
+load("jstests/libs/analyze_plan.js");
+
+const coll = db.sort_below_fetch_on_index_keys;
+coll.drop();
+
+assert.commandWorked(coll.createIndex({a: 1, "b.c": 1}));
+
+assert.commandWorked(coll.insert([
+    {_id: 0, a: 1, b: {c: 3}, d: 0},
+    {_id: 1, a: 1, b: {c: 1}, d: 1},
+    {_id: 2, a: 2, b: {c: 2}, d: 2},
+    {_id: 3, a: 2, d: 3},
+    {_id: 4, a: 3, b: {c: null}, d: 4},
+    {_id: 5, a: 3, b: {c: -1}, d: 5},
+]));
+
+function assertSortedBelowFetch(findCmd, expectedIds) {
+    const result = assert.commandWorked(db.runCommand(findCmd));
+    assert.eq(expectedIds, result.cursor.firstBatch.map(doc => doc._id), result);
+
+    const explain = assert.commandWorked(db.runCommand({explain: findCmd}));
+    const winningPlan = getWinningPlan(explain.queryPlanner);
+    const fetch = getPlanStage(winningPlan, "FETCH");
+    assert.neq(null, fetch, explain);
+    assert(planHasStage(db, fetch, "SORT"), explain);
+}
+
+// Missing and null sort keys compare equal, so 'a' breaks the tie between documents 3 and 4.
+assertSortedBelowFetch({find: coll.getName(), filter: {a: {$gte: 1}}, sort: {"b.c": 1, a: 1}},
+                       [3, 4, 5, 1, 2, 0]);
+assertSortedBelowFetch(
+    {find: coll.getName(), filter: {a: {$gte: 1}}, sort: {"b.c": -1}, limit: 2}, [0, 2]);
+assertSortedBelowFetch(
+    {find: coll.getName(), filter: {a: {$gt: 0}}, sort: {"b.c": 1, a: -1}, limit: 3},
+    [4, 3, 5]);
+}());
@@ -0,0 +1,67 @@
+(function() {
+"use strict";
+
+load("jstests/libs/optimizer_utils.js");  // For checkCascadesOptimizerEnabled.
+if (!checkCascadesOptimizerEnabled(db)) {
+    jsTestLog("Skipping test because the optimizer is not enabled");
+    return;
+}
+
+const coll = db.cqf_histogram_ce;
+coll.drop();
+
+const bulk = coll.initializeUnorderedBulkOp();
+const nDocs = 10000;
+
+// 'a' is heavily skewed: 90% of the documents hold 0 and the rest are uniform over [1, 1000).
+Random.srand(0);
+for (let i = 0; i < nDocs; i++) {
+    const valA = (i % 10 == 0) ? 1 + Math.floor(999 * Random.rand()) : 0;
+    bulk.insert({a: valA, b: [i, i + 1]});
+}
+assert.commandWorked(bulk.execute());
+
+assert.commandFailedWithCode(db.runCommand({analyze: "cqf_histogram_ce_missing", key: "a"}),
+                             ErrorCodes.NamespaceNotFound);
+assert.commandFailed(db.runCommand({analyze: coll.getName(), key: "$a"}));
+
+assert.commandWorked(db.runCommand({analyze: coll.getName(), key: "a"}));
+assert.commandWorked(db.runCommand({analyze: coll.getName(), key: "b", numberOfBuckets: 10}));
+
+const stats = db.system.statistics.cqf_histogram_ce.findOne({_id: "a"});
+assert.neq(null, stats);
+assert.eq(nDocs, stats.statistics.documents);
+assert.eq(nDocs, stats.statistics.typeCounts.double);
+assert.lte(stats.statistics.buckets.length, 101);
+assert.lte(db.system.statistics.cqf_histogram_ce.findOne({_id: "b"}).statistics.buckets.length, 11);
+
+function getCE(pipeline) {
+    const res = coll.explain().aggregate(pipeline);
+    assert(res.queryPlanner.winningPlan.optimizerPlan.hasOwnProperty("properties"));
+    return res.queryPlanner.winningPlan.optimizerPlan.properties.adjustedCE;
+}
+
+// The frequent value gets a bucket of its own and is estimated exactly.
+const eqCE = getCE([{$match: {a: 0}}]);
+assert.lt(nDocs * 0.9 * 0.99, eqCE);
+assert.gt(nDocs * 0.9 * 1.01, eqCE);
+
+// Verify the range estimate is within roughly 25% of the expected documents.
+const ce = getCE([{$match: {a: {$gte: 500}}}]);
+assert.lt(nDocs * 0.05 * 0.75, ce);
+assert.gt(nDocs * 0.05 * 1.25, ce);
+
+// Clients cannot write the statistics directly.
+assert.commandFailedWithCode(
+    db.runCommand({insert: "system.statistics.cqf_histogram_ce", documents: [{_id: "c"}]}),
+    ErrorCodes.InvalidNamespace);
+
+// Re-running analyze replaces the cached statistics.
+assert.commandWorked(coll.updateMany({a: 0}, {$set: {a: -1}}));
+assert.commandWorked(db.runCommand({analyze: coll.getName(), key: "a"}));
+assert.gt(nDocs * 0.01, getCE([{$match: {a: 0}}]));
+
+// The statistics are dropped together with the collection.
+assert(coll.drop());
+assert.eq(0, db.getCollectionInfos({name: "system.statistics.cqf_histogram_ce"}).length);
+}());
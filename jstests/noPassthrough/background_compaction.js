@@ -0,0 +1,57 @@
+/**
+ * Tests that the background compactor reclaims the free space left behind by deletes and reports
+ * its progress in serverStatus.
+ *
+ * @tags: [requires_wiredtiger, requires_persistence]
+ */
+(function() {
+"use strict";
+
+const conn = MongoRunner.runMongod({
+    setParameter: {
+        backgroundCompactionEnabled: false,
+        backgroundCompactionSleepSecs: 1,
+        backgroundCompactionFreeSpaceTargetPercent: 1,
+        backgroundCompactionMinFreeMB: 0,
+    }
+});
+assert.neq(conn, null, "mongod failed to start up");
+
+const db = conn.getDB(jsTestName());
+const coll = db.coll;
+
+function getMetrics() {
+    return assert.commandWorked(db.serverStatus()).metrics.backgroundCompaction;
+}
+
+const str = "x".repeat(1024);
+const docs = [];
+for (let i = 0; i < 20000; ++i) {
+    docs.push({_id: i, a: i, str: str});
+}
+assert.commandWorked(coll.insert(docs));
+assert.commandWorked(coll.createIndex({a: 1}));
+
+// Leave most of the collection as free space, and checkpoint so that WiredTiger can reuse it.
+assert.commandWorked(coll.deleteMany({_id: {$gte: 1000}}));
+assert.commandWorked(db.adminCommand({fsync: 1}));
+
+const storageSizeBefore = coll.stats().storageSize;
+assert.eq(0, getMetrics().timeSlices);
+
+assert.commandWorked(db.adminCommand({setParameter: 1, backgroundCompactionEnabled: true}));
+assert.soon(() => getMetrics().tablesCompacted > 0, () => tojson(getMetrics()));
+
+const metrics = getMetrics();
+assert.gt(metrics.passes, 0, tojson(metrics));
+assert.gte(metrics.timeSlices, metrics.tablesCompacted, tojson(metrics));
+assert.gt(metrics.bytesReclaimed, 0, tojson(metrics));
+assert.lt(coll.stats().storageSize, storageSizeBefore);
+
+// Compaction in the background does not affect the contents of the collection.
+assert.eq(1000, coll.find().itcount());
+assert.eq(1, coll.find({a: 500}).hint({a: 1}).itcount());
+assert.commandWorked(db.adminCommand({setParameter: 1, backgroundCompactionEnabled: false}));
+
+MongoRunner.stopMongod(conn);
+}());
@@ -0,0 +1,45 @@
+/**
+ * Tests that index builds which generate keys on multiple threads build the same indexes as those
+ * which generate keys on a single thread, including multikey, partial and unique indexes.
+ */
+(function() {
+"use strict";
+
+const conn = MongoRunner.runMongod({setParameter: {maxIndexBuildKeyGenerationThreads: 4}});
+assert.neq(conn, null, "mongod failed to start up");
+
+const db = conn.getDB(jsTestName());
+const coll = db.coll;
+
+const numDocs = 20000;
+const docs = [];
+for (let i = 0; i < numDocs; ++i) {
+    docs.push({_id: i, a: i % 100, b: "str" + i, c: (i % 10 === 0) ? [i, i + 1] : i});
+}
+assert.commandWorked(coll.insert(docs));
+
+assert.commandWorked(coll.createIndexes([
+    {a: 1, b: -1},
+    {c: 1},
+    {b: 1},
+]));
+assert.commandWorked(coll.createIndex({a: 1}, {partialFilterExpression: {a: {$gte: 50}}}));
+
+assert.eq(numDocs / 100, coll.find({a: 7}).hint({a: 1, b: -1}).itcount());
+assert.eq(numDocs / 2, coll.find({a: {$gte: 50}}).hint({a: 1}).itcount());
+assert.eq(1, coll.find({b: "str123"}).hint({b: 1}).itcount());
+
+// Every tenth document has an array in 'c', which makes the index multikey.
+assert.eq(2, coll.find({c: 11}).hint({c: 1}).itcount());
+const explain = coll.find({c: 11}).hint({c: 1}).explain();
+assert(JSON.stringify(explain).includes('"isMultiKey":true'), tojson(explain));
+
+// A duplicate key found during the collection scan fails a unique index build.
+assert.commandFailedWithCode(coll.createIndex({a: -1}, {unique: true}),
+                             ErrorCodes.DuplicateKey);
+
+const res = assert.commandWorked(coll.validate({full: true}));
+assert(res.valid, tojson(res));
+
+MongoRunner.stopMongod(conn);
+}());
@@ -50,6 +50,7 @@ function assertExistenceOfRequiredCacheEntryFields(entry) {
     assert(entry.hasOwnProperty("timeOfCreation"), entry);
     assert(entry.hasOwnProperty("indexFilterSet"), entry);
     assert(entry.hasOwnProperty("estimatedSizeBytes"), entry);
+    assert(entry.hasOwnProperty("planningCost"), entry);
 }
 
 const debugInfoFields =
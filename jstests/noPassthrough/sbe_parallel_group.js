@@ -0,0 +1,105 @@
+/**
+ * Tests that a $group pushed down to SBE over a collection scan, whose partial aggregates are
+ * computed by several workers in parallel, returns the same results as the serial plan, and that
+ * the workers stop when the aggregation is killed, times out, or its collection is dropped.
+ */
+(function() {
+"use strict";
+
+load("jstests/libs/fail_point_util.js");         // For configureFailPoint.
+load("jstests/libs/parallel_shell_helpers.js");  // For funWithArgs.
+load("jstests/libs/sbe_util.js");                // For checkSBEEnabled.
+
+const conn = MongoRunner.runMongod({
+    setParameter: {
+        internalQuerySlotBasedExecutionMaxDegreeOfParallelism: 4,
+        internalQuerySlotBasedExecutionParallelScanMinRecords: 0,
+    }
+});
+assert.neq(null, conn, "mongod was unable to start up");
+const db = conn.getDB(jsTestName());
+
+if (!checkSBEEnabled(db)) {
+    jsTestLog("Skipping test because SBE is not enabled");
+    MongoRunner.stopMongod(conn);
+    return;
+}
+
+const coll = db.parallel_group;
+coll.drop();
+
+// Insert enough documents for the scan to be split into several ranges.
+const kNumDocs = 50000;
+let bulk = coll.initializeUnorderedBulkOp();
+for (let i = 0; i < kNumDocs; ++i) {
+    bulk.insert({a: i % 13, b: i, c: (i % 7) + 0.5});
+}
+assert.commandWorked(bulk.execute());
+
+const pipeline = [
+    {
+        $group: {
+            _id: "$a",
+            sum: {$sum: "$b"},
+            min: {$min: "$b"},
+            max: {$max: "$c"},
+            avg: {$avg: "$c"},
+        }
+    },
+    {$sort: {_id: 1}}
+];
+
+// The parallel plan gathers the workers' partial aggregates through an exchange.
+let explain = coll.explain().aggregate(pipeline);
+assert(JSON.stringify(explain).includes("exchange"), explain);
+explain = coll.explain().aggregate(pipeline, {$_maxDegreeOfParallelism: 1});
+assert(!JSON.stringify(explain).includes("exchange"), explain);
+
+const serialResults = coll.aggregate(pipeline, {$_maxDegreeOfParallelism: 1}).toArray();
+assert.eq(13, serialResults.length, serialResults);
+assert.eq(serialResults, coll.aggregate(pipeline).toArray());
+assert.eq(serialResults, coll.aggregate(pipeline, {$_maxDegreeOfParallelism: 2}).toArray());
+
+function runParallelGroup(dbName, collName, pipeline, expectedCode) {
+    const res = db.getSiblingDB(dbName).runCommand(
+        {aggregate: collName, pipeline: pipeline, cursor: {}, comment: "parallel group"});
+    assert.commandFailedWithCode(res, expectedCode);
+}
+
+// The workers inherit the deadline of the aggregation.
+let fp = configureFailPoint(conn, "hangExchangeProducerBeforeOpen");
+assert.commandFailedWithCode(
+    db.runCommand({aggregate: coll.getName(), pipeline: pipeline, cursor: {}, maxTimeMS: 1000}),
+    ErrorCodes.MaxTimeMSExpired);
+fp.off();
+
+// Killing the aggregation interrupts its workers.
+fp = configureFailPoint(conn, "hangExchangeProducerBeforeOpen");
+let awaitShell = startParallelShell(
+    funWithArgs(runParallelGroup, db.getName(), coll.getName(), pipeline, ErrorCodes.Interrupted),
+    conn.port);
+fp.wait();
+const curOps =
+    db.getSiblingDB("admin")
+        .aggregate([{$currentOp: {}}, {$match: {"command.comment": "parallel group"}}])
+        .toArray();
+assert.eq(1, curOps.length, curOps);
+assert.commandWorked(db.killOp(curOps[0].opid));
+awaitShell();
+fp.off();
+
+// A worker notices that the collection has been dropped while the aggregation runs.
+fp = configureFailPoint(conn, "hangExchangeProducerBeforeOpen");
+awaitShell = startParallelShell(funWithArgs(runParallelGroup,
+                                            db.getName(),
+                                            coll.getName(),
+                                            pipeline,
+                                            ErrorCodes.QueryPlanKilled),
+                                conn.port);
+fp.wait();
+assert(coll.drop());
+fp.off();
+awaitShell();
+
+MongoRunner.stopMongod(conn);
+})();
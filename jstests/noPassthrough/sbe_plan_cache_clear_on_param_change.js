@@ -21,6 +21,7 @@ const paramList = [
     {name: "internalQueryCacheEvictionRatio", value: 11.0},
     {name: "internalQueryCacheWorksGrowthCoefficient", value: 3.0},
     {name: "internalQueryCacheDisableInactiveEntries", value: true},
+    {name: "internalQueryEnablePlanTemplateCache", value: true},
     {name: "internalQueryPlannerMaxIndexedSolutions", value: 32},
     {name: "internalQueryEnumerationPreferLockstepOrEnumeration", value: true},
     {name: "internalQueryEnumerationMaxOrSolutions", value: 5},
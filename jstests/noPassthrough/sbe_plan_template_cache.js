@@ -0,0 +1,80 @@
+/**
+ * Tests that when the plan template cache is enabled, an SBE plan cached for one collection is
+ * reused for a query of the same shape against another collection with identical indexes, and is
+ * not reused when the indexes differ.
+ */
+(function() {
+"use strict";
+
+load("jstests/libs/sbe_util.js");
+
+const conn = MongoRunner.runMongod({setParameter: {internalQueryEnablePlanTemplateCache: true}});
+assert.neq(conn, null, "mongod failed to start up");
+
+const db = conn.getDB(jsTestName());
+
+// This test is specifically verifying the behavior of the SBE plan cache. So if either the SBE plan
+// cache or SBE itself are disabled, bail out.
+if (!checkSBEEnabled(db, ["featureFlagSbePlanCache", "featureFlagSbeFull"])) {
+    jsTestLog("Skipping test because either SBE engine or SBE plan cache are disabled");
+    MongoRunner.stopMongod(conn);
+    return;
+}
+
+function setUpCollection(coll, {multikey}) {
+    coll.drop();
+    assert.commandWorked(coll.createIndexes([{a: 1}, {b: 1}]));
+    const docs = [];
+    for (let i = 0; i < 100; ++i) {
+        docs.push({a: i, b: i % 10});
+    }
+    if (multikey) {
+        docs.push({a: [1000, 1001], b: 0});
+    }
+    assert.commandWorked(coll.insert(docs));
+}
+
+function numCacheEntries(coll) {
+    return coll.aggregate([{$planCacheStats: {}}]).itcount();
+}
+
+const filter = {
+    a: {$gte: 10},
+    b: 3
+};
+
+const source = db.source;
+const target = db.target;
+const multikeyTarget = db.multikey_target;
+setUpCollection(source, {multikey: false});
+setUpCollection(target, {multikey: false});
+setUpCollection(multikeyTarget, {multikey: true});
+
+// Running the query twice against 'source' creates and then activates both the per-collection and
+// the template cache entry.
+for (let i = 0; i < 2; ++i) {
+    assert.eq(9, source.find(filter).itcount());
+}
+assert.eq(1, numCacheEntries(source));
+
+// 'target' has the same indexes, so the plan is recovered from the template cache. No
+// multi-planning takes place, hence no entry is written to the per-collection cache.
+for (let i = 0; i < 2; ++i) {
+    assert.eq(9, target.find(filter).itcount());
+}
+assert.eq(0, numCacheEntries(target));
+
+// A multikey index changes the shape of the index catalog, so the template is not used.
+for (let i = 0; i < 2; ++i) {
+    assert.eq(9, multikeyTarget.find(filter).itcount());
+}
+assert.eq(1, numCacheEntries(multikeyTarget));
+
+// With the template cache disabled, 'target' multi-plans and caches its own entry.
+assert.commandWorked(
+    db.adminCommand({setParameter: 1, internalQueryEnablePlanTemplateCache: false}));
+target.find(filter).itcount();
+assert.eq(1, numCacheEntries(target));
+
+MongoRunner.stopMongod(conn);
+}());
@@ -0,0 +1,82 @@
+/**
+ * Tests that the TTL monitor removes the expired documents of a clustered collection without
+ * secondary indexes with 'truncateRange' oplog entries of bounded size, which secondaries apply,
+ * and keeps deleting documents one by one once the collection has a secondary index.
+ *
+ * @tags: [
+ *   requires_replication,
+ *   uses_ttl,
+ * ]
+ */
+(function() {
+"use strict";
+
+const rst = new ReplSetTest({
+    nodes: [{}, {rsConfig: {priority: 0}}],
+    nodeOptions: {
+        setParameter: {
+            ttlMonitorSleepSecs: 1,
+            featureFlagClusteredRangeTruncate: true,
+            batchedDeletesTargetBatchDocs: 10,
+        }
+    },
+});
+rst.startSet();
+rst.initiate();
+
+const primary = rst.getPrimary();
+const secondary = rst.getSecondary();
+const db = primary.getDB(jsTestName());
+const coll = db.coll;
+const oplog = primary.getDB("local").oplog.rs;
+
+assert.commandWorked(db.createCollection(
+    coll.getName(), {clusteredIndex: {key: {_id: 1}, unique: true}, expireAfterSeconds: 60}));
+
+function insertDocs(numExpired, numLive) {
+    const now = new Date().getTime();
+    const docs = [];
+    for (let i = 0; i < numExpired; ++i) {
+        docs.push({_id: new Date(now - 24 * 3600 * 1000 + i), expired: true});
+    }
+    for (let i = 0; i < numLive; ++i) {
+        docs.push({_id: new Date(now + i), expired: false});
+    }
+    assert.commandWorked(coll.insert(docs));
+}
+
+function getTruncateRangeEntries() {
+    return oplog.find({ui: coll.getUUID(), "o.truncateRange": coll.getName()}).toArray();
+}
+
+insertDocs(100, 10);
+assert.soon(() => coll.find({expired: true}).itcount() === 0);
+assert.eq(10, coll.find().itcount());
+assert.eq(10, coll.count());
+
+// The expired documents were removed by range truncates rather than one by one, each of at most
+// 'batchedDeletesTargetBatchDocs' documents.
+assert.eq(0, oplog.find({ui: coll.getUUID(), op: "d"}).itcount());
+const truncateEntries = getTruncateRangeEntries();
+assert.gte(truncateEntries.length, 10, tojson(truncateEntries));
+truncateEntries.forEach(entry => assert.lte(entry.o.docsDeleted, 10, tojson(entry)));
+assert.eq(100,
+          truncateEntries.reduce((total, entry) => total + entry.o.docsDeleted, 0),
+          tojson(truncateEntries));
+
+rst.awaitReplication();
+const secondaryColl = secondary.getDB(jsTestName()).coll;
+assert.eq(10, secondaryColl.find().itcount());
+assert.eq(10, secondaryColl.count());
+
+// With a secondary index, the index keys must be removed with each document.
+assert.commandWorked(coll.createIndex({expired: 1}));
+insertDocs(20, 0);
+assert.soon(() => coll.find({expired: true}).itcount() === 0);
+assert.eq(truncateEntries.length, getTruncateRangeEntries().length);
+
+rst.awaitReplication();
+assert.eq(10, secondaryColl.find().hint({expired: 1}).itcount());
+
+rst.stopSet();
+}());
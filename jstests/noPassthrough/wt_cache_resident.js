@@ -0,0 +1,111 @@
+/**
+ * Tests that the 'cacheResident' collection and index options are persisted in the catalog and
+ * passed to WiredTiger as 'cache_resident' when the tables are created, that collMod can change
+ * the option of an existing collection, and that the option is gated on the feature compatibility
+ * version.
+ *
+ * @tags: [requires_wiredtiger]
+ */
+(function() {
+"use strict";
+
+const conn = MongoRunner.runMongod();
+assert.neq(conn, null, "mongod failed to start up");
+
+const db = conn.getDB(jsTestName());
+
+function getCollectionOptions(collName) {
+    const res = db.getCollectionInfos({name: collName});
+    assert.eq(1, res.length, tojson(res));
+    return res[0].options;
+}
+
+function assertCreationString(stats, cacheResident) {
+    assert.eq(cacheResident, stats.creationString.includes("cache_resident=true"), tojson(stats));
+}
+
+// The tables of a cache resident collection and of its indexes are created as cache resident.
+assert.commandWorked(db.createCollection("resident", {cacheResident: true}));
+assert.commandWorked(db.resident.createIndex({a: 1}));
+assert.eq(true, getCollectionOptions("resident").cacheResident);
+
+let stats = db.resident.stats();
+assertCreationString(stats.wiredTiger, true);
+assertCreationString(stats.indexDetails._id_, true);
+assertCreationString(stats.indexDetails.a_1, true);
+
+// An index can be made cache resident on its own.
+assert.commandWorked(db.createCollection("regular"));
+assert.commandWorked(db.regular.createIndexes([{a: 1}, {b: 1}], {cacheResident: true}));
+assert.commandWorked(db.regular.createIndex({c: 1}));
+
+stats = db.regular.stats();
+assertCreationString(stats.wiredTiger, false);
+assertCreationString(stats.indexDetails.a_1, true);
+assertCreationString(stats.indexDetails.c_1, false);
+
+const indexes = db.regular.getIndexes();
+assert.eq(true, indexes.find(index => index.name === "a_1").cacheResident, tojson(indexes));
+assert.eq(undefined, indexes.find(index => index.name === "c_1").cacheResident, tojson(indexes));
+
+assert.commandFailedWithCode(db.regular.createIndex({d: 1}, {cacheResident: "yes"}),
+                             ErrorCodes.TypeMismatch);
+
+// collMod changes the option of an existing collection.
+assert.commandWorked(db.runCommand({collMod: "regular", cacheResident: true}));
+assert.eq(true, getCollectionOptions("regular").cacheResident);
+assert.commandWorked(db.runCommand({collMod: "resident", cacheResident: false}));
+assert.eq(undefined, getCollectionOptions("resident").cacheResident);
+
+// collMod alters the existing tables of the collection and of its indexes. An index created with
+// the option stays cache resident when the collection no longer is.
+stats = db.regular.stats();
+assertCreationString(stats.wiredTiger, true);
+assertCreationString(stats.indexDetails._id_, true);
+assertCreationString(stats.indexDetails.c_1, true);
+stats = db.resident.stats();
+assertCreationString(stats.wiredTiger, false);
+assertCreationString(stats.indexDetails._id_, false);
+assertCreationString(stats.indexDetails.a_1, false);
+
+assert.commandWorked(db.regular.insert({a: 1, b: 1, c: 1}));
+assert.eq(1, db.regular.find({c: 1}).hint({c: 1}).itcount());
+
+assert.commandWorked(db.runCommand({collMod: "regular", cacheResident: false}));
+stats = db.regular.stats();
+assertCreationString(stats.wiredTiger, false);
+assertCreationString(stats.indexDetails.a_1, true);
+assertCreationString(stats.indexDetails.c_1, false);
+
+// The cluster cannot be downgraded while a collection or an index is cache resident.
+const adminDB = conn.getDB("admin");
+assert.commandWorked(db.runCommand({collMod: "resident", cacheResident: true}));
+assert.commandFailedWithCode(adminDB.runCommand({setFeatureCompatibilityVersion: lastLTSFCV}),
+                             ErrorCodes.CannotDowngrade);
+assert.commandWorked(db.runCommand({collMod: "resident", cacheResident: false}));
+assert.commandFailedWithCode(adminDB.runCommand({setFeatureCompatibilityVersion: lastLTSFCV}),
+                             ErrorCodes.CannotDowngrade);
+assert(db.regular.drop());
+assert.commandWorked(adminDB.runCommand({setFeatureCompatibilityVersion: lastLTSFCV}));
+
+// Once downgraded, the option is rejected.
+assert.commandFailedWithCode(db.createCollection("downgraded", {cacheResident: true}),
+                             ErrorCodes.InvalidOptions);
+assert.commandFailedWithCode(db.resident.createIndex({b: 1}, {cacheResident: true}),
+                             ErrorCodes.InvalidOptions);
+assert.commandFailedWithCode(db.runCommand({collMod: "resident", cacheResident: true}),
+                             ErrorCodes.InvalidOptions);
+
+assert.commandWorked(adminDB.runCommand({setFeatureCompatibilityVersion: latestFCV}));
+assert.commandWorked(db.runCommand({collMod: "resident", cacheResident: true}));
+
+// collMod does not fail while the collection is in use, such as by an open cursor.
+assert.commandWorked(db.resident.insert([{a: 1}, {a: 2}, {a: 3}]));
+const cursor = db.resident.find().batchSize(1);
+assert(cursor.hasNext());
+assert.commandWorked(db.runCommand({collMod: "resident", cacheResident: false}));
+assertCreationString(db.resident.stats().wiredTiger, false);
+assert.eq(3, cursor.itcount());
+
+MongoRunner.stopMongod(conn);
+}());
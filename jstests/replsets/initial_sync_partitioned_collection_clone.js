@@ -0,0 +1,51 @@
+/**
+ * Tests that initial sync clones a collection in concurrently fetched _id ranges when
+ * 'collectionClonerPartitions' is set, including documents whose _id values are of different
+ * types, and that collections which cannot be partitioned are still cloned with a single query.
+ */
+(function() {
+"use strict";
+
+const replTest = new ReplSetTest({nodes: 1});
+replTest.startSet();
+replTest.initiate();
+
+const dbName = jsTest.name();
+const primary = replTest.getPrimary();
+const primaryDB = primary.getDB(dbName);
+
+jsTestLog("Creating the collections.");
+const docs = [];
+for (let i = 0; i < 5000; ++i) {
+    docs.push({_id: i, x: i % 10, payload: "a".repeat(100)});
+    docs.push({_id: "str" + i, x: i % 10});
+    docs.push({_id: {sub: i}, x: [i, i + 1]});
+}
+docs.push({_id: MinKey, x: -1});
+docs.push({_id: MaxKey, x: -1});
+assert.commandWorked(primaryDB.partitioned.insert(docs));
+assert.commandWorked(primaryDB.partitioned.createIndex({x: 1}));
+
+assert.commandWorked(primaryDB.createCollection("capped", {capped: true, size: 1024 * 1024}));
+assert.commandWorked(primaryDB.capped.insert(docs.slice(0, 1000)));
+
+jsTestLog("Adding a secondary node to do the initial sync.");
+const secondary = replTest.add({
+    rsConfig: {priority: 0, votes: 0},
+    setParameter: {collectionClonerPartitions: 4, collectionClonerPartitionMinBytes: 0}
+});
+replTest.reInitiate();
+replTest.awaitSecondaryNodes();
+replTest.awaitReplication();
+
+checkLog.containsJson(secondary, 7086796);
+
+const secondaryDB = secondary.getDB(dbName);
+assert.eq(docs.length, secondaryDB.partitioned.find().itcount());
+assert.eq(1000, secondaryDB.capped.find().itcount());
+assert.eq(primaryDB.partitioned.find({x: 3}).hint({x: 1}).itcount(),
+          secondaryDB.partitioned.find({x: 3}).hint({x: 1}).itcount());
+
+replTest.checkReplicatedDataHashes();
+replTest.stopSet();
+})();
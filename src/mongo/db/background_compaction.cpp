@@ -0,0 +1,371 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/background_compaction.h"
+
+#include <deque>
+#include <functional>
+
+#include "mongo/base/counter.h"
+#include "mongo/db/auth/authorization_session.h"
+#include "mongo/db/background_compaction_gen.h"
+#include "mongo/db/catalog/collection.h"
+#include "mongo/db/catalog/collection_catalog.h"
+#include "mongo/db/catalog/index_catalog.h"
+#include "mongo/db/catalog_raii.h"
+#include "mongo/db/client.h"
+#include "mongo/db/commands/fsync_locked.h"
+#include "mongo/db/commands/server_status_metric.h"
+#include "mongo/db/index/index_access_method.h"
+#include "mongo/db/repl/replication_coordinator.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/stats/counters.h"
+#include "mongo/logv2/log.h"
+#include "mongo/util/concurrency/idle_thread_block.h"
+#include "mongo/util/fail_point.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
+
+
+namespace mongo {
+
+namespace {
+const auto getBackgroundCompactor =
+    ServiceContext::declareDecoration<std::unique_ptr<BackgroundCompactor>>();
+
+// Returns the number of inserts, updates and deletes the server has performed so far, including
+// those a secondary has applied from the oplog.
+long long totalWrites() {
+    return globalOpCounters.getInsert()->loadRelaxed() +
+        globalOpCounters.getUpdate()->loadRelaxed() + globalOpCounters.getDelete()->loadRelaxed() +
+        replOpCounters.getInsert()->loadRelaxed() + replOpCounters.getUpdate()->loadRelaxed() +
+        replOpCounters.getDelete()->loadRelaxed();
+}
+
+// Returns true if enough of a table's storage is free space to be worth compacting.
+bool hasSpaceToReclaim(int64_t storageSize, int64_t freeSize) {
+    const int64_t minFreeBytes = int64_t{backgroundCompactionMinFreeMB.load()} * 1024 * 1024;
+    if (storageSize <= 0 || freeSize < minFreeBytes) {
+        return false;
+    }
+    return freeSize * 100 >= storageSize * backgroundCompactionFreeSpaceTargetPercent.load();
+}
+
+}  // namespace
+
+MONGO_FAIL_POINT_DEFINE(hangBackgroundCompactorBetweenPasses);
+
+// A pass completes once no table has space left to reclaim. Every table is compacted in one or
+// more time slices.
+Counter64 backgroundCompactionPasses;
+Counter64 backgroundCompactionTimeSlices;
+Counter64 backgroundCompactionThrottledSlices;
+Counter64 backgroundCompactionTablesCompacted;
+Counter64 backgroundCompactionBytesReclaimed;
+
+ServerStatusMetricField<Counter64> backgroundCompactionPassesDisplay(
+    "backgroundCompaction.passes", &backgroundCompactionPasses);
+ServerStatusMetricField<Counter64> backgroundCompactionTimeSlicesDisplay(
+    "backgroundCompaction.timeSlices", &backgroundCompactionTimeSlices);
+ServerStatusMetricField<Counter64> backgroundCompactionThrottledSlicesDisplay(
+    "backgroundCompaction.throttledSlices", &backgroundCompactionThrottledSlices);
+ServerStatusMetricField<Counter64> backgroundCompactionTablesCompactedDisplay(
+    "backgroundCompaction.tablesCompacted", &backgroundCompactionTablesCompacted);
+ServerStatusMetricField<Counter64> backgroundCompactionBytesReclaimedDisplay(
+    "backgroundCompaction.bytesReclaimed", &backgroundCompactionBytesReclaimed);
+
+BackgroundCompactor* BackgroundCompactor::get(ServiceContext* serviceCtx) {
+    return getBackgroundCompactor(serviceCtx).get();
+}
+
+void BackgroundCompactor::set(ServiceContext* serviceCtx,
+                              std::unique_ptr<BackgroundCompactor> compactor) {
+    auto& backgroundCompactor = getBackgroundCompactor(serviceCtx);
+    if (backgroundCompactor) {
+        invariant(!backgroundCompactor->running(),
+                  "Tried to reset the BackgroundCompactor without shutting down the original "
+                  "instance.");
+    }
+
+    invariant(compactor);
+    backgroundCompactor = std::move(compactor);
+}
+
+void BackgroundCompactor::run() {
+    ThreadClient tc(name(), getGlobalServiceContext());
+    AuthorizationSession::get(cc())->grantInternalAuthorization(&cc());
+
+    {
+        stdx::lock_guard<Client> lk(*tc.get());
+        tc.get()->setSystemOperationKillableByStepdown(lk);
+    }
+
+    while (_sleepFor(Seconds(backgroundCompactionSleepSecs.load()))) {
+        if (!backgroundCompactionEnabled.load()) {
+            continue;
+        }
+
+        if (lockedForWriting()) {
+            LOGV2_DEBUG(7086786, 3, "Skipping background compaction while locked for writing");
+            continue;
+        }
+
+        const ServiceContext::UniqueOperationContext opCtxPtr = cc().makeOperationContext();
+        OperationContext* opCtx = opCtxPtr.get();
+
+        hangBackgroundCompactorBetweenPasses.pauseWhileSet(opCtx);
+
+        try {
+            _doPass(opCtx);
+        } catch (const ExceptionForCat<ErrorCategory::Interruption>& interruption) {
+            LOGV2_WARNING(7086787,
+                          "BackgroundCompactor was interrupted, waiting before doing another pass",
+                          "interruption"_attr = interruption,
+                          "wait"_attr = Seconds(backgroundCompactionSleepSecs.load()));
+        }
+    }
+}
+
+void BackgroundCompactor::shutdown() {
+    LOGV2(7086788, "Shutting down background compactor thread");
+    {
+        stdx::lock_guard<Latch> lk(_stateMutex);
+        _shuttingDown = true;
+        _shuttingDownCV.notify_one();
+    }
+    wait();
+    LOGV2(7086789, "Finished shutting down background compactor thread");
+}
+
+void BackgroundCompactor::_doPass(OperationContext* opCtx) {
+    // If part of replSet but not in a readable state (e.g. during initial sync), skip.
+    auto replCoord = repl::ReplicationCoordinator::get(opCtx);
+    if (replCoord->getReplicationMode() == repl::ReplicationCoordinator::modeReplSet &&
+        !replCoord->getMemberState().readable()) {
+        return;
+    }
+
+    ON_BLOCK_EXIT([&] { backgroundCompactionPasses.increment(); });
+
+    std::deque<Table> work;
+    auto collectionCatalog = CollectionCatalog::get(opCtx);
+    for (const auto& dbName : collectionCatalog->getAllDbNames()) {
+        for (const auto& uuid : collectionCatalog->getAllCollectionUUIDsFromDb(dbName)) {
+            auto nss = collectionCatalog->lookupNSSByUUID(opCtx, uuid);
+            if (!nss || nss->isOplog() || nss->isDropPendingNamespace()) {
+                continue;
+            }
+
+            AutoGetCollection coll(opCtx, *nss, MODE_IS);
+            if (!coll || coll->uuid() != uuid) {
+                continue;
+            }
+
+            work.push_back({uuid, *nss});
+            auto it = coll->getIndexCatalog()->getIndexIterator(
+                opCtx, IndexCatalog::InclusionPolicy::kReady);
+            while (it->more()) {
+                const IndexCatalogEntry* entry = it->next();
+                // Only indexes backed by a SortedDataInterface support compaction.
+                if (!entry->accessMethod()->asSortedData()) {
+                    continue;
+                }
+                work.push_back({uuid, *nss, entry->descriptor()->indexName()});
+            }
+        }
+    }
+
+    // Every table gets a time slice before any table gets a second one, so that a single large
+    // table does not delay reclaiming space elsewhere.
+    while (!work.empty()) {
+        if (!backgroundCompactionEnabled.load() || !_waitForWriteLoad()) {
+            return;
+        }
+        opCtx->checkForInterrupt();
+
+        Table table = std::move(work.front());
+        work.pop_front();
+        if (_compactSlice(opCtx, &table)) {
+            work.push_back(std::move(table));
+        }
+    }
+}
+
+bool BackgroundCompactor::_compactSlice(OperationContext* opCtx, Table* table) {
+    try {
+        AutoGetCollection coll(opCtx, table->nss, MODE_IX);
+        if (!coll || coll->uuid() != table->uuid) {
+            // The collection was dropped or renamed since the pass started.
+            return false;
+        }
+
+        auto recordStore = coll->getRecordStore();
+        if (!recordStore->compactSupported() || !recordStore->supportsOnlineCompaction()) {
+            return false;
+        }
+
+        std::function<int64_t()> storageSize;
+        std::function<int64_t()> freeSize;
+        std::function<Status(const CompactOptions&)> compact;
+        if (table->indexName.empty()) {
+            storageSize = [&] { return recordStore->storageSize(opCtx); };
+            freeSize = [&] { return recordStore->freeStorageSize(opCtx); };
+            compact = [&](const CompactOptions& options) {
+                return recordStore->compact(opCtx, options);
+            };
+        } else {
+            auto indexCatalog = coll->getIndexCatalog();
+            auto desc = indexCatalog->findIndexByName(opCtx, table->indexName);
+            if (!desc) {
+                return false;
+            }
+            auto accessMethod = indexCatalog->getEntry(desc)->accessMethod();
+            if (!accessMethod->asSortedData()) {
+                return false;
+            }
+            storageSize = [&] { return accessMethod->getSpaceUsedBytes(opCtx); };
+            freeSize = [&] { return accessMethod->getFreeStorageBytes(opCtx); };
+            compact = [&](const CompactOptions& options) {
+                return accessMethod->compact(opCtx, options);
+            };
+        }
+
+        const int64_t sizeBefore = storageSize();
+        if (!hasSpaceToReclaim(sizeBefore, freeSize())) {
+            return false;
+        }
+        if (table->slices == 0) {
+            table->initialStorageSize = sizeBefore;
+        }
+
+        CompactOptions options;
+        options.timeSlice = Seconds(backgroundCompactionTimeSliceSecs.load());
+        Status status = compact(options);
+        ++table->slices;
+        backgroundCompactionTimeSlices.increment();
+
+        const int64_t sizeAfter = storageSize();
+        backgroundCompactionBytesReclaimed.increment(std::max<int64_t>(sizeBefore - sizeAfter, 0));
+
+        if (status.code() == ErrorCodes::ExceededTimeLimit) {
+            LOGV2_DEBUG(7086790,
+                        1,
+                        "Background compaction time slice ended",
+                        "namespace"_attr = table->nss,
+                        "index"_attr = table->indexName,
+                        "slices"_attr = table->slices,
+                        "initialStorageSize"_attr = table->initialStorageSize,
+                        "storageSize"_attr = sizeAfter);
+            return true;
+        }
+
+        if (!status.isOK()) {
+            LOGV2_WARNING(7086791,
+                          "Background compaction failed",
+                          "namespace"_attr = table->nss,
+                          "index"_attr = table->indexName,
+                          "error"_attr = redact(status));
+            return false;
+        }
+
+        backgroundCompactionTablesCompacted.increment();
+        LOGV2(7086792,
+              "Background compaction finished",
+              "namespace"_attr = table->nss,
+              "index"_attr = table->indexName,
+              "slices"_attr = table->slices,
+              "initialStorageSize"_attr = table->initialStorageSize,
+              "storageSize"_attr = sizeAfter);
+        return false;
+    } catch (const ExceptionForCat<ErrorCategory::Interruption>&) {
+        // The interruption applies to the whole pass, not just this table.
+        throw;
+    } catch (const DBException& ex) {
+        LOGV2_ERROR(7086803,
+                    "Error during background compaction",
+                    "namespace"_attr = table->nss,
+                    "index"_attr = table->indexName,
+                    "error"_attr = ex);
+        return false;
+    }
+}
+
+bool BackgroundCompactor::_waitForWriteLoad() {
+    while (true) {
+        const int maxWritesPerSecond = backgroundCompactionMaxWritesPerSecond.load();
+        if (maxWritesPerSecond == 0) {
+            return true;
+        }
+
+        // Measure the write rate over one second before deciding whether to start a slice.
+        const long long writesBefore = totalWrites();
+        if (!_sleepFor(Seconds(1))) {
+            return false;
+        }
+        const long long writesPerSecond = totalWrites() - writesBefore;
+        if (writesPerSecond <= maxWritesPerSecond) {
+            return true;
+        }
+
+        backgroundCompactionThrottledSlices.increment();
+        LOGV2_DEBUG(7086793,
+                    2,
+                    "Postponing background compaction because of the write load",
+                    "writesPerSecond"_attr = writesPerSecond,
+                    "maxWritesPerSecond"_attr = maxWritesPerSecond);
+    }
+}
+
+bool BackgroundCompactor::_sleepFor(Milliseconds timeout) {
+    auto deadline = Date_t::now() + timeout;
+    stdx::unique_lock<Latch> lk(_stateMutex);
+
+    MONGO_IDLE_THREAD_BLOCK;
+    _shuttingDownCV.wait_until(lk, deadline.toSystemTimePoint(), [&] { return _shuttingDown; });
+    return !_shuttingDown;
+}
+
+void startBackgroundCompactor(ServiceContext* serviceContext) {
+    std::unique_ptr<BackgroundCompactor> compactor = std::make_unique<BackgroundCompactor>();
+    compactor->go();
+    BackgroundCompactor::set(serviceContext, std::move(compactor));
+}
+
+void shutdownBackgroundCompactor(ServiceContext* serviceContext) {
+    BackgroundCompactor* compactor = BackgroundCompactor::get(serviceContext);
+    // We allow the BackgroundCompactor not to be set in case shutdown occurs before the thread has
+    // been initialized.
+    if (compactor) {
+        compactor->shutdown();
+    }
+}
+
+}  // namespace mongo
@@ -0,0 +1,132 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/storage/compact_options.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/util/background.h"
+#include "mongo/util/uuid.h"
+
+namespace mongo {
+
+class OperationContext;
+class ServiceContext;
+
+/**
+ * Instantiates the BackgroundCompactor to periodically reclaim free space from collections and
+ * indexes. Safe to call again after shutdownBackgroundCompactor() has been called.
+ */
+void startBackgroundCompactor(ServiceContext* serviceContext);
+
+/**
+ * Shuts down the BackgroundCompactor if it is running. Safe to call multiple times.
+ */
+void shutdownBackgroundCompactor(ServiceContext* serviceContext);
+
+/**
+ * Compacts collections and indexes online while the server keeps serving reads and writes.
+ *
+ * Each pass visits every table and compacts the ones where the free space available for reuse
+ * exceeds 'backgroundCompactionFreeSpaceTargetPercent' of the storage size. Tables are compacted
+ * in time slices of 'backgroundCompactionTimeSliceSecs' under intent locks, which are released
+ * between slices. A table that is not done at the end of a slice is resumed after every other
+ * table has had a slice, and slices are postponed while the server is busy with writes.
+ */
+class BackgroundCompactor : public BackgroundJob {
+public:
+    explicit BackgroundCompactor() : BackgroundJob(false /* selfDelete */) {}
+
+    static BackgroundCompactor* get(ServiceContext* serviceCtx);
+
+    static void set(ServiceContext* serviceCtx, std::unique_ptr<BackgroundCompactor> compactor);
+
+    std::string name() const {
+        return "BackgroundCompactor";
+    }
+
+    void run();
+
+    /**
+     * Signals the thread to quit and then waits until it does.
+     */
+    void shutdown();
+
+private:
+    /**
+     * A table to compact: the record store of a collection when 'indexName' is empty, otherwise
+     * one of its indexes.
+     */
+    struct Table {
+        UUID uuid;
+        NamespaceString nss;
+        std::string indexName;
+
+        // Progress of the compaction of this table over the current pass.
+        int slices = 0;
+        int64_t initialStorageSize = 0;
+    };
+
+    /**
+     * Compacts every table with enough free space, one time slice at a time, until none has more
+     * space to reclaim.
+     */
+    void _doPass(OperationContext* opCtx);
+
+    /**
+     * Compacts 'table' for at most one time slice. Returns true if the table still has space to
+     * reclaim and should be visited again.
+     */
+    bool _compactSlice(OperationContext* opCtx, Table* table);
+
+    /**
+     * Waits while the server performs more writes than 'backgroundCompactionMaxWritesPerSecond'.
+     * Returns false if a shutdown was requested in the meantime.
+     */
+    bool _waitForWriteLoad();
+
+    /**
+     * Waits until either 'timeout' passes or a shutdown is requested. Returns false in the latter
+     * case.
+     */
+    bool _sleepFor(Milliseconds timeout);
+
+    // Protects the state below.
+    mutable Mutex _stateMutex = MONGO_MAKE_LATCH("BackgroundCompactorStateMutex");
+
+    // Signaled to wake up the thread, if the thread is waiting. The thread will check whether
+    // _shuttingDown is set and stop accordingly.
+    mutable stdx::condition_variable _shuttingDownCV;
+
+    bool _shuttingDown = false;
+};
+
+}  // namespace mongo
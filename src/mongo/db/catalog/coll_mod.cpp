@@ -113,6 +113,7 @@ struct ParsedCollModRequest {
     boost::optional<ValidationLevelEnum> collValidationLevel;
     bool recordPreImages = false;
     boost::optional<ChangeStreamPreAndPostImagesOptions> changeStreamPreAndPostImagesOptions;
+    boost::optional<bool> cacheResident;
     int numModifications = 0;
     bool dryRun = false;
     boost::optional<long long> cappedSize;
@@ -510,6 +511,22 @@ StatusWith<std::pair<ParsedCollModRequest, BSONObj>> parseCollModRequest(Operati
         changeStreamPreAndPostImages->serialize(&subObjBuilder);
     }
 
+    if (const auto& cacheResident = cmr.getCacheResident()) {
+        if (isView) {
+            return getNotSupportedOnViewError(CollMod::kCacheResidentFieldName);
+        }
+        // Turning the option off is always allowed, so that it can be removed before a downgrade.
+        if (*cacheResident &&
+            !feature_flags::gCacheResident.isEnabled(serverGlobalParams.featureCompatibility)) {
+            return {ErrorCodes::InvalidOptions,
+                    "collMod does not support the 'cacheResident' option in the current feature "
+                    "compatibility version"};
+        }
+        parsed.numModifications++;
+        parsed.cacheResident = *cacheResident;
+        oplogEntryBuilder.append(CollMod::kCacheResidentFieldName, *cacheResident);
+    }
+
     if (auto& expireAfterSeconds = cmr.getExpireAfterSeconds()) {
         if (isView) {
             return getNotSupportedOnViewError(CollMod::kExpireAfterSecondsFieldName);
@@ -900,6 +917,10 @@ Status _collModInternal(OperationContext* opCtx,
             coll.getWritableCollection(opCtx)->setRecordPreImages(opCtx, cmrNew.recordPreImages);
         }
 
+        if (cmrNew.cacheResident && *cmrNew.cacheResident != oldCollOptions.cacheResident) {
+            coll.getWritableCollection(opCtx)->setCacheResident(opCtx, *cmrNew.cacheResident);
+        }
+
         if (cmrNew.changeStreamPreAndPostImagesOptions.has_value() &&
             *cmrNew.changeStreamPreAndPostImagesOptions !=
                 oldCollOptions.changeStreamPreAndPostImagesOptions) {
@@ -432,12 +432,16 @@ public:
      * outside this Collection. The bulk loader is notified with the RecordId of the document
      * inserted into the RecordStore.
      *
+     * If 'recordStoreBulkLoader' is not null, the document is appended through it rather than
+     * inserted transactionally, and is not rolled back with the WriteUnitOfWork.
+     *
      * NOTE: It is up to caller to commit the indexes.
      */
     virtual Status insertDocumentForBulkLoader(
         OperationContext* opCtx,
         const BSONObj& doc,
-        const OnRecordInsertedFn& onRecordInserted) const = 0;
+        const OnRecordInsertedFn& onRecordInserted,
+        RecordStore::BulkLoader* recordStoreBulkLoader) const = 0;
 
     /**
      * Updates the document @ oldLocation with newDoc.
@@ -531,6 +535,12 @@ public:
     virtual bool getRecordPreImages() const = 0;
     virtual void setRecordPreImages(OperationContext* opCtx, bool val) = 0;
 
+    /**
+     * Sets whether the storage engine keeps this collection and its indexes in its cache. Indexes
+     * created with the 'cacheResident' option stay in cache regardless.
+     */
+    virtual void setCacheResident(OperationContext* opCtx, bool val) = 0;
+
     virtual bool isChangeStreamPreAndPostImagesEnabled() const = 0;
     virtual void setChangeStreamPreAndPostImages(OperationContext* opCtx,
                                                  ChangeStreamPreAndPostImagesOptions val) = 0;
@@ -112,12 +112,12 @@ StatusWith<int64_t> compactCollection(OperationContext* opCtx,
     auto oldTotalSize = recordStore->storageSize(opCtx) + collection->getIndexSize(opCtx);
     auto indexCatalog = collection->getIndexCatalog();
 
-    Status status = recordStore->compact(opCtx);
+    Status status = recordStore->compact(opCtx, CompactOptions{});
     if (!status.isOK())
         return status;
 
     // Compact all indexes (not including unfinished indexes)
-    status = indexCatalog->compactIndexes(opCtx);
+    status = indexCatalog->compactIndexes(opCtx, CompactOptions{});
     if (!status.isOK())
         return status;
 
@@ -76,6 +76,7 @@
 #include "mongo/db/storage/durable_catalog.h"
 #include "mongo/db/storage/key_string.h"
 #include "mongo/db/storage/record_store.h"
+#include "mongo/db/storage/storage_engine.h"
 #include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/db/timeseries/timeseries_constants.h"
 #include "mongo/db/timeseries/timeseries_index_schema_conversion_functions.h"
@@ -906,7 +907,10 @@ Status CollectionImpl::insertDocument(OperationContext* opCtx,
 }
 
 Status CollectionImpl::insertDocumentForBulkLoader(
-    OperationContext* opCtx, const BSONObj& doc, const OnRecordInsertedFn& onRecordInserted) const {
+    OperationContext* opCtx,
+    const BSONObj& doc,
+    const OnRecordInsertedFn& onRecordInserted,
+    RecordStore::BulkLoader* recordStoreBulkLoader) const {
 
     auto status = checkFailCollectionInsertsFailPoint(_ns, doc);
     if (!status.isOK()) {
@@ -929,8 +933,10 @@ Status CollectionImpl::insertDocumentForBulkLoader(
 
     // Using timestamp 0 for these inserts, which are non-oplog so we don't have an appropriate
     // timestamp to use.
-    StatusWith<RecordId> loc = _shared->_recordStore->insertRecord(
-        opCtx, recordId, doc.objdata(), doc.objsize(), Timestamp());
+    StatusWith<RecordId> loc = recordStoreBulkLoader
+        ? recordStoreBulkLoader->insertRecord(doc.objdata(), doc.objsize())
+        : _shared->_recordStore->insertRecord(
+              opCtx, recordId, doc.objdata(), doc.objsize(), Timestamp());
 
     if (!loc.isOK())
         return loc.getStatus();
@@ -1681,6 +1687,31 @@ void CollectionImpl::setRecordPreImages(OperationContext* opCtx, bool val) {
         opCtx, [&](BSONCollectionCatalogEntry::MetaData& md) { md.options.recordPreImages = val; });
 }
 
+void CollectionImpl::setCacheResident(OperationContext* opCtx, bool val) {
+    _writeMetadata(
+        opCtx, [&](BSONCollectionCatalogEntry::MetaData& md) { md.options.cacheResident = val; });
+
+    std::vector<std::pair<std::string, bool>> identsToAlter{
+        {_shared->_recordStore->getIdent(), val}};
+    auto ii = _indexCatalog->getIndexIterator(
+        opCtx, IndexCatalog::InclusionPolicy::kReady | IndexCatalog::InclusionPolicy::kUnfinished);
+    while (ii->more()) {
+        const IndexCatalogEntry* entry = ii->next();
+        identsToAlter.emplace_back(entry->getIdent(), val || entry->descriptor()->cacheResident());
+    }
+
+    // Changing the cache residency of a table is not transactional, so it is only applied once the
+    // catalog write commits. It waits while a table is busy instead of failing, since neither the
+    // collMod nor a secondary applying it can be failed at that point.
+    auto engine = opCtx->getServiceContext()->getStorageEngine()->getEngine();
+    opCtx->recoveryUnit()->onCommit(
+        [opCtx, engine, identsToAlter = std::move(identsToAlter)](boost::optional<Timestamp>) {
+            for (const auto& [ident, cacheResident] : identsToAlter) {
+                fassert(7086807, engine->setIdentCacheResident(opCtx, ident, cacheResident));
+            }
+        });
+}
+
 bool CollectionImpl::isChangeStreamPreAndPostImagesEnabled() const {
     return _metadata->options.changeStreamPreAndPostImagesOptions.getEnabled();
 }
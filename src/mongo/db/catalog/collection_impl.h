@@ -220,7 +220,8 @@ public:
      */
     Status insertDocumentForBulkLoader(OperationContext* opCtx,
                                        const BSONObj& doc,
-                                       const OnRecordInsertedFn& onRecordInserted) const final;
+                                       const OnRecordInsertedFn& onRecordInserted,
+                                       RecordStore::BulkLoader* recordStoreBulkLoader) const final;
 
     /**
      * Updates the document @ oldLocation with newDoc.
@@ -319,6 +320,8 @@ public:
     bool getRecordPreImages() const final;
     void setRecordPreImages(OperationContext* opCtx, bool val) final;
 
+    void setCacheResident(OperationContext* opCtx, bool val) final;
+
     bool isChangeStreamPreAndPostImagesEnabled() const final;
     void setChangeStreamPreAndPostImages(OperationContext* opCtx,
                                          ChangeStreamPreAndPostImagesOptions val) final;
@@ -169,7 +169,8 @@ public:
 
     Status insertDocumentForBulkLoader(OperationContext* opCtx,
                                        const BSONObj& doc,
-                                       const OnRecordInsertedFn& onRecordInserted) const {
+                                       const OnRecordInsertedFn& onRecordInserted,
+                                       RecordStore::BulkLoader* recordStoreBulkLoader) const {
         MONGO_UNREACHABLE;
     }
 
@@ -285,6 +286,10 @@ public:
         MONGO_UNREACHABLE;
     }
 
+    void setCacheResident(OperationContext* opCtx, bool val) {
+        MONGO_UNREACHABLE;
+    }
+
     bool isChangeStreamPreAndPostImagesEnabled() const {
         MONGO_UNREACHABLE;
     }
@@ -174,6 +174,8 @@ StatusWith<CollectionOptions> CollectionOptions::parse(const BSONObj& options, P
             collectionOptions.temp = e.trueValue();
         } else if (fieldName == "recordPreImages") {
             collectionOptions.recordPreImages = e.trueValue();
+        } else if (fieldName == "cacheResident") {
+            collectionOptions.cacheResident = e.trueValue();
         } else if (fieldName == "changeStreamPreAndPostImages") {
             if (e.type() != mongo::Object) {
                 return {ErrorCodes::InvalidOptions,
@@ -370,6 +372,9 @@ CollectionOptions CollectionOptions::fromCreateCommand(const NamespaceString& ns
     if (auto changeStreamPreAndPostImagesOptions = cmd.getChangeStreamPreAndPostImages()) {
         options.changeStreamPreAndPostImagesOptions = *changeStreamPreAndPostImagesOptions;
     }
+    if (auto cacheResident = cmd.getCacheResident()) {
+        options.cacheResident = *cacheResident;
+    }
     if (auto timeseries = cmd.getTimeseries()) {
         options.timeseries = std::move(*timeseries);
     }
@@ -439,6 +444,10 @@ void CollectionOptions::appendBSON(BSONObjBuilder* builder,
         builder->appendBool(CreateCommand::kRecordPreImagesFieldName, true);
     }
 
+    if (cacheResident && shouldAppend(CreateCommand::kCacheResidentFieldName)) {
+        builder->appendBool(CreateCommand::kCacheResidentFieldName, true);
+    }
+
     // TODO SERVER-58584: remove the feature flag.
     if (feature_flags::gFeatureFlagChangeStreamPreAndPostImages.isEnabledAndIgnoreFCV() &&
         changeStreamPreAndPostImagesOptions.getEnabled() &&
@@ -535,6 +544,10 @@ bool CollectionOptions::matchesStorageOptions(const CollectionOptions& other,
         return false;
     }
 
+    if (cacheResident != other.cacheResident) {
+        return false;
+    }
+
     if (temp != other.temp) {
         return false;
     }
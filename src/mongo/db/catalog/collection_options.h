@@ -132,6 +132,10 @@ struct CollectionOptions {
     // via changeStreams. Can not be enabled together with 'recordPreImages' (mutually exclusive).
     ChangeStreamPreAndPostImagesOptions changeStreamPreAndPostImagesOptions{false};
 
+    // Whether the storage engine should keep the collection and its indexes in its cache. Meant
+    // for small, latency-sensitive collections that would otherwise be evicted by large scans.
+    bool cacheResident = false;
+
     // Storage engine collection options. Always owned or empty.
     BSONObj storageEngine;
 
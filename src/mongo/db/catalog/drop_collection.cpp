@@ -177,6 +177,32 @@ Status _dropView(OperationContext* opCtx,
     return Status::OK();
 }
 
+/**
+ * Drops the query statistics persisted for the collection 'nss', if any, so that a collection
+ * created later under the same name does not inherit them.
+ */
+void _dropStatisticsCollection(OperationContext* opCtx,
+                               Database* db,
+                               const NamespaceString& nss) {
+    if (nss.isSystemStatsCollection()) {
+        return;
+    }
+
+    const auto statsNss = nss.makeStatisticsNamespace();
+    Lock::CollectionLock statsLock(opCtx, statsNss, MODE_X);
+    if (!CollectionCatalog::get(opCtx)->lookupCollectionByNamespace(opCtx, statsNss)) {
+        return;
+    }
+
+    // Drop the statistics collection in its own writeConflictRetry so that if it throws a WCE,
+    // only the statistics collection drop is retried.
+    writeConflictRetry(opCtx, "drop", statsNss.ns(), [opCtx, db, &statsNss] {
+        WriteUnitOfWork wuow(opCtx);
+        db->dropCollectionEvenIfSystem(opCtx, statsNss).ignore();
+        wuow.commit();
+    });
+}
+
 Status _abortIndexBuildsAndDrop(OperationContext* opCtx,
                                 AutoGetDb&& autoDb,
                                 const NamespaceString& startingNss,
@@ -367,17 +393,22 @@ Status _dropCollection(OperationContext* opCtx,
                     collectionName,
                     expectedUUID,
                     [opCtx, systemCollectionMode](Database* db, const NamespaceString& resolvedNs) {
-                        WriteUnitOfWork wuow(opCtx);
-
-                        auto status = systemCollectionMode ==
-                                DropCollectionSystemCollectionMode::kDisallowSystemCollectionDrops
-                            ? db->dropCollection(opCtx, resolvedNs)
-                            : db->dropCollectionEvenIfSystem(opCtx, resolvedNs);
-                        if (!status.isOK()) {
-                            return status;
+                        {
+                            WriteUnitOfWork wuow(opCtx);
+
+                            auto status = systemCollectionMode ==
+                                    DropCollectionSystemCollectionMode::
+                                        kDisallowSystemCollectionDrops
+                                ? db->dropCollection(opCtx, resolvedNs)
+                                : db->dropCollectionEvenIfSystem(opCtx, resolvedNs);
+                            if (!status.isOK()) {
+                                return status;
+                            }
+
+                            wuow.commit();
                         }
 
-                        wuow.commit();
+                        _dropStatisticsCollection(opCtx, db, resolvedNs);
                         return Status::OK();
                     },
                     reply,
@@ -1798,7 +1798,8 @@ void IndexCatalogImpl::unindexRecord(OperationContext* opCtx,
     }
 }
 
-Status IndexCatalogImpl::compactIndexes(OperationContext* opCtx) const {
+Status IndexCatalogImpl::compactIndexes(OperationContext* opCtx,
+                                        const CompactOptions& options) const {
     for (IndexCatalogEntryContainer::const_iterator it = _readyIndexes.begin();
          it != _readyIndexes.end();
          ++it) {
@@ -1808,7 +1809,7 @@ Status IndexCatalogImpl::compactIndexes(OperationContext* opCtx) const {
                     1,
                     "compacting index: {entry_descriptor}",
                     "entry_descriptor"_attr = *(entry->descriptor()));
-        Status status = entry->accessMethod()->compact(opCtx);
+        Status status = entry->accessMethod()->compact(opCtx, options);
         if (!status.isOK()) {
             LOGV2_ERROR(20377,
                         "Failed to compact index",
@@ -1908,6 +1909,10 @@ StatusWith<BSONObj> IndexCatalogImpl::_fixIndexSpec(OperationContext* opCtx,
         b.appendBool("prepareUnique",
                      true);  // normalize to bool true in case was int 1 or something...
 
+    if (o["cacheResident"].trueValue())
+        b.appendBool("cacheResident",
+                     true);  // normalize to bool true in case was int 1 or something...
+
     BSONObj key = fixIndexKey(o["key"].Obj());
     b.append("key", key);
 
@@ -1937,7 +1942,7 @@ StatusWith<BSONObj> IndexCatalogImpl::_fixIndexSpec(OperationContext* opCtx,
                 // dropDups is silently ignored and removed from the spec as of SERVER-14710.
                 // ns is removed from the spec as of 4.4.
             } else if (s == "v" || s == "unique" || s == "key" || s == "name" || s == "hidden" ||
-                       s == "prepareUnique") {
+                       s == "prepareUnique" || s == "cacheResident") {
                 // covered above
             } else {
                 b.append(e);
@@ -262,7 +262,7 @@ public:
                        int64_t* keysDeletedOut,
                        CheckRecordId checkRecordId = CheckRecordId::Off) const override;
 
-    Status compactIndexes(OperationContext* opCtx) const override;
+    Status compactIndexes(OperationContext* opCtx, const CompactOptions& options) const override;
 
     inline std::string getAccessMethodName(const BSONObj& keyPattern) override {
         return _getAccessMethodName(keyPattern);
@@ -269,6 +269,7 @@ BSONObj repairIndexSpec(const NamespaceString& ns,
              IndexDescriptor::kSparseFieldName == fieldName ||
              IndexDescriptor::kDropDuplicatesFieldName == fieldName ||
              IndexDescriptor::kPrepareUniqueFieldName == fieldName ||
+             IndexDescriptor::kCacheResidentFieldName == fieldName ||
              IndexDescriptor::kClusteredFieldName == fieldName) &&
             !indexSpecElem.isNumber() && !indexSpecElem.isBoolean() && indexSpecElem.trueValue()) {
             LOGV2_WARNING(6444400,
@@ -505,6 +506,7 @@ StatusWith<BSONObj> validateIndexSpec(OperationContext* opCtx, const BSONObj& in
                     IndexDescriptor::k2dsphereFinestIndexedLevel == indexSpecElemFieldName ||
                     IndexDescriptor::kDropDuplicatesFieldName == indexSpecElemFieldName ||
                     IndexDescriptor::kPrepareUniqueFieldName == indexSpecElemFieldName ||
+                    IndexDescriptor::kCacheResidentFieldName == indexSpecElemFieldName ||
                     IndexDescriptor::kClusteredFieldName == indexSpecElemFieldName)) {
             if (!indexSpecElem.isNumber() && !indexSpecElem.isBoolean()) {
                 return {ErrorCodes::TypeMismatch,
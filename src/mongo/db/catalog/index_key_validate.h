@@ -51,6 +51,7 @@ static std::set<StringData> allowedFieldNames = {
     IndexDescriptor::k2dsphereFinestIndexedLevel,
     IndexDescriptor::k2dsphereVersionFieldName,
     IndexDescriptor::kBackgroundFieldName,
+    IndexDescriptor::kCacheResidentFieldName,
     IndexDescriptor::kCollationFieldName,
     IndexDescriptor::kDefaultLanguageFieldName,
     IndexDescriptor::kDropDuplicatesFieldName,
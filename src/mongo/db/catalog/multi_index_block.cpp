@@ -32,6 +32,7 @@
 
 #include "mongo/db/catalog/multi_index_block.h"
 
+#include <algorithm>
 #include <ostream>
 
 #include "mongo/base/error_codes.h"
@@ -56,8 +57,11 @@
 #include "mongo/db/timeseries/timeseries_index_schema_conversion_functions.h"
 #include "mongo/logv2/log.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/fail_point.h"
+#include "mongo/util/future.h"
 #include "mongo/util/log_and_backoff.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/progress_meter.h"
 #include "mongo/util/quick_exit.h"
 #include "mongo/util/scopeguard.h"
@@ -78,13 +82,77 @@ MONGO_FAIL_POINT_DEFINE(leaveIndexBuildUnfinishedForShutdown);
 
 namespace {
 
+// When index keys are generated on more than one thread, the collection scan hands documents to
+// the threads in batches. A batch, and the keys generated from it, may use up to this fraction of
+// the index build memory limit, which is taken away from the memory of the external sorters.
+constexpr size_t kKeyGenerationBatchMemoryFraction = 8;
+
+// The maximum number of documents in a batch, which bounds the per-document bookkeeping.
+constexpr size_t kKeyGenerationBatchMaxDocs = 16 * 1024;
+
+// The smallest share of a batch worth generating keys for on a thread of its own.
+constexpr size_t kKeyGenerationMinBytesPerThread = 1024 * 1024;
+
+size_t getKeyGenerationBatchMaxBytes() {
+    return static_cast<std::size_t>(maxIndexBuildMemoryUsageMegabytes.load()) * 1024 * 1024 /
+        kKeyGenerationBatchMemoryFraction;
+}
+
+/**
+ * Returns the number of threads to generate index keys on during the collection scan. This is
+ * bounded by 'maxIndexBuildKeyGenerationThreads', by the number of cores, and by the index build
+ * memory limit.
+ */
+size_t getNumKeyGenerationThreads() {
+    const size_t maxThreadsForMemory =
+        std::max<size_t>(1, getKeyGenerationBatchMaxBytes() / kKeyGenerationMinBytesPerThread);
+    return std::min({static_cast<size_t>(maxIndexBuildKeyGenerationThreads.load()),
+                     static_cast<size_t>(ProcessInfo::getNumAvailableCores()),
+                     maxThreadsForMemory});
+}
+
 size_t getEachIndexBuildMaxMemoryUsageBytes(size_t numIndexSpecs) {
     if (numIndexSpecs == 0) {
         return 0;
     }
 
-    return static_cast<std::size_t>(maxIndexBuildMemoryUsageMegabytes.load()) * 1024 * 1024 /
-        numIndexSpecs;
+    auto maxMemoryUsageBytes =
+        static_cast<std::size_t>(maxIndexBuildMemoryUsageMegabytes.load()) * 1024 * 1024;
+    if (getNumKeyGenerationThreads() > 1) {
+        maxMemoryUsageBytes -= getKeyGenerationBatchMaxBytes();
+    }
+    return maxMemoryUsageBytes / numIndexSpecs;
+}
+
+/**
+ * The keys generated for one document and one index by a key generation thread.
+ */
+struct GeneratedKeys {
+    Status status = Status::OK();
+
+    // False if the document does not match the index's partial filter.
+    bool indexed = false;
+
+    KeyStringSet keys;
+    KeyStringSet multikeyMetadataKeys;
+    MultikeyPaths multikeyPaths;
+
+    // Set if a key generation error was suppressed.
+    boost::optional<Status> suppressedError;
+};
+
+std::unique_ptr<ThreadPool> makeKeyGenerationPool(size_t numThreads) {
+    ThreadPool::Options options;
+    options.poolName = "IndexBuildKeyGenerationThreadPool";
+    options.threadNamePrefix = "IndexBuildKeyGeneration-";
+    options.minThreads = 0;
+    options.maxThreads = numThreads;
+    options.onCreateThread = [](const std::string& threadName) {
+        Client::initThread(threadName);
+    };
+    auto pool = std::make_unique<ThreadPool>(options);
+    pool->startup();
+    return pool;
 }
 
 Status timeseriesMixedSchemaDataFailure(const Collection* collection) {
@@ -610,6 +678,55 @@ void MultiIndexBlock::_doCollectionScan(OperationContext* opCtx,
               IndexBuildPhase_serializer(_phase).toString());
     _phase = IndexBuildPhaseEnum::kCollectionScan;
 
+    // Generating keys on other threads is only supported by the indexes that sort their keys in
+    // the external sorter.
+    size_t numKeyGenerationThreads = getNumKeyGenerationThreads();
+    if (_indexes.empty() ||
+        std::any_of(_indexes.begin(), _indexes.end(), [](const IndexToBuild& index) {
+            return !index.real->asSortedData();
+        })) {
+        numKeyGenerationThreads = 1;
+    }
+
+    std::unique_ptr<ThreadPool> keyGenerationPool;
+    ScopeGuard shutdownKeyGenerationPool([&] {
+        if (keyGenerationPool) {
+            keyGenerationPool->shutdown();
+            keyGenerationPool->join();
+        }
+    });
+    if (numKeyGenerationThreads > 1) {
+        keyGenerationPool = makeKeyGenerationPool(numKeyGenerationThreads - 1);
+    }
+
+    // Documents whose keys are to be generated on the key generation threads. The documents are
+    // owned, as they outlive the position of the collection scan.
+    std::vector<std::pair<BSONObj, RecordId>> batch;
+    size_t batchBytes = 0;
+    auto flushBatch = [&] {
+        uassertStatusOK(_insertBatch(
+            opCtx,
+            collection,
+            batch,
+            keyGenerationPool.get(),
+            numKeyGenerationThreads,
+            [&exec] { exec->saveState(); },
+            [&] { exec->restoreState(&collection); }));
+
+        for (const auto& [doc, recordId] : batch) {
+            _failPointHangDuringBuild(opCtx,
+                                      &hangIndexBuildDuringCollectionScanPhaseAfterInsertion,
+                                      "after",
+                                      doc,
+                                      (*progress)->hits())
+                .ignore();
+            progress->hit();
+        }
+
+        batch.clear();
+        batchBytes = 0;
+    };
+
     BSONObj objToIndex;
     RecordId loc;
     PlanExecutor::ExecState state;
@@ -623,6 +740,24 @@ void MultiIndexBlock::_doCollectionScan(OperationContext* opCtx,
 
         progress->get()->setTotalWhileRunning(collection->numRecords(opCtx));
 
+        if (keyGenerationPool) {
+            uassertStatusOK(
+                _failPointHangDuringBuild(opCtx,
+                                          &hangIndexBuildDuringCollectionScanPhaseBeforeInsertion,
+                                          "before",
+                                          objToIndex,
+                                          (*progress)->hits() + batch.size()));
+
+            batchBytes += objToIndex.objsize();
+            batch.emplace_back(objToIndex.getOwned(), std::move(loc));
+            loc = RecordId();
+            if (batchBytes >= getKeyGenerationBatchMaxBytes() ||
+                batch.size() >= kKeyGenerationBatchMaxDocs) {
+                flushBatch();
+            }
+            continue;
+        }
+
         uassertStatusOK(
             _failPointHangDuringBuild(opCtx,
                                       &hangIndexBuildDuringCollectionScanPhaseBeforeInsertion,
@@ -664,6 +799,10 @@ void MultiIndexBlock::_doCollectionScan(OperationContext* opCtx,
         // Go to the next document.
         progress->hit();
     }
+
+    if (!batch.empty()) {
+        flushBatch();
+    }
 }
 
 Status MultiIndexBlock::insertSingleDocumentForInitialSyncOrRecovery(
@@ -685,32 +824,10 @@ Status MultiIndexBlock::_insert(OperationContext* opCtx,
     invariant(!_buildIsCleanedUp);
 
     // The detection of mixed-schema data needs to be done before applying the partial filter
-    // expression below. Only check for mixed-schema data if it's possible for the time-series
-    // collection to have it.
-    if (_containsIndexBuildOnTimeseriesMeasurement &&
-        *collection->getTimeseriesBucketsMayHaveMixedSchemaData()) {
-        bool docHasMixedSchemaData =
-            collection->doesTimeseriesBucketsDocContainMixedSchemaData(doc);
-
-        if (docHasMixedSchemaData) {
-            LOGV2(6057700,
-                  "Detected mixed-schema data in time-series bucket collection",
-                  logAttrs(collection->ns()),
-                  logAttrs(collection->uuid()),
-                  "recordId"_attr = loc,
-                  "control"_attr = redact(doc.getObjectField(timeseries::kBucketControlFieldName)));
-
-            _timeseriesBucketContainsMixedSchemaData = true;
-        }
-
-        // Only enforce the mixed-schema data constraint on the primary. Index builds may not fail
-        // on the secondaries. The primary will replicate an abortIndexBuild oplog entry.
-        auto replCoord = repl::ReplicationCoordinator::get(opCtx);
-        const bool replSetAndNotPrimary = !replCoord->canAcceptWritesFor(opCtx, collection->ns());
-
-        if (docHasMixedSchemaData && !replSetAndNotPrimary) {
-            return timeseriesMixedSchemaDataFailure(collection.get());
-        }
+    // expression below.
+    if (auto status = _checkTimeseriesMixedSchemaData(opCtx, collection, doc, loc);
+        !status.isOK()) {
+        return status;
     }
 
     for (size_t i = 0; i < _indexes.size(); i++) {
@@ -744,6 +861,172 @@ Status MultiIndexBlock::_insert(OperationContext* opCtx,
     return Status::OK();
 }
 
+Status MultiIndexBlock::_insertBatch(OperationContext* opCtx,
+                                     const CollectionPtr& collection,
+                                     const std::vector<std::pair<BSONObj, RecordId>>& batch,
+                                     ThreadPool* keyGenerationPool,
+                                     size_t numKeyGenerationThreads,
+                                     const std::function<void()>& saveCursorBeforeWrite,
+                                     const std::function<void()>& restoreCursorAfterWrite) {
+    invariant(!_buildIsCleanedUp);
+
+    // The keys of document 'd' for index 'i' are at generatedKeys[d * _indexes.size() + i].
+    std::vector<GeneratedKeys> generatedKeys(batch.size() * _indexes.size());
+
+    // Generates the keys of the documents in the range [begin, end) of the batch. Stops at the
+    // first error, which is reported for the document that caused it. The collection is not
+    // yielded while keys are being generated, so 'collection' remains valid on all threads.
+    auto generateKeys = [&](OperationContext* keyGenOpCtx, size_t begin, size_t end) {
+        SharedBufferFragmentBuilder pooledBuilder(
+            KeyString::HeapBuilder::kHeapAllocatorDefaultBytes);
+        for (size_t d = begin; d < end; ++d) {
+            const auto& [doc, loc] = batch[d];
+            for (size_t i = 0; i < _indexes.size(); ++i) {
+                auto& generated = generatedKeys[d * _indexes.size() + i];
+                try {
+                    if (_indexes[i].filterExpression &&
+                        !_indexes[i].filterExpression->matchesBSON(doc)) {
+                        continue;
+                    }
+
+                    generated.indexed = true;
+                    _indexes[i].real->asSortedData()->getKeys(
+                        keyGenOpCtx,
+                        collection,
+                        pooledBuilder,
+                        doc,
+                        _indexes[i].options.getKeysMode,
+                        SortedDataIndexAccessMethod::GetKeysContext::kAddingKeys,
+                        &generated.keys,
+                        &generated.multikeyMetadataKeys,
+                        &generated.multikeyPaths,
+                        loc,
+                        [&](Status status, const BSONObj&, boost::optional<RecordId>) {
+                            generated.suppressedError = std::move(status);
+                        });
+                } catch (...) {
+                    generated.status = exceptionToStatus();
+                    return;
+                }
+            }
+        }
+    };
+
+    // Split the batch into contiguous ranges of RecordIds, one per thread. The calling thread
+    // generates the keys of the first range itself.
+    const size_t numThreads = std::max<size_t>(1, std::min(numKeyGenerationThreads, batch.size()));
+    const size_t docsPerThread = (batch.size() + numThreads - 1) / numThreads;
+    std::vector<Future<void>> workers;
+    for (size_t begin = docsPerThread; begin < batch.size(); begin += docsPerThread) {
+        const size_t end = std::min(begin + docsPerThread, batch.size());
+        auto pf = makePromiseFuture<void>();
+        keyGenerationPool->schedule(
+            [&, begin, end, promise = std::move(pf.promise)](Status status) mutable {
+                if (status.isOK()) {
+                    auto keyGenOpCtx = cc().makeOperationContext();
+                    generateKeys(keyGenOpCtx.get(), begin, end);
+                } else {
+                    generatedKeys[begin * _indexes.size()].status = status;
+                }
+                promise.emplaceValue();
+            });
+        workers.push_back(std::move(pf.future));
+    }
+    generateKeys(opCtx, 0, std::min(docsPerThread, batch.size()));
+
+    // The other threads refer to the batch, so they must all finish even if this operation is
+    // interrupted meanwhile.
+    for (auto& worker : workers) {
+        worker.get();
+    }
+
+    for (size_t d = 0; d < batch.size(); ++d) {
+        const auto& [doc, loc] = batch[d];
+
+        if (auto status = _checkTimeseriesMixedSchemaData(opCtx, collection, doc, loc);
+            !status.isOK()) {
+            return status;
+        }
+
+        for (size_t i = 0; i < _indexes.size(); ++i) {
+            auto& generated = generatedKeys[d * _indexes.size() + i];
+            if (!generated.status.isOK()) {
+                return generated.status;
+            }
+            if (!generated.indexed) {
+                continue;
+            }
+
+            try {
+                if (generated.suppressedError) {
+                    // Record the document as "skipped" so the index builder can retry at a point
+                    // when data is consistent, as the bulk builder does for keys it generates.
+                    auto interceptor =
+                        _indexes[i].block->getEntry(opCtx, collection)->indexBuildInterceptor();
+                    if (interceptor && interceptor->getSkippedRecordTracker()) {
+                        LOGV2_DEBUG(7086780,
+                                    1,
+                                    "Recording suppressed key generation error to retry later",
+                                    "error"_attr = *generated.suppressedError,
+                                    "loc"_attr = loc,
+                                    "obj"_attr = redact(doc));
+
+                        // Save and restore the cursor around the write in case it throws a WCE
+                        // internally and causes the cursor to be unpositioned.
+                        saveCursorBeforeWrite();
+                        interceptor->getSkippedRecordTracker()->record(opCtx, loc);
+                        restoreCursorAfterWrite();
+                    }
+                }
+
+                // Inserting into the bulk builder may spill its sorter to disk, which may throw.
+                _indexes[i].bulk->insertKeys(
+                    generated.keys, generated.multikeyMetadataKeys, generated.multikeyPaths);
+            } catch (...) {
+                return exceptionToStatus();
+            }
+        }
+
+        _lastRecordIdInserted = loc;
+    }
+
+    return Status::OK();
+}
+
+Status MultiIndexBlock::_checkTimeseriesMixedSchemaData(OperationContext* opCtx,
+                                                        const CollectionPtr& collection,
+                                                        const BSONObj& doc,
+                                                        const RecordId& loc) {
+    // Only check for mixed-schema data if it's possible for the time-series collection to have it.
+    if (_containsIndexBuildOnTimeseriesMeasurement &&
+        *collection->getTimeseriesBucketsMayHaveMixedSchemaData()) {
+        bool docHasMixedSchemaData =
+            collection->doesTimeseriesBucketsDocContainMixedSchemaData(doc);
+
+        if (docHasMixedSchemaData) {
+            LOGV2(6057700,
+                  "Detected mixed-schema data in time-series bucket collection",
+                  logAttrs(collection->ns()),
+                  logAttrs(collection->uuid()),
+                  "recordId"_attr = loc,
+                  "control"_attr = redact(doc.getObjectField(timeseries::kBucketControlFieldName)));
+
+            _timeseriesBucketContainsMixedSchemaData = true;
+        }
+
+        // Only enforce the mixed-schema data constraint on the primary. Index builds may not fail
+        // on the secondaries. The primary will replicate an abortIndexBuild oplog entry.
+        auto replCoord = repl::ReplicationCoordinator::get(opCtx);
+        const bool replSetAndNotPrimary = !replCoord->canAcceptWritesFor(opCtx, collection->ns());
+
+        if (docHasMixedSchemaData && !replSetAndNotPrimary) {
+            return timeseriesMixedSchemaDataFailure(collection.get());
+        }
+    }
+
+    return Status::OK();
+}
+
 Status MultiIndexBlock::dumpInsertsFromBulk(OperationContext* opCtx,
                                             const CollectionPtr& collection) {
     return dumpInsertsFromBulk(opCtx, collection, nullptr);
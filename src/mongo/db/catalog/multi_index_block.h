@@ -61,6 +61,7 @@ class MatchExpression;
 class NamespaceString;
 class OperationContext;
 class ProgressMeterHolder;
+class ThreadPool;
 
 /**
  * Builds one or more indexes.
@@ -338,6 +339,28 @@ private:
                    const std::function<void()>& saveCursorBeforeWrite,
                    const std::function<void()>& restoreCursorAfterWrite);
 
+    /**
+     * Inserts the index keys of a batch of documents, in order, as _insert() would for each of
+     * them. The keys are generated by splitting the batch into contiguous ranges, one per thread
+     * of 'keyGenerationPool' plus one on the calling thread.
+     */
+    Status _insertBatch(OperationContext* opCtx,
+                        const CollectionPtr& collection,
+                        const std::vector<std::pair<BSONObj, RecordId>>& batch,
+                        ThreadPool* keyGenerationPool,
+                        size_t numKeyGenerationThreads,
+                        const std::function<void()>& saveCursorBeforeWrite,
+                        const std::function<void()>& restoreCursorAfterWrite);
+
+    /**
+     * Checks whether 'doc' is a time-series bucket with mixed-schema data, if any of the indexes
+     * being built is on time-series measurements. Returns an error if the build must fail.
+     */
+    Status _checkTimeseriesMixedSchemaData(OperationContext* opCtx,
+                                           const CollectionPtr& collection,
+                                           const BSONObj& doc,
+                                           const RecordId& loc);
+
     /**
      * Performs a collection scan on the given collection and inserts the relevant index keys into
      * the external sorter.
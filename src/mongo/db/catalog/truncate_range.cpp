@@ -0,0 +1,110 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/catalog/truncate_range.h"
+
+#include "mongo/db/catalog/index_catalog.h"
+#include "mongo/db/op_observer.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/server_options.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/storage/storage_parameters_gen.h"
+#include "mongo/db/timeseries/bucket_catalog.h"
+
+namespace mongo {
+
+bool canTruncateRange(OperationContext* opCtx, const CollectionPtr& collection) {
+    if (!feature_flags::gClusteredRangeTruncate.isEnabled(
+            serverGlobalParams.featureCompatibility)) {
+        return false;
+    }
+
+    // Deleting a document also removes its secondary index keys, records its pre-image for change
+    // streams and lets chunk migrations observe the delete, none of which a truncate does.
+    return collection->isClustered() && !collection->isCapped() &&
+        collection->getIndexCatalog()->numIndexesTotal(opCtx) == 0 &&
+        !collection->isChangeStreamPreAndPostImagesEnabled() &&
+        !collection->getRecordPreImages() && !opCtx->inMultiDocumentTransaction() &&
+        serverGlobalParams.clusterRole == ClusterRole::None;
+}
+
+int64_t truncateRange(OperationContext* opCtx,
+                      const CollectionPtr& collection,
+                      const RecordId& minRecordId,
+                      const RecordId& maxRecordId,
+                      int64_t maxDocs,
+                      RecordId* lastRecordId) {
+    invariant(opCtx->lockState()->isCollectionLockedForMode(collection->ns(), MODE_IX));
+    invariant(opCtx->lockState()->inAWriteUnitOfWork());
+
+    auto recordStore = collection->getRecordStore();
+    const bool isTimeseriesBuckets = collection->ns().isTimeseriesBucketsCollection();
+
+    // The size information of the collection must be kept accurate, so the removed records are
+    // counted, which only takes a read of each of them.
+    int64_t docsDeleted = 0;
+    int64_t bytesDeleted = 0;
+    RecordId endRecordId = maxRecordId;
+    {
+        auto cursor = recordStore->getCursor(opCtx, true /* forward */);
+        auto record = cursor->seekNear(minRecordId);
+        if (record && record->id < minRecordId) {
+            record = cursor->next();
+        }
+        for (; record && record->id <= maxRecordId; record = cursor->next()) {
+            ++docsDeleted;
+            bytesDeleted += record->data.size();
+            if (isTimeseriesBuckets) {
+                // The bucket must not be reopened for inserts once it is removed.
+                BucketCatalog::get(opCtx).clear(record->data.toBson()["_id"].OID());
+            }
+            if (docsDeleted == maxDocs) {
+                endRecordId = record->id;
+                break;
+            }
+        }
+    }
+
+    if (docsDeleted == 0) {
+        return 0;
+    }
+
+    uassertStatusOK(
+        recordStore->rangeTruncate(opCtx, minRecordId, endRecordId, -bytesDeleted, -docsDeleted));
+    opCtx->getServiceContext()->getOpObserver()->onTruncateRange(
+        opCtx, collection, minRecordId, endRecordId, bytesDeleted, docsDeleted);
+    if (lastRecordId && docsDeleted == maxDocs) {
+        *lastRecordId = endRecordId;
+    }
+    return docsDeleted;
+}
+
+}  // namespace mongo
@@ -0,0 +1,64 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/db/catalog/collection.h"
+#include "mongo/db/record_id.h"
+
+namespace mongo {
+
+class OperationContext;
+
+/**
+ * Returns true if the documents of 'collection' may be removed by RecordId range with
+ * truncateRange(). That is the case for clustered collections without secondary indexes, for
+ * which no work other than removing the records themselves is needed when documents are deleted.
+ */
+bool canTruncateRange(OperationContext* opCtx, const CollectionPtr& collection);
+
+/**
+ * Removes the documents with RecordIds in ['minRecordId', 'maxRecordId'] from 'collection' with
+ * a single storage-level truncate, and logs a single 'truncateRange' oplog entry for all of them.
+ * Returns the number of documents removed.
+ *
+ * If 'maxDocs' is positive, only the first 'maxDocs' documents of the range are removed, and the
+ * logged range ends at the last of them. When the limit is reached and 'lastRecordId' is not
+ * null, it is set to the RecordId of that last document.
+ *
+ * Must be called within a WriteUnitOfWork, with 'collection' locked in MODE_IX.
+ */
+int64_t truncateRange(OperationContext* opCtx,
+                      const CollectionPtr& collection,
+                      const RecordId& minRecordId,
+                      const RecordId& maxRecordId,
+                      int64_t maxDocs = 0,
+                      RecordId* lastRecordId = nullptr);
+
+}  // namespace mongo
@@ -0,0 +1,148 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/auth/authorization_session.h"
+#include "mongo/db/commands.h"
+#include "mongo/db/commands/analyze_cmd_gen.h"
+#include "mongo/db/catalog_raii.h"
+#include "mongo/db/concurrency/exception_util.h"
+#include "mongo/db/db_raii.h"
+#include "mongo/db/dbhelpers.h"
+#include "mongo/db/pipeline/field_path.h"
+#include "mongo/db/query/ce/collection_statistics.h"
+#include "mongo/db/query/internal_plans.h"
+#include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/db/repl/replication_coordinator.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * Builds a histogram of the values at a path of a collection and persists it for the Cascades
+ * optimizer to use in cardinality estimation.
+ *
+ * {
+ *     analyze: <collection>,
+ *     key: <dotted path>,
+ *     numberOfBuckets: <int>,
+ * }
+ */
+class AnalyzeCmd final : public TypedCommand<AnalyzeCmd> {
+public:
+    using Request = AnalyzeCommandRequest;
+
+    std::string help() const override {
+        return "Builds and persists the query optimizer statistics for a path of a collection. "
+               "Usage: {analyze: <collection>, key: <dotted path>, numberOfBuckets: <int>}";
+    }
+
+    bool adminOnly() const override {
+        return false;
+    }
+
+    AllowedOnSecondary secondaryAllowed(ServiceContext*) const override {
+        return AllowedOnSecondary::kNever;
+    }
+
+    class Invocation final : public InvocationBase {
+    public:
+        using InvocationBase::InvocationBase;
+
+        void typedRun(OperationContext* opCtx) {
+            const auto& nss = request().getNamespace();
+            // Throws if the key is not a valid field path.
+            const FieldPath keyPath(request().getKey());
+            const auto& key = keyPath.fullPath();
+
+            uassert(ErrorCodes::IllegalOperation,
+                    "Cannot analyze a system collection",
+                    !nss.isSystem());
+
+            ce::HistogramBuilder builder(
+                key,
+                request().getNumberOfBuckets().value_or(
+                    internalQueryAnalyzeNumberOfBuckets.load()),
+                static_cast<size_t>(internalQueryAnalyzeMaxSampleSize.load()));
+            {
+                AutoGetCollectionForReadCommand collection(opCtx, nss);
+                uassert(ErrorCodes::NamespaceNotFound,
+                        str::stream() << "Collection " << nss << " does not exist",
+                        collection);
+
+                auto exec = InternalPlanner::collectionScan(
+                    opCtx, &collection.getCollection(), PlanYieldPolicy::YieldPolicy::YIELD_AUTO);
+                BSONObj doc;
+                while (exec->getNext(&doc, nullptr) == PlanExecutor::ADVANCED) {
+                    builder.addDocument(doc);
+                }
+            }
+
+            const auto histogram = builder.build();
+
+            // Clients may not write to system collections, so persist the statistics with an
+            // internal write, which also creates the statistics collection if needed.
+            const auto statsNss = nss.makeStatisticsNamespace();
+            AutoGetCollection statsColl(opCtx, statsNss, MODE_IX);
+            uassert(ErrorCodes::NotWritablePrimary,
+                    str::stream() << "Not primary while writing the statistics of " << nss,
+                    repl::ReplicationCoordinator::get(opCtx)->canAcceptWritesFor(opCtx, statsNss));
+            writeConflictRetry(opCtx, "analyze", statsNss.ns(), [&] {
+                Helpers::upsert(opCtx,
+                                statsNss.ns(),
+                                BSON(ce::CollectionStatistics::kPathField << key),
+                                ce::CollectionStatistics::makeStatisticsDocument(key, histogram));
+            });
+        }
+
+    private:
+        NamespaceString ns() const override {
+            return request().getNamespace();
+        }
+
+        bool supportsWriteConcern() const override {
+            return false;
+        }
+
+        void doCheckAuthorization(OperationContext* opCtx) const override {
+            uassert(ErrorCodes::Unauthorized,
+                    "Unauthorized",
+                    AuthorizationSession::get(opCtx->getClient())
+                        ->isAuthorizedForActionsOnResource(
+                            ResourcePattern::forExactNamespace(request().getNamespace()),
+                            ActionType::analyze));
+        }
+    };
+
+} analyzeCmd;
+
+}  // namespace
+}  // namespace mongo
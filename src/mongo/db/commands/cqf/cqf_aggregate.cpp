@@ -32,6 +32,7 @@
 #include "mongo/db/exec/sbe/abt/abt_lower.h"
 #include "mongo/db/pipeline/abt/abt_document_source_visitor.h"
 #include "mongo/db/pipeline/abt/match_expression_visitor.h"
+#include "mongo/db/query/ce/ce_histogram.h"
 #include "mongo/db/query/ce/ce_sampling.h"
 #include "mongo/db/query/optimizer/cascades/ce_heuristic.h"
 #include "mongo/db/query/optimizer/cascades/cost_derivation.h"
@@ -451,6 +452,25 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> getSBEExecutorViaCascadesOp
     std::cerr << ExplainGenerator::explainV2(abtTree) << std::endl;
     std::cerr << "******* Translated ABT **********\n";
 
+    if (collectionExists && internalQueryEnableHistogramCardinalityEstimator.load()) {
+        // Prefer the persisted histograms when the collection has been analyzed.
+        auto stats = ce::CollectionStatistics::get(opCtx, nss);
+        if (!stats->empty()) {
+            OptPhaseManager phaseManager{
+                OptPhaseManager::getAllRewritesSet(),
+                prefixId,
+                false /*requireRID*/,
+                std::move(metadata),
+                std::make_unique<HistogramCE>(scanDefName, std::move(stats)),
+                std::make_unique<DefaultCosting>(),
+                DebugInfo::kDefaultForProd};
+            phaseManager.getHints() = queryHints;
+
+            return optimizeAndCreateExecutor(
+                phaseManager, std::move(abtTree), opCtx, expCtx, nss, collection);
+        }
+    }
+
     if (collectionExists && numRecords > 0 &&
         internalQueryEnableSamplingCardinalityEstimator.load()) {
         Metadata metadataForSampling = metadata;
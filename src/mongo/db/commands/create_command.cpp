@@ -331,6 +331,13 @@ public:
                         !cmd.getChangeStreamPreAndPostImages().has_value());
             }
 
+            uassert(ErrorCodes::InvalidOptions,
+                    "The 'cacheResident' option is not supported in the current feature "
+                    "compatibility version",
+                    !cmd.getCacheResident().get_value_or(false) ||
+                        feature_flags::gCacheResident.isEnabled(
+                            serverGlobalParams.featureCompatibility));
+
             OperationShardingState::ScopedAllowImplicitCollectionCreate_UNSAFE
                 unsafeCreateCollection(opCtx);
             uassertStatusOK(createCollection(opCtx, cmd.getNamespace(), cmd));
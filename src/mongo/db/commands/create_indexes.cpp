@@ -63,7 +63,9 @@
 #include "mongo/db/s/database_sharding_state.h"
 #include "mongo/db/s/operation_sharding_state.h"
 #include "mongo/db/s/sharding_state.h"
+#include "mongo/db/server_options.h"
 #include "mongo/db/session_catalog_mongod.h"
+#include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/db/storage/two_phase_index_build_knobs_gen.h"
 #include "mongo/db/timeseries/catalog_helper.h"
 #include "mongo/db/timeseries/timeseries_commands_conversion_helper.h"
@@ -124,6 +126,13 @@ std::vector<BSONObj> parseAndValidateIndexSpecs(OperationContext* opCtx,
             str::stream() << "Error in specification " << parsedIndexSpec.toString()));
 
         auto indexSpec = indexSpecStatus.getValue();
+        uassert(ErrorCodes::InvalidOptions,
+                "The 'cacheResident' index option is not supported in the current feature "
+                "compatibility version",
+                !indexSpec[IndexDescriptor::kCacheResidentFieldName].trueValue() ||
+                    feature_flags::gCacheResident.isEnabled(
+                        serverGlobalParams.featureCompatibility));
+
         if (IndexDescriptor::isIdIndexPattern(
                 indexSpec[IndexDescriptor::kKeyPatternFieldName].Obj())) {
             uassertStatusOK(index_key_validate::validateIdIndexSpec(indexSpec));
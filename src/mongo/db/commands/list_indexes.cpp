@@ -72,6 +72,7 @@ static std::set<StringData> allowedFieldNames = {
     ListIndexesReplyItem::kBitsFieldName,
     ListIndexesReplyItem::kBucketSizeFieldName,
     ListIndexesReplyItem::kBuildUUIDFieldName,
+    ListIndexesReplyItem::kCacheResidentFieldName,
     ListIndexesReplyItem::kClusteredFieldName,
     ListIndexesReplyItem::kCoarsestIndexedLevelFieldName,
     ListIndexesReplyItem::kCollationFieldName,
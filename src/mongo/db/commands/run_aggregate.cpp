@@ -448,6 +448,7 @@ boost::intrusive_ptr<ExpressionContext> makeExpressionContext(
     expCtx->collationMatchesDefault = collationMatchesDefault;
     expCtx->forPerShardCursor = request.getPassthroughToShard().has_value();
     expCtx->allowDiskUse = request.getAllowDiskUse().value_or(allowDiskUseByDefault.load());
+    expCtx->maxDegreeOfParallelism = request.getMaxDegreeOfParallelism();
     if (opCtx->readOnly()) {
         // Disallow disk use if in read-only mode.
         expCtx->allowDiskUse = false;
@@ -80,6 +80,7 @@
 #include "mongo/db/serverless/shard_split_donor_service.h"
 #include "mongo/db/session_catalog.h"
 #include "mongo/db/session_txn_record_gen.h"
+#include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/db/timeseries/timeseries_index_schema_conversion_functions.h"
 #include "mongo/db/vector_clock.h"
 #include "mongo/idl/cluster_server_parameter_gen.h"
@@ -632,6 +633,35 @@ private:
                         return true;
                     });
             }
+
+            // Block downgrade for collections or indexes that are cache resident, since the
+            // downgraded binary does not know the option.
+            if (!feature_flags::gCacheResident.isEnabledOnVersion(requestedVersion)) {
+                for (const auto& dbName : DatabaseHolder::get(opCtx)->getNames()) {
+                    Lock::DBLock dbLock(opCtx, dbName.db(), MODE_IX);
+                    catalog::forEachCollectionFromDb(
+                        opCtx, dbName, MODE_S, [&](const CollectionPtr& collection) {
+                            uassert(ErrorCodes::CannotDowngrade,
+                                    str::stream() << "Cannot downgrade the cluster as collection "
+                                                  << collection->ns() << " has 'cacheResident'",
+                                    !collection->getCollectionOptions().cacheResident);
+                            auto ii = collection->getIndexCatalog()->getIndexIterator(
+                                opCtx,
+                                IndexCatalog::InclusionPolicy::kReady |
+                                    IndexCatalog::InclusionPolicy::kUnfinished);
+                            while (ii->more()) {
+                                const auto desc = ii->next()->descriptor();
+                                uassert(ErrorCodes::CannotDowngrade,
+                                        str::stream()
+                                            << "Cannot downgrade the cluster as index "
+                                            << desc->indexName() << " on collection "
+                                            << collection->ns() << " has 'cacheResident'",
+                                        !desc->cacheResident());
+                            }
+                            return true;
+                        });
+                }
+            }
         }
 
         {
@@ -67,12 +67,14 @@ CachedPlanStage::CachedPlanStage(ExpressionContext* expCtx,
                                  CanonicalQuery* cq,
                                  const QueryPlannerParams& params,
                                  size_t decisionWorks,
+                                 size_t decisionResults,
                                  std::unique_ptr<PlanStage> root)
     : RequiresAllIndicesStage(kStageType, expCtx, collection),
       _ws(ws),
       _canonicalQuery(cq),
       _plannerParams(params),
-      _decisionWorks(decisionWorks) {
+      _decisionWorks(decisionWorks),
+      _decisionResults(decisionResults) {
     _children.emplace_back(std::move(root));
 }
 
@@ -161,6 +163,33 @@ Status CachedPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
         } else {
             invariant(PlanStage::NEED_TIME == state);
         }
+
+        // If the plan produces far fewer results than it did when it was cached, e.g. because the
+        // data it is run against is skewed, don't wait for it to exhaust 'maxWorksBeforeReplan'.
+        const size_t works = i + 1;
+        if (trial_period::hasCardinalityDiverged(
+                works, _results.size(), _decisionWorks, _decisionResults)) {
+            auto explainer = plan_explainer_factory::make(child().get());
+            LOGV2_DEBUG(7086770,
+                        1,
+                        "Evicting cache entry and replanning query as the cached plan produced "
+                        "fewer results than expected",
+                        "works"_attr = works,
+                        "numResults"_attr = _results.size(),
+                        "decisionWorks"_attr = _decisionWorks,
+                        "decisionResults"_attr = _decisionResults,
+                        "query"_attr = redact(_canonicalQuery->toStringShort()),
+                        "planSummary"_attr = explainer->getPlanSummary());
+
+            const bool shouldCache = true;
+            return replan(yieldPolicy,
+                          shouldCache,
+                          str::stream() << "cached plan was less efficient than expected: expected "
+                                        << "trial execution to produce " << _decisionResults
+                                        << " results in " << _decisionWorks
+                                        << " works but it produced " << _results.size()
+                                        << " results in " << works << " works");
+        }
     }
 
     // If we're here, the trial period took more than 'maxWorksBeforeReplan' work cycles. This
@@ -199,14 +228,24 @@ Status CachedPlanStage::tryYield(PlanYieldPolicy* yieldPolicy) {
 }
 
 Status CachedPlanStage::replan(PlanYieldPolicy* yieldPolicy, bool shouldCache, std::string reason) {
-    // We're going to start over with a new plan. Clear out info from our old plan.
-    {
-        std::queue<WorkingSetID> emptyQueue;
-        _results.swap(emptyQueue);
+    // We're going to start over with a new plan. Clear out info from our old plan, but keep the
+    // results it has produced so far if they can be returned ahead of those of the new plan.
+    std::vector<WorkingSetMember> trialResults;
+    const bool reuseTrialResults = canReuseTrialResults();
+    while (!_results.empty()) {
+        if (reuseTrialResults) {
+            trialResults.push_back(_ws->extract(_results.front()));
+        }
+        _results.pop();
     }
     _ws->clear();
     _children.clear();
 
+    for (auto&& member : trialResults) {
+        _trialResultRecordIds.insert(member.recordId);
+        _results.push(_ws->emplace(std::move(member)));
+    }
+
     _specificStats.replanReason = std::move(reason);
 
     if (shouldCache) {
@@ -278,6 +317,27 @@ Status CachedPlanStage::replan(PlanYieldPolicy* yieldPolicy, bool shouldCache, s
     return Status::OK();
 }
 
+bool CachedPlanStage::canReuseTrialResults() const {
+    if (!internalQueryCacheEnableAdaptiveReplanning.load()) {
+        return false;
+    }
+
+    const auto& findCommand = _canonicalQuery->getFindCommandRequest();
+    if (_canonicalQuery->getProj() || !findCommand.getSort().isEmpty() || findCommand.getSkip() ||
+        findCommand.getLimit() || (_plannerParams.options & QueryPlannerParams::IS_COUNT)) {
+        return false;
+    }
+
+    // Every buffered result must be identified by its RecordId, so that the new plan can skip it.
+    auto results = _results;
+    for (; !results.empty(); results.pop()) {
+        if (!_ws->get(results.front())->hasRecordId()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool CachedPlanStage::isEOF() {
     return _results.empty() && child()->isEOF();
 }
@@ -295,7 +355,17 @@ PlanStage::StageState CachedPlanStage::doWork(WorkingSetID* out) {
     }
 
     // Nothing left in trial period buffer.
-    return child()->work(out);
+    auto state = child()->work(out);
+    if (PlanStage::ADVANCED == state && !_trialResultRecordIds.empty()) {
+        // Results of the replanned query which were already returned from the trial period
+        // buffer are dropped.
+        auto member = _ws->get(*out);
+        if (member->hasRecordId() && _trialResultRecordIds.count(member->recordId)) {
+            _ws->free(*out);
+            return PlanStage::NEED_TIME;
+        }
+    }
+    return state;
 }
 
 std::unique_ptr<PlanStageStats> CachedPlanStage::getStats() {
@@ -39,6 +39,7 @@
 #include "mongo/db/query/query_planner_params.h"
 #include "mongo/db/query/query_solution.h"
 #include "mongo/db/record_id.h"
+#include "mongo/stdx/unordered_set.h"
 
 namespace mongo {
 
@@ -62,6 +63,7 @@ public:
                     CanonicalQuery* cq,
                     const QueryPlannerParams& params,
                     size_t decisionWorks,
+                    size_t decisionResults,
                     std::unique_ptr<PlanStage> root);
 
     bool isEOF() final;
@@ -104,6 +106,14 @@ private:
      */
     Status replan(PlanYieldPolicy* yieldPolicy, bool shouldCache, std::string reason);
 
+    /**
+     * Returns true if the results buffered during the trial period can be returned to the caller
+     * even though the query is replanned, in which case the documents they were produced from are
+     * skipped when the new plan produces them again. This is only possible if the query returns
+     * whole documents in no particular order, and is not subject to a skip or a limit.
+     */
+    bool canReuseTrialResults() const;
+
     /**
      * May yield during the cached plan stage's trial period or replanning phases.
      *
@@ -125,6 +135,9 @@ private:
     // cached.
     size_t _decisionWorks;
 
+    // The number of results the plan produced within '_decisionWorks' when it was first cached.
+    size_t _decisionResults;
+
     // If we fall back to re-planning the query, and there is just one resulting query solution,
     // that solution is owned here.
     std::unique_ptr<QuerySolution> _replannedQs;
@@ -132,6 +145,10 @@ private:
     // Any results produced during trial period execution are kept here.
     std::queue<WorkingSetID> _results;
 
+    // The RecordIds of the trial period results which were kept across replanning. The replanned
+    // plan's results with one of these RecordIds are discarded, as they have already been returned.
+    stdx::unordered_set<RecordId, RecordId::Hasher> _trialResultRecordIds;
+
     // Stats
     CachedPlanStats _specificStats;
 
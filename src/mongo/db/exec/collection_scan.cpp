@@ -40,6 +40,7 @@
 #include "mongo/db/exec/scoped_timer.h"
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/exec/working_set_common.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/record_id_helpers.h"
 #include "mongo/db/repl/optime.h"
 #include "mongo/logv2/log.h"
@@ -59,6 +60,15 @@ const char* getStageName(const CollectionPtr& coll, const CollectionScanParams&
     return (!coll->ns().isOplog() && (params.minRecord || params.maxRecord)) ? "CLUSTERED_IXSCAN"
                                                                              : "COLLSCAN";
 }
+
+size_t getRecordBatchSize(const CollectionPtr& coll, const CollectionScanParams& params) {
+    // Reading ahead is only done where the exact position of the cursor does not matter: capped
+    // collections and the oplog can lose records behind the cursor, and tailable scans park at EOF.
+    if (params.tailable || coll->isCapped() || coll->ns().isOplogOrChangeCollection()) {
+        return 0;
+    }
+    return static_cast<size_t>(internalQueryCollectionScanRecordBatchSize.load());
+}
 }  // namespace
 
 
@@ -70,6 +80,7 @@ CollectionScan::CollectionScan(ExpressionContext* expCtx,
     : RequiresCollectionStage(getStageName(collection, params), expCtx, collection),
       _workingSet(workingSet),
       _filter((filter && !filter->isTriviallyTrue()) ? filter : nullptr),
+      _recordBatchSize(getRecordBatchSize(collection, params)),
       _params(params) {
     // Explain reports the direction of the collection scan.
     _specificStats.direction = params.direction;
@@ -214,7 +225,7 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
         }
 
         if (!record) {
-            record = _cursor->next();
+            record = nextRecord();
         }
     } catch (const WriteConflictException&) {
         // Leave us in a state to try again next time.
@@ -246,12 +257,29 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
     WorkingSetID id = _workingSet->allocate();
     WorkingSetMember* member = _workingSet->get(id);
     member->recordId = std::move(record->id);
-    member->resetDocument(opCtx()->recoveryUnit()->getSnapshotId(), record->data.releaseToBson());
+    member->resetDocument(_recordBatch.empty() ? opCtx()->recoveryUnit()->getSnapshotId()
+                                               : _recordBatchSnapshotId,
+                          record->data.releaseToBson());
     _workingSet->transitionToRecordIdAndObj(id);
 
     return returnIfMatches(member, id, out);
 }
 
+boost::optional<Record> CollectionScan::nextRecord() {
+    if (_recordBatchSize == 0) {
+        return _cursor->next();
+    }
+
+    if (_recordBatchPos == _recordBatch.size()) {
+        _recordBatchPos = 0;
+        _recordBatchSnapshotId = opCtx()->recoveryUnit()->getSnapshotId();
+        if (_cursor->nextBatch(_recordBatchSize, &_recordBatch) == 0) {
+            return boost::none;
+        }
+    }
+    return _recordBatch[_recordBatchPos++];
+}
+
 void CollectionScan::setLatestOplogEntryTimestamp(const Record& record) {
     auto tsElem = record.data.toBson()[repl::OpTime::kTimestampFieldName];
     uassert(ErrorCodes::Error(4382100),
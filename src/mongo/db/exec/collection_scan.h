@@ -119,6 +119,12 @@ private:
      */
     void assertTsHasNotFallenOff(const Record& record);
 
+    /**
+     * Returns the next record from '_cursor', reading records in batches of
+     * '_recordBatchSize' if it is non-zero, or boost::none at EOF.
+     */
+    boost::optional<Record> nextRecord();
+
     // WorkingSet is not owned by us.
     WorkingSet* _workingSet;
 
@@ -127,6 +133,14 @@ private:
 
     std::unique_ptr<SeekableRecordCursor> _cursor;
 
+    // The number of records to read from '_cursor' at a time, or zero to read them one by one. The
+    // records read ahead are buffered in '_recordBatch', from position '_recordBatchPos' on, along
+    // with the id of the snapshot they were read from.
+    const size_t _recordBatchSize;
+    RecordBatch _recordBatch;
+    size_t _recordBatchPos = 0;
+    SnapshotId _recordBatchSnapshotId;
+
     CollectionScanParams _params;
 
     RecordId _lastSeenId;  // Null if nothing has been returned from _cursor yet.
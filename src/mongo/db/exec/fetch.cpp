@@ -31,12 +31,14 @@
 
 #include "mongo/db/exec/fetch.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/exec/filter.h"
 #include "mongo/db/exec/scoped_timer.h"
 #include "mongo/db/exec/working_set_common.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/str.h"
@@ -46,6 +48,29 @@ namespace mongo {
 using std::unique_ptr;
 using std::vector;
 
+namespace {
+/**
+ * Returns the record with the given id from 'batch', whose records are sorted by RecordId, or
+ * boost::none if there is no such record.
+ */
+boost::optional<Record> findRecord(const RecordBatch& batch, const RecordId& id) {
+    size_t low = 0;
+    size_t high = batch.size();
+    while (low < high) {
+        const size_t mid = low + (high - low) / 2;
+        if (batch[mid].id < id) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low < batch.size() && batch[low].id == id) {
+        return batch[low];
+    }
+    return boost::none;
+}
+}  // namespace
+
 // static
 const char* FetchStage::kStageType = "FETCH";
 
@@ -57,7 +82,8 @@ FetchStage::FetchStage(ExpressionContext* expCtx,
     : RequiresCollectionStage(kStageType, expCtx, collection),
       _ws(ws),
       _filter((filter && !filter->isTriviallyTrue()) ? filter : nullptr),
-      _idRetrying(WorkingSet::INVALID_ID) {
+      _idRetrying(WorkingSet::INVALID_ID),
+      _batchSize(internalQueryFetchBatchSize.load()) {
     _children.emplace_back(std::move(child));
 }
 
@@ -69,6 +95,10 @@ bool FetchStage::isEOF() {
         return false;
     }
 
+    if (!_pending.empty()) {
+        return false;
+    }
+
     return child()->isEOF();
 }
 
@@ -77,6 +107,10 @@ PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
         return PlanStage::IS_EOF;
     }
 
+    if (_batchSize > 0) {
+        return doWorkBatched(out);
+    }
+
     // Either retry the last WSM we worked on or get a new one from our child.
     WorkingSetID id;
     StageState status;
@@ -126,6 +160,91 @@ PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
     return status;
 }
 
+PlanStage::StageState FetchStage::doWorkBatched(WorkingSetID* out) {
+    // Buffer the members returned by our child until the batch is full or the child is exhausted.
+    // Members that already have a document are buffered too, so that the child's order is kept.
+    if (!_batchFetched && _pending.size() < _batchSize && !child()->isEOF()) {
+        WorkingSetID id;
+        StageState status = child()->work(&id);
+        if (PlanStage::ADVANCED == status) {
+            WorkingSetMember* member = _ws->get(id);
+            if (member->hasObj()) {
+                // The document may be freed if we yield while the member is buffered.
+                member->makeObjOwnedIfNeeded();
+            } else {
+                verify(WorkingSetMember::RID_AND_IDX == member->getState());
+                verify(member->hasRecordId());
+            }
+            _pending.push_back(id);
+            return NEED_TIME;
+        } else if (PlanStage::NEED_YIELD == status) {
+            *out = id;
+        }
+
+        if (PlanStage::IS_EOF != status) {
+            return status;
+        }
+    }
+
+    if (_pending.empty()) {
+        return IS_EOF;
+    }
+
+    if (!_batchFetched) {
+        try {
+            fetchBatch();
+        } catch (const WriteConflictException&) {
+            // The buffered members are left untouched, so the whole batch is looked up again.
+            *out = WorkingSet::INVALID_ID;
+            return NEED_YIELD;
+        }
+    }
+
+    WorkingSetID id = _pending.front();
+    _pending.pop_front();
+    if (_pending.empty()) {
+        _batchFetched = false;
+    }
+
+    WorkingSetMember* member = _ws->get(id);
+    if (member->hasObj()) {
+        ++_specificStats.alreadyHasObj;
+    } else {
+        // The record stays in '_batch' until the next batch is fetched, which outlives the member's
+        // unowned document in the same way a storage cursor's current record would.
+        auto record = findRecord(_batch, member->recordId);
+        const auto& coll = collection();
+        if (!WorkingSetCommon::fetch(
+                opCtx(), _ws, id, record.get_ptr(), _batchSnapshotId, coll, coll->ns())) {
+            _ws->free(id);
+            return NEED_TIME;
+        }
+    }
+
+    return returnIfMatches(member, id, out);
+}
+
+void FetchStage::fetchBatch() {
+    std::vector<RecordId> ids;
+    ids.reserve(_pending.size());
+    for (auto id : _pending) {
+        WorkingSetMember* member = _ws->get(id);
+        if (!member->hasObj()) {
+            ids.push_back(member->recordId);
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+    const auto& coll = collection();
+    if (!_cursor)
+        _cursor = coll->getCursor(opCtx());
+
+    _cursor->seekExactMany(ids, &_batch);
+    _batchSnapshotId = opCtx()->recoveryUnit()->getSnapshotId();
+    _batchFetched = true;
+}
+
 void FetchStage::doSaveStateRequiresCollection() {
     if (_cursor) {
         _cursor->saveUnpositioned();
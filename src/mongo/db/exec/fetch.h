@@ -29,23 +29,27 @@
 
 #pragma once
 
+#include <deque>
 #include <memory>
 
 #include "mongo/db/exec/requires_collection_stage.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/matcher/expression.h"
 #include "mongo/db/record_id.h"
+#include "mongo/db/storage/record_store.h"
 
 namespace mongo {
 
-class SeekableRecordCursor;
-
 /**
  * This stage turns a RecordId into a BSONObj.
  *
  * In WorkingSetMember terms, it transitions from RID_AND_IDX to RID_AND_OBJ by reading
  * the record at the provided RecordId.  Returns verbatim any data that already has an object.
  *
+ * If 'internalQueryFetchBatchSize' is non-zero, the stage buffers up to that many members from its
+ * child, then looks up their documents together in RecordId order, and returns the members in the
+ * order its child returned them.
+ *
  * Preconditions: Valid RecordId.
  */
 class FetchStage : public RequiresCollectionStage {
@@ -86,6 +90,17 @@ private:
      */
     StageState returnIfMatches(WorkingSetMember* member, WorkingSetID memberID, WorkingSetID* out);
 
+    /**
+     * Implements doWork() when the stage fetches documents in batches of '_batchSize'.
+     */
+    StageState doWorkBatched(WorkingSetID* out);
+
+    /**
+     * Looks up the documents of all members in '_pending' that don't yet have one, filling
+     * '_batch'. May throw WriteConflictException.
+     */
+    void fetchBatch();
+
     // Used to fetch Records from _collection.
     std::unique_ptr<SeekableRecordCursor> _cursor;
 
@@ -98,6 +113,21 @@ private:
     // If not Null, we use this rather than asking our child what to do next.
     WorkingSetID _idRetrying;
 
+    // The number of members to fetch at a time, or zero to fetch each member as soon as the child
+    // returns it.
+    const size_t _batchSize;
+
+    // The members returned by the child that have yet to be returned by this stage, in the order
+    // the child returned them.
+    std::deque<WorkingSetID> _pending;
+
+    // The records of the members in '_pending', sorted by RecordId, if they have been looked up.
+    RecordBatch _batch;
+    bool _batchFetched = false;
+
+    // The storage snapshot the records in '_batch' were read in.
+    SnapshotId _batchSnapshotId;
+
     // Stats
     FetchStats _specificStats;
 };
@@ -97,6 +97,11 @@ void updatePlanCache(OperationContext* opCtx,
     }
 }
 
+bool canUsePlanTemplateCache(const QuerySolution& solution) {
+    return sbe::isPlanTemplateCacheEnabled() && !solution.indexFilterApplied &&
+        !solution.hasNode(STAGE_SHARDING_FILTER);
+}
+
 plan_cache_debug_info::DebugInfo buildDebugInfo(
     const CanonicalQuery& query, std::unique_ptr<const plan_ranker::PlanRankingDecision> decision) {
     // Strip projections on $-prefixed fields, as these are added by internal callers of the
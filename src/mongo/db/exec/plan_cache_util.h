@@ -86,6 +86,13 @@ plan_cache_debug_info::DebugInfo buildDebugInfo(
  */
 plan_cache_debug_info::DebugInfoSBE buildDebugInfo(const QuerySolution* solution);
 
+/**
+ * Returns true if the SBE plan built from 'solution' may also be stored in the plan template cache
+ * and shared with other collections. Plans which filter out orphans or which were restricted by
+ * the collection's index filters depend on more than the collection's indexes and are not shared.
+ */
+bool canUsePlanTemplateCache(const QuerySolution& solution);
+
 /**
  * Caches the best candidate plan, chosen from the given 'candidates' based on the 'ranking'
  * decision, if the 'query' is of a type that can be cached. Otherwise, does nothing.
@@ -210,6 +217,19 @@ void updatePlanCache(
 
                     auto buildDebugInfoFn = [soln = winningPlan.solution.get()]()
                         -> plan_cache_debug_info::DebugInfoSBE { return buildDebugInfo(soln); };
+                    if (canUsePlanTemplateCache(*winningPlan.solution)) {
+                        PlanCacheCallbacksImpl<sbe::PlanTemplateKey,
+                                               sbe::CachedSbePlan,
+                                               plan_cache_debug_info::DebugInfoSBE>
+                            templateCallbacks{query, buildDebugInfoFn};
+                        uassertStatusOK(sbe::getPlanTemplateCache(opCtx).set(
+                            plan_cache_key_factory::make<sbe::PlanTemplateKey>(query, collection),
+                            cachedPlan->clone(),
+                            *rankingDecision,
+                            opCtx->getServiceContext()->getPreciseClockSource()->now(),
+                            &templateCallbacks,
+                            boost::none /* worksGrowthCoefficient */));
+                    }
                     PlanCacheCallbacksImpl<sbe::PlanCacheKey,
                                            sbe::CachedSbePlan,
                                            plan_cache_debug_info::DebugInfoSBE>
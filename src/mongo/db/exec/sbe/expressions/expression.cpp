@@ -120,6 +120,14 @@ vm::CodeFragment EVariable::compileDirect(CompileCtx& ctx) const {
     return code;
 }
 
+value::SlotAccessor* EVariable::getReadOnlySlotAccessor(CompileCtx& ctx) const {
+    if (_frameId || _moveFrom) {
+        return nullptr;
+    }
+
+    return ctx.root ? ctx.root->getAccessor(ctx, _var) : ctx.getAccessor(_var);
+}
+
 std::vector<DebugPrinter::Block> EVariable::debugPrint() const {
     std::vector<DebugPrinter::Block> ret;
 
@@ -185,6 +193,40 @@ vm::CodeFragment EPrimBinary::compileDirect(CompileCtx& ctx) const {
         return code;
     }
 
+    // Comparisons with a constant on the right hand side read the constant straight from the
+    // instruction.
+    if (auto constant = _nodes[1]->as<EConstant>(); constant && !hasCollatorArg) {
+        auto [tag, val] = constant->getConstant();
+        switch (_op) {
+            case EPrimBinary::less:
+                code.append(std::move(lhs));
+                code.appendLess(tag, val);
+                return code;
+            case EPrimBinary::lessEq:
+                code.append(std::move(lhs));
+                code.appendLessEq(tag, val);
+                return code;
+            case EPrimBinary::greater:
+                code.append(std::move(lhs));
+                code.appendGreater(tag, val);
+                return code;
+            case EPrimBinary::greaterEq:
+                code.append(std::move(lhs));
+                code.appendGreaterEq(tag, val);
+                return code;
+            case EPrimBinary::eq:
+                code.append(std::move(lhs));
+                code.appendEq(tag, val);
+                return code;
+            case EPrimBinary::neq:
+                code.append(std::move(lhs));
+                code.appendNeq(tag, val);
+                return code;
+            default:
+                break;
+        }
+    }
+
     if (hasCollatorArg) {
         auto collator = _nodes[2]->compileDirect(ctx);
         code.append(std::move(collator));
@@ -429,6 +471,8 @@ static stdx::unordered_map<std::string, BuiltinFn> kBuiltinFunctions = {
      BuiltinFn{[](size_t n) { return n > 0; }, vm::Builtin::doubleDoubleSum, false}},
     {"aggDoubleDoubleSum",
      BuiltinFn{[](size_t n) { return n == 1; }, vm::Builtin::aggDoubleDoubleSum, true}},
+    {"aggMergeDoubleDoubleSums",
+     BuiltinFn{[](size_t n) { return n == 1; }, vm::Builtin::aggMergeDoubleDoubleSums, true}},
     {"doubleDoubleSumFinalize",
      BuiltinFn{[](size_t n) { return n > 0; }, vm::Builtin::doubleDoubleSumFinalize, false}},
     {"doubleDoublePartialSumFinalize",
@@ -656,6 +700,15 @@ vm::CodeFragment EFunction::compileDirect(CompileCtx& ctx) const {
             auto [tag, val] = _nodes[1]->as<EConstant>()->getConstant();
 
             if (value::isString(tag)) {
+                // Reading a field of a slot is common enough to have its own superinstruction.
+                if (auto var = _nodes[0]->as<EVariable>()) {
+                    if (auto accessor = var->getReadOnlySlotAccessor(ctx)) {
+                        code.appendGetField(accessor, tag, val);
+
+                        return code;
+                    }
+                }
+
                 code.append(_nodes[0]->compileDirect(ctx));
                 code.appendGetField(tag, val);
 
@@ -449,6 +449,13 @@ public:
         return sizeof(*this);
     }
 
+    /**
+     * Returns the accessor of the slot if this variable only reads a slot, or nullptr if it is a
+     * local variable or it moves the value out of the slot. Used to generate superinstructions
+     * which read the slot directly.
+     */
+    value::SlotAccessor* getReadOnlySlotAccessor(CompileCtx& ctx) const;
+
 private:
     value::SlotId _var;
     boost::optional<FrameId> _frameId;
@@ -0,0 +1,184 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/exec/sbe/expression_test_base.h"
+
+namespace mongo::sbe {
+
+/**
+ * Checks that the superinstructions emitted for comparisons against a constant and for getField on
+ * a slot produce exactly the same results as the generic instruction sequences they replace.
+ */
+class SBEFusedInstructionsTest : public EExpressionTestFixture {
+protected:
+    using TypedValue = std::pair<value::TypeTags, value::Value>;
+
+    ~SBEFusedInstructionsTest() override {
+        for (auto [tag, val] : _values) {
+            value::releaseValue(tag, val);
+        }
+    }
+
+    /**
+     * Returns owned copies of the values used both as comparison operands and as constants. The
+     * fixture keeps ownership of them.
+     */
+    const std::vector<TypedValue>& testValues() {
+        if (!_values.empty()) {
+            return _values;
+        }
+
+        _values.push_back(makeNothing());
+        _values.push_back({value::TypeTags::Null, 0});
+        _values.push_back(makeBool(true));
+        _values.push_back(makeInt32(1));
+        _values.push_back(makeInt32(2));
+        _values.push_back(makeInt64(1));
+        _values.push_back(makeInt64(3));
+        _values.push_back(makeDouble(1.0));
+        _values.push_back(makeDouble(1.5));
+        _values.push_back(value::makeCopyDecimal(Decimal128(1)));
+        _values.push_back(value::makeCopyDecimal(Decimal128("2.5")));
+        _values.push_back(value::makeNewString("abc"));
+        _values.push_back(value::makeNewString("a string too long to be stored inline"));
+
+        for (auto&& bson : {BSON("a" << 1), BSON("a" << 1 << "b" << "xyz")}) {
+            _values.push_back(value::copyValue(value::TypeTags::bsonObject,
+                                               value::bitcastFrom<const char*>(bson.objdata())));
+        }
+
+        auto [objTag, objVal] = value::makeNewObject();
+        _values.push_back({objTag, objVal});
+        auto [strTag, strVal] = value::makeNewString("another string too long to be inlined");
+        value::getObjectView(objVal)->push_back("a", strTag, strVal);
+
+        return _values;
+    }
+
+    /**
+     * Asserts that 'code' ends with 'instr' followed by an inline constant.
+     */
+    void assertEndsWithConstInstruction(const vm::CodeFragment* code, vm::Instruction::Tags instr) {
+        constexpr auto kInstrSize =
+            sizeof(vm::Instruction) + sizeof(value::TypeTags) + sizeof(value::Value);
+        ASSERT_GTE(code->instrs().size(), kInstrSize);
+        ASSERT_EQ(code->instrs()[code->instrs().size() - kInstrSize], instr);
+    }
+
+    void runAndAssertSameResult(const vm::CodeFragment* fused, const vm::CodeFragment* unfused) {
+        auto [fusedTag, fusedVal] = runCompiledExpression(fused);
+        value::ValueGuard fusedGuard(fusedTag, fusedVal);
+        auto [unfusedTag, unfusedVal] = runCompiledExpression(unfused);
+        value::ValueGuard unfusedGuard(unfusedTag, unfusedVal);
+
+        ASSERT_EQ(fusedTag, unfusedTag);
+        if (fusedTag == value::TypeTags::Nothing) {
+            return;
+        }
+
+        auto [cmpTag, cmpVal] = value::compareValue(fusedTag, fusedVal, unfusedTag, unfusedVal);
+        ASSERT_EQ(cmpTag, value::TypeTags::NumberInt32);
+        ASSERT_EQ(value::bitcastTo<int32_t>(cmpVal), 0);
+    }
+
+private:
+    std::vector<TypedValue> _values;
+};
+
+TEST_F(SBEFusedInstructionsTest, ComparisonsWithConstantMatchGenericComparisons) {
+    value::OwnedValueAccessor lhsAccessor;
+    auto lhsSlot = bindAccessor(&lhsAccessor);
+    value::OwnedValueAccessor rhsAccessor;
+    auto rhsSlot = bindAccessor(&rhsAccessor);
+
+    const std::vector<std::pair<EPrimBinary::Op, vm::Instruction::Tags>> ops = {
+        {EPrimBinary::eq, vm::Instruction::eqConst},
+        {EPrimBinary::neq, vm::Instruction::neqConst},
+        {EPrimBinary::less, vm::Instruction::lessConst},
+        {EPrimBinary::lessEq, vm::Instruction::lessEqConst},
+        {EPrimBinary::greater, vm::Instruction::greaterConst},
+        {EPrimBinary::greaterEq, vm::Instruction::greaterEqConst},
+    };
+
+    for (auto [op, fusedInstr] : ops) {
+        for (auto [constTag, constVal] : testValues()) {
+            auto [fusedConstTag, fusedConstVal] = value::copyValue(constTag, constVal);
+            auto fusedExpr = makeE<EPrimBinary>(op,
+                                                makeE<EVariable>(lhsSlot),
+                                                makeE<EConstant>(fusedConstTag, fusedConstVal));
+            auto fused = compileExpression(*fusedExpr);
+            assertEndsWithConstInstruction(fused.get(), fusedInstr);
+
+            auto unfusedExpr =
+                makeE<EPrimBinary>(op, makeE<EVariable>(lhsSlot), makeE<EVariable>(rhsSlot));
+            auto unfused = compileExpression(*unfusedExpr);
+
+            auto [rhsTag, rhsVal] = value::copyValue(constTag, constVal);
+            rhsAccessor.reset(rhsTag, rhsVal);
+
+            for (auto [lhsTag, lhsVal] : testValues()) {
+                auto [copyTag, copyVal] = value::copyValue(lhsTag, lhsVal);
+                lhsAccessor.reset(copyTag, copyVal);
+                runAndAssertSameResult(fused.get(), unfused.get());
+            }
+        }
+    }
+}
+
+TEST_F(SBEFusedInstructionsTest, GetFieldOnSlotMatchesGetFieldOnLocalVariable) {
+    value::OwnedValueAccessor inputAccessor;
+    auto inputSlot = bindAccessor(&inputAccessor);
+
+    for (auto fieldName : {"a"_sd, "b"_sd, "missing"_sd}) {
+        // A getField whose input is a slot reads the slot and the field in one instruction.
+        auto fusedExpr = makeE<EFunction>(
+            "getField", makeEs(makeE<EVariable>(inputSlot), makeE<EConstant>(fieldName)));
+        auto fused = compileExpression(*fusedExpr);
+        ASSERT_EQ(fused->instrs()[0], vm::Instruction::pushAccessValGetFieldConst);
+
+        // A local variable has no slot accessor, so the same lookup uses the generic getField.
+        FrameId frame = 10;
+        auto unfusedExpr = makeE<ELocalBind>(
+            frame,
+            makeEs(makeE<EVariable>(inputSlot)),
+            makeE<EFunction>(
+                "getField",
+                makeEs(makeE<EVariable>(frame, 0), makeE<EConstant>(fieldName))));
+        auto unfused = compileExpression(*unfusedExpr);
+        ASSERT_NE(unfused->instrs()[0], vm::Instruction::pushAccessValGetFieldConst);
+
+        for (auto [inputTag, inputVal] : testValues()) {
+            auto [copyTag, copyVal] = value::copyValue(inputTag, inputVal);
+            inputAccessor.reset(copyTag, copyVal);
+            runAndAssertSameResult(fused.get(), unfused.get());
+        }
+    }
+}
+
+}  // namespace mongo::sbe
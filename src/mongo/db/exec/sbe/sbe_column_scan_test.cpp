@@ -34,6 +34,95 @@
 #include "mongo/platform/basic.h"
 
 #include "mongo/db/exec/sbe/sbe_plan_stage_test.h"
+#include "mongo/db/exec/sbe/stages/column_scan.h"
+#include "mongo/db/exec/sbe/values/bson.h"
+#include "mongo/db/index/column_cell.h"
+#include "mongo/db/index/column_key_generator.h"
 #include "mongo/db/storage/column_store.h"
 
-namespace mongo::sbe {}  // namespace mongo::sbe
+namespace mongo::sbe {
+namespace {
+using Op = ColumnScanStage::PathFilter::Op;
+
+/**
+ * Returns the cell which a column store index would hold for 'path' in 'doc'.
+ */
+std::string makeCell(const BSONObj& doc, PathView path) {
+    boost::optional<std::string> cell;
+    column_keygen::visitCellsForInsert(
+        doc, [&](PathView cellPath, const column_keygen::UnencodedCellView& unencodedCell) {
+            if (cellPath == path) {
+                BufBuilder cellBuffer;
+                column_keygen::writeEncodedCell(unencodedCell, &cellBuffer);
+                cell.emplace(cellBuffer.buf(), cellBuffer.len());
+            }
+        });
+    ASSERT(cell) << "no cell for path '" << path << "' in " << doc;
+    return *cell;
+}
+
+/**
+ * Evaluates the path filter 'path op filterValue' on the cell of 'path' in 'doc'.
+ */
+bool passesCell(const BSONObj& doc, PathView path, Op op, const BSONObj& filterValue) {
+    ColumnScanStage::PathFilter filter{0, op, makeE<EConstant>(value::TypeTags::Nothing, 0)};
+    auto [filterTag, filterVal] = bson::convertFrom<true>(filterValue.firstElement());
+    return filter.passesCell(path, makeCell(doc, path), filterTag, filterVal);
+}
+}  // namespace
+
+TEST(ColumnScanPathFilterTest, ComparesScalarCells) {
+    const auto doc = BSON("a" << 5 << "s"
+                              << "abc");
+
+    ASSERT_TRUE(passesCell(doc, "a", Op::kEq, BSON("" << 5)));
+    ASSERT_FALSE(passesCell(doc, "a", Op::kEq, BSON("" << 6)));
+    ASSERT_TRUE(passesCell(doc, "a", Op::kLt, BSON("" << 6)));
+    ASSERT_FALSE(passesCell(doc, "a", Op::kLt, BSON("" << 5)));
+    ASSERT_TRUE(passesCell(doc, "a", Op::kLte, BSON("" << 5)));
+    ASSERT_FALSE(passesCell(doc, "a", Op::kLte, BSON("" << 4)));
+    ASSERT_TRUE(passesCell(doc, "a", Op::kGt, BSON("" << 4)));
+    ASSERT_FALSE(passesCell(doc, "a", Op::kGt, BSON("" << 5)));
+    ASSERT_TRUE(passesCell(doc, "a", Op::kGte, BSON("" << 5)));
+    ASSERT_FALSE(passesCell(doc, "a", Op::kGte, BSON("" << 6)));
+
+    ASSERT_TRUE(passesCell(doc, "s", Op::kGt, BSON("" << "abb")));
+    ASSERT_FALSE(passesCell(doc, "s", Op::kEq, BSON("" << "abd")));
+}
+
+TEST(ColumnScanPathFilterTest, ComparesNumbersOfDifferentTypes) {
+    const auto doc = BSON("a" << 5.0 << "b" << 7LL);
+
+    ASSERT_TRUE(passesCell(doc, "a", Op::kEq, BSON("" << 5)));
+    ASSERT_TRUE(passesCell(doc, "b", Op::kGt, BSON("" << 6.5)));
+    ASSERT_FALSE(passesCell(doc, "b", Op::kLt, BSON("" << Decimal128(7))));
+}
+
+TEST(ColumnScanPathFilterTest, DoesNotCompareValuesOfOtherTypes) {
+    const auto doc = BSON("a"
+                          << "str"
+                          << "b" << BSONNULL);
+
+    ASSERT_FALSE(passesCell(doc, "a", Op::kLt, BSON("" << 5)));
+    ASSERT_FALSE(passesCell(doc, "a", Op::kGt, BSON("" << 5)));
+    ASSERT_FALSE(passesCell(doc, "b", Op::kGte, BSON("" << 0)));
+}
+
+TEST(ColumnScanPathFilterTest, PassesArrayCellsIfAnyValueMatches) {
+    const auto doc = BSON("a" << BSON_ARRAY(1 << "str" << 10));
+
+    ASSERT_TRUE(passesCell(doc, "a", Op::kGte, BSON("" << 5)));
+    ASSERT_TRUE(passesCell(doc, "a", Op::kLt, BSON("" << 5)));
+    ASSERT_TRUE(passesCell(doc, "a", Op::kEq, BSON("" << 10)));
+    ASSERT_TRUE(passesCell(doc, "a", Op::kEq, BSON("" << "str")));
+    ASSERT_FALSE(passesCell(doc, "a", Op::kGt, BSON("" << 10)));
+    ASSERT_FALSE(passesCell(doc, "a", Op::kEq, BSON("" << 5)));
+}
+
+TEST(ColumnScanPathFilterTest, PassesCellsWithSubPaths) {
+    // The cell of 'a' doesn't hold the values of its sub-paths, so it can't reject the record.
+    const auto doc = BSON("a" << BSON_ARRAY(1 << BSON("b" << 2)));
+
+    ASSERT_TRUE(passesCell(doc, "a", Op::kGt, BSON("" << 100)));
+}
+}  // namespace mongo::sbe
@@ -37,6 +37,7 @@
 #include "mongo/db/exec/sbe/sbe_plan_stage_test.h"
 #include "mongo/db/exec/sbe/stages/hash_join.h"
 #include "mongo/db/query/collation/collator_interface_mock.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo::sbe {
 
@@ -137,4 +138,63 @@ TEST_F(HashJoinStageTest, HashJoinCollationTest) {
     }
 }
 
+TEST_F(HashJoinStageTest, HashJoinSpillTest) {
+    // Set the memory threshold so low that every partition has to be split until the maximum
+    // partitioning depth is reached.
+    auto defaultInternalQuerySBEHashJoinApproxMemoryUseInBytesBeforeSpill =
+        internalQuerySBEHashJoinApproxMemoryUseInBytesBeforeSpill.load();
+    internalQuerySBEHashJoinApproxMemoryUseInBytesBeforeSpill.store(1);
+    ON_BLOCK_EXIT([&] {
+        internalQuerySBEHashJoinApproxMemoryUseInBytesBeforeSpill.store(
+            defaultInternalQuerySBEHashJoinApproxMemoryUseInBytesBeforeSpill);
+    });
+
+    auto ctx = makeCompileCtx();
+
+    auto [outerTag, outerVal] = stage_builder::makeValue(BSON_ARRAY(1 << 2 << 2 << 3 << 4));
+    auto [outerCondSlot, outerStage] = generateVirtualScan(outerTag, outerVal);
+
+    auto [innerTag, innerVal] = stage_builder::makeValue(BSON_ARRAY(2 << 3 << 3 << 5 << 1));
+    auto [innerCondSlot, innerStage] = generateVirtualScan(innerTag, innerVal);
+
+    auto stage = makeS<HashJoinStage>(std::move(outerStage),
+                                      std::move(innerStage),
+                                      makeSV(outerCondSlot),
+                                      makeSV(),
+                                      makeSV(innerCondSlot),
+                                      makeSV(),
+                                      boost::none,
+                                      kEmptyPlanNodeId);
+
+    auto resultAccessors =
+        prepareTree(ctx.get(), stage.get(), makeSV(innerCondSlot, outerCondSlot));
+
+    // Spilled rows are produced partition by partition, so compare the results ignoring the order.
+    for (auto reOpen : {false, true}) {
+        if (reOpen) {
+            stage->open(true);
+        }
+
+        std::multiset<std::pair<int32_t, int32_t>> results;
+        while (stage->getNext() == PlanState::ADVANCED) {
+            auto [innerResTag, innerResVal] = resultAccessors[0]->getViewOfValue();
+            auto [outerResTag, outerResVal] = resultAccessors[1]->getViewOfValue();
+            ASSERT_EQ(value::TypeTags::NumberInt32, innerResTag);
+            ASSERT_EQ(value::TypeTags::NumberInt32, outerResTag);
+            results.emplace(value::bitcastTo<int32_t>(innerResVal),
+                            value::bitcastTo<int32_t>(outerResVal));
+        }
+
+        std::multiset<std::pair<int32_t, int32_t>> expected{{1, 1}, {2, 2}, {2, 2}, {3, 3}, {3, 3}};
+        ASSERT(results == expected);
+
+        auto stats = static_cast<const HashJoinStats*>(stage->getSpecificStats());
+        ASSERT_TRUE(stats->usedDisk);
+        ASSERT_GT(stats->numPartitions, 0);
+        ASSERT_GT(stats->maxPartitionDepth, 1);
+    }
+
+    stage->close();
+}
+
 }  // namespace mongo::sbe
@@ -537,6 +537,78 @@ TEST_F(SBEMathBuiltinTest, DoubleDoubleSummation) {
         ASSERT(value::bitcastTo<Decimal128>(resultVal).isEqual(Decimal128{"6.0"}));
     }
 }
+
+TEST_F(SBEMathBuiltinTest, AggMergeDoubleDoubleSums) {
+    // Runs the aggregate function 'fn' over all 'inputs' and returns the owned accumulator.
+    auto runAgg = [&](StringData fn,
+                      const std::vector<std::pair<value::TypeTags, value::Value>>& inputs) {
+        value::OwnedValueAccessor accAccessor;
+        value::ViewOfValueAccessor inputAccessor;
+        auto inputSlot = bindAccessor(&inputAccessor);
+        auto expr = makeE<EFunction>(fn, makeEs(makeE<EVariable>(inputSlot)));
+        auto compiledExpr = compileAggExpression(*expr, &accAccessor);
+
+        for (auto [tag, val] : inputs) {
+            inputAccessor.reset(tag, val);
+            auto [accTag, accVal] = runCompiledExpression(compiledExpr.get());
+            accAccessor.reset(true, accTag, accVal);
+        }
+        return accAccessor.copyOrMoveValue();
+    };
+
+    auto finalize = [&](value::TypeTags tag, value::Value val) {
+        value::ViewOfValueAccessor inputAccessor;
+        auto inputSlot = bindAccessor(&inputAccessor);
+        auto expr =
+            makeE<EFunction>("doubleDoubleSumFinalize", makeEs(makeE<EVariable>(inputSlot)));
+        auto compiledExpr = compileExpression(*expr);
+        inputAccessor.reset(tag, val);
+        return runCompiledExpression(compiledExpr.get());
+    };
+
+    {
+        // Partial sums of non-decimal values only.
+        auto partial1 = runAgg("aggDoubleDoubleSum",
+                               {{value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(1)},
+                                {value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(2)}});
+        value::ValueGuard partial1Guard{partial1};
+        auto partial2 = runAgg("aggDoubleDoubleSum",
+                               {{value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(3)}});
+        value::ValueGuard partial2Guard{partial2};
+
+        auto [mergedTag, mergedVal] = runAgg(
+            "aggMergeDoubleDoubleSums", {partial1, {value::TypeTags::Nothing, 0}, partial2});
+        value::ValueGuard mergedGuard{mergedTag, mergedVal};
+
+        auto [resultTag, resultVal] = finalize(mergedTag, mergedVal);
+        value::ValueGuard resultGuard{resultTag, resultVal};
+        ASSERT_EQ(value::TypeTags::NumberInt64, resultTag);
+        ASSERT_EQ(6, value::bitcastTo<int64_t>(resultVal));
+    }
+
+    {
+        // Only one of the partial sums has seen a decimal value.
+        auto [decimalTag, decimalVal] = value::makeCopyDecimal(Decimal128{"0.5"});
+        value::ValueGuard decimalGuard{decimalTag, decimalVal};
+
+        auto partial1 = runAgg("aggDoubleDoubleSum",
+                               {{value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(1)},
+                                {value::TypeTags::NumberDouble, value::bitcastFrom<double>(2.5)}});
+        value::ValueGuard partial1Guard{partial1};
+        auto partial2 = runAgg("aggDoubleDoubleSum",
+                               {{value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(3)},
+                                {decimalTag, decimalVal}});
+        value::ValueGuard partial2Guard{partial2};
+
+        auto [mergedTag, mergedVal] = runAgg("aggMergeDoubleDoubleSums", {partial1, partial2});
+        value::ValueGuard mergedGuard{mergedTag, mergedVal};
+
+        auto [resultTag, resultVal] = finalize(mergedTag, mergedVal);
+        value::ValueGuard resultGuard{resultTag, resultVal};
+        ASSERT_EQ(value::TypeTags::NumberDecimal, resultTag);
+        ASSERT(value::bitcastTo<Decimal128>(resultVal).isEqual(Decimal128{"7.0"}));
+    }
+}
 }  // namespace
 
 }  // namespace mongo::sbe
@@ -0,0 +1,139 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <benchmark/benchmark.h>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/exec/sbe/expressions/expression.h"
+#include "mongo/db/exec/sbe/values/slot.h"
+#include "mongo/db/exec/sbe/vm/vm.h"
+
+namespace mongo::sbe {
+namespace {
+/**
+ * Compiles expressions over a single input slot holding a BSON document, the typical shape of the
+ * predicates and projections generated for a filter-heavy query, and measures the time spent in
+ * the VM evaluating them.
+ */
+class VmBenchmark {
+public:
+    VmBenchmark() : _ctx{std::make_unique<RuntimeEnvironment>()} {
+        _ctx.pushCorrelated(_inputSlot, &_inputAccessor);
+
+        BSONObjBuilder bob;
+        for (int i = 0; i < 16; ++i) {
+            bob.append(std::string(1, 'a' + i), i);
+        }
+        _doc = bob.obj();
+        _inputAccessor.reset(value::TypeTags::bsonObject,
+                             value::bitcastFrom<const char*>(_doc.objdata()));
+    }
+
+    std::unique_ptr<EExpression> getField(StringData field) {
+        auto [tag, val] = value::makeNewString(field);
+        return makeE<EFunction>("getField"_sd,
+                                makeEs(makeE<EVariable>(_inputSlot), makeE<EConstant>(tag, val)));
+    }
+
+    static std::unique_ptr<EExpression> int32(int32_t i) {
+        return makeE<EConstant>(value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(i));
+    }
+
+    static std::unique_ptr<EExpression> fillEmptyFalse(std::unique_ptr<EExpression> e) {
+        return makeE<EFunction>(
+            "fillEmpty"_sd,
+            makeEs(std::move(e),
+                   makeE<EConstant>(value::TypeTags::Boolean, value::bitcastFrom<bool>(false))));
+    }
+
+    void runPredicate(benchmark::State& state, const EExpression& expr) {
+        auto code = expr.compile(_ctx);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(_vm.runPredicate(code.get()));
+        }
+    }
+
+    void runExpression(benchmark::State& state, const EExpression& expr) {
+        auto code = expr.compile(_ctx);
+        for (auto _ : state) {
+            auto [owned, tag, val] = _vm.run(code.get());
+            benchmark::DoNotOptimize(val);
+            if (owned) {
+                value::releaseValue(tag, val);
+            }
+        }
+    }
+
+private:
+    const value::SlotId _inputSlot{1};
+    value::ViewOfValueAccessor _inputAccessor;
+    BSONObj _doc;
+
+    CompileCtx _ctx;
+    vm::ByteCode _vm;
+};
+
+// {p: 15}
+void BM_EqualityPredicate(benchmark::State& state) {
+    VmBenchmark bm;
+    auto expr = fillEmptyFalse(makeE<EPrimBinary>(EPrimBinary::eq, bm.getField("p"), bm.int32(15)));
+    bm.runPredicate(state, *expr);
+}
+
+// {b: {$gt: 0, $lt: 10}, h: {$gte: 5}}
+void BM_ConjunctivePredicate(benchmark::State& state) {
+    VmBenchmark bm;
+    auto expr = makeE<EPrimBinary>(
+        EPrimBinary::logicAnd,
+        makeE<EPrimBinary>(
+            EPrimBinary::logicAnd,
+            fillEmptyFalse(makeE<EPrimBinary>(EPrimBinary::greater, bm.getField("b"), bm.int32(0))),
+            fillEmptyFalse(makeE<EPrimBinary>(EPrimBinary::less, bm.getField("b"), bm.int32(10)))),
+        fillEmptyFalse(
+            makeE<EPrimBinary>(EPrimBinary::greaterEq, bm.getField("h"), bm.int32(5))));
+    bm.runPredicate(state, *expr);
+}
+
+// {$project: {x: {$add: [{$multiply: ["$c", 2]}, "$d"]}}}
+void BM_ArithmeticExpression(benchmark::State& state) {
+    VmBenchmark bm;
+    auto expr = makeE<EPrimBinary>(
+        EPrimBinary::add,
+        makeE<EPrimBinary>(EPrimBinary::mul, bm.getField("c"), bm.int32(2)),
+        bm.getField("d"));
+    bm.runExpression(state, *expr);
+}
+
+BENCHMARK(BM_EqualityPredicate);
+BENCHMARK(BM_ConjunctivePredicate);
+BENCHMARK(BM_ArithmeticExpression);
+}  // namespace
+}  // namespace mongo::sbe
@@ -59,7 +59,8 @@ ColumnScanStage::ColumnScanStage(UUID collectionUuid,
                                  std::vector<std::unique_ptr<EExpression>> pathExprs,
                                  value::SlotId rowStoreSlot,
                                  PlanYieldPolicy* yieldPolicy,
-                                 PlanNodeId nodeId)
+                                 PlanNodeId nodeId,
+                                 std::vector<PathFilter> pathFilters)
     : PlanStage("columnscan"_sd, yieldPolicy, nodeId),
       _collUuid(collectionUuid),
       _columnIndexName(columnIndexName),
@@ -69,9 +70,13 @@ ColumnScanStage::ColumnScanStage(UUID collectionUuid,
       _recordIdSlot(recordIdSlot),
       _recordExpr(std::move(recordExpr)),
       _pathExprs(std::move(pathExprs)),
-      _rowStoreSlot(rowStoreSlot) {
+      _rowStoreSlot(rowStoreSlot),
+      _pathFilters(std::move(pathFilters)) {
     invariant(_fieldSlots.size() == _paths.size());
     invariant(_fieldSlots.size() == _pathExprs.size());
+    for (auto& filter : _pathFilters) {
+        invariant(filter.pathIdx < _paths.size());
+    }
 }
 
 std::unique_ptr<PlanStage> ColumnScanStage::clone() const {
@@ -79,6 +84,10 @@ std::unique_ptr<PlanStage> ColumnScanStage::clone() const {
     for (auto& expr : _pathExprs) {
         pathExprs.emplace_back(expr->clone());
     }
+    std::vector<PathFilter> pathFilters;
+    for (auto& filter : _pathFilters) {
+        pathFilters.emplace_back(filter.clone());
+    }
     return std::make_unique<ColumnScanStage>(_collUuid,
                                              _columnIndexName,
                                              _fieldSlots,
@@ -89,7 +98,8 @@ std::unique_ptr<PlanStage> ColumnScanStage::clone() const {
                                              std::move(pathExprs),
                                              _rowStoreSlot,
                                              _yieldPolicy,
-                                             _commonStats.nodeId);
+                                             _commonStats.nodeId,
+                                             std::move(pathFilters));
 }
 
 void ColumnScanStage::prepare(CompileCtx& ctx) {
@@ -116,6 +126,11 @@ void ColumnScanStage::prepare(CompileCtx& ctx) {
         ctx.root = this;
         _pathExprsCode.emplace_back(expr->compile(ctx));
     }
+    _pathFilterValues.resize(_pathFilters.size());
+    for (auto& filter : _pathFilters) {
+        ctx.root = this;
+        _pathFilterValuesCode.emplace_back(filter.value->compile(ctx));
+    }
 
     tassert(6610200, "'_coll' should not be initialized prior to 'acquireCollection()'", !_coll);
     std::tie(_coll, _collName, _catalogEpoch) = acquireCollection(_opCtx, _collUuid);
@@ -227,6 +242,11 @@ void ColumnScanStage::doAttachToOperationContext(OperationContext* opCtx) {
     }
 }
 
+void ColumnScanStage::doBindCollection(const UUID& collUuid) {
+    tassert(7086763, "Cannot bind a collection to a prepared ColumnScanStage", !_collName);
+    _collUuid = collUuid;
+}
+
 void ColumnScanStage::doDetachFromTrialRunTracker() {
     _tracker = nullptr;
 }
@@ -287,6 +307,16 @@ void ColumnScanStage::open(bool reOpen) {
         columnCursor.seekAtOrPast(RecordId());
     }
 
+    // The filter values may depend on the query parameters, so re-evaluate them on every open.
+    _activePathFilters.clear();
+    for (size_t idx = 0; idx < _pathFilters.size(); ++idx) {
+        auto [owned, tag, val] = _bytecode.run(_pathFilterValuesCode[idx].get());
+        _pathFilterValues[idx].reset(owned, tag, val);
+        if (value::isNumber(tag) || value::isString(tag) || tag == value::TypeTags::Date) {
+            _activePathFilters.push_back(idx);
+        }
+    }
+
     _open = true;
 }
 
@@ -344,24 +374,150 @@ void ColumnScanStage::readParentsIntoObj(StringData path,
 }
 
 
-PlanState ColumnScanStage::getNext() {
-    auto optTimer(getOptTimer(_opCtx));
+bool ColumnScanStage::PathFilter::passesCell(PathView path,
+                                             StringData cell,
+                                             value::TypeTags filterTag,
+                                             value::Value filterVal) const {
+    auto splitCellView = SplitCellView::parse(cell);
+    if (splitCellView.hasSubPaths || splitCellView.hasDuplicateFields) {
+        // The cell alone doesn't describe all of the values of the path, so let the full query
+        // predicate decide.
+        return true;
+    }
+
+    // Like the match expression comparisons, only compare against values of the same canonical
+    // type as the filter value.
+    const auto filterType = canonicalizeBSONType(value::tagToType(filterTag));
+    auto translatedCell = translateCell(path, splitCellView);
+    while (translatedCell.moreValues()) {
+        auto [tag, val] = translatedCell.nextValue();
+        if (canonicalizeBSONType(value::tagToType(tag)) != filterType) {
+            continue;
+        }
 
-    // We are about to call next() on a storage cursor so do not bother saving our internal state in
-    // case it yields as the state will be completely overwritten after the next() call.
-    disableSlotAccess();
+        auto [cmpTag, cmpVal] = value::compareValue(tag, val, filterTag, filterVal);
+        if (cmpTag != value::TypeTags::NumberInt32) {
+            return true;
+        }
 
-    checkForInterrupt(_opCtx);
+        const auto cmp = value::bitcastTo<int32_t>(cmpVal);
+        switch (op) {
+            case Op::kEq:
+                if (cmp == 0) {
+                    return true;
+                }
+                break;
+            case Op::kLt:
+                if (cmp < 0) {
+                    return true;
+                }
+                break;
+            case Op::kLte:
+                if (cmp <= 0) {
+                    return true;
+                }
+                break;
+            case Op::kGt:
+                if (cmp > 0) {
+                    return true;
+                }
+                break;
+            case Op::kGte:
+                if (cmp >= 0) {
+                    return true;
+                }
+                break;
+        }
+    }
+
+    return false;
+}
+
+bool ColumnScanStage::passesPathFilter(size_t idx, const FullCellView& cell) {
+    const auto& filter = _pathFilters[idx];
+    auto [filterTag, filterVal] = _pathFilterValues[idx].getViewOfValue();
+    return filter.passesCell(
+        _columnCursors[filter.pathIdx + 1].path(), cell.value, filterTag, filterVal);
+}
 
+void ColumnScanStage::trackRead() {
+    ++_specificStats.numReads;
+    if (_tracker && _tracker->trackProgress<TrialRunTracker::kNumReads>(1)) {
+        // If we're collecting execution stats during multi-planning and reached the end of the
+        // trial period because we've performed enough physical reads, bail out from the trial run
+        // by raising a special exception to signal a runtime planner that this candidate plan has
+        // completed its trial run early. Note that a trial period is executed only once per a
+        // PlanStage tree, and once completed never run again on the same tree.
+        _tracker = nullptr;
+        uasserted(ErrorCodes::QueryTrialRunCompleted, "Trial run early exit in scan");
+    }
+}
+
+RecordId ColumnScanStage::findNextRecordId() {
     // Find minimum record ID of all column cursors.
-    _recordId = RecordId();
+    RecordId recordId;
     for (auto& cursor : _columnCursors) {
         auto& result = cursor.lastCell();
-        if (result && (_recordId.isNull() || result->rid < _recordId)) {
-            _recordId = result->rid;
+        if (result && (recordId.isNull() || result->rid < recordId)) {
+            recordId = result->rid;
         }
     }
 
+    if (recordId.isNull() || _activePathFilters.empty()) {
+        return recordId;
+    }
+
+    // Leapfrog between the filtered columns until all of them agree on a record which passes every
+    // filter. A record without a cell for a filtered path can never pass, so the other columns
+    // need not be read for the records skipped here.
+    size_t numAgreed = 0;
+    for (size_t i = 0; numAgreed < _activePathFilters.size();
+         i = (i + 1) % _activePathFilters.size()) {
+        const auto filterIdx = _activePathFilters[i];
+        auto& cursor = _columnCursors[_pathFilters[filterIdx].pathIdx + 1];
+
+        auto* cell = &cursor.lastCell();
+        while (*cell && ((*cell)->rid < recordId || !passesPathFilter(filterIdx, **cell))) {
+            // Count the cells skipped here as reads, as they cost as much as the ones of the
+            // records which are returned.
+            cell = &cursor.next();
+            trackRead();
+        }
+
+        if (!*cell) {
+            // One of the filtered columns is exhausted, so no more records can pass.
+            return RecordId();
+        }
+
+        if ((*cell)->rid == recordId) {
+            ++numAgreed;
+        } else {
+            recordId = (*cell)->rid;
+            numAgreed = 1;
+        }
+    }
+
+    // Skip the remaining columns straight to the candidate record.
+    for (auto& cursor : _columnCursors) {
+        auto& result = cursor.lastCell();
+        if (result && result->rid < recordId) {
+            cursor.seekAtOrPast(recordId);
+        }
+    }
+
+    return recordId;
+}
+
+PlanState ColumnScanStage::getNext() {
+    auto optTimer(getOptTimer(_opCtx));
+
+    // We are about to call next() on a storage cursor so do not bother saving our internal state in
+    // case it yields as the state will be completely overwritten after the next() call.
+    disableSlotAccess();
+
+    checkForInterrupt(_opCtx);
+
+    _recordId = findNextRecordId();
     if (_recordId.isNull()) {
         return trackPlanState(PlanState::IS_EOF);
     }
@@ -433,16 +589,7 @@ PlanState ColumnScanStage::getNext() {
         _outputFields[idx].reset(owned, tag, val);
     }
 
-    ++_specificStats.numReads;
-    if (_tracker && _tracker->trackProgress<TrialRunTracker::kNumReads>(1)) {
-        // If we're collecting execution stats during multi-planning and reached the end of the
-        // trial period because we've performed enough physical reads, bail out from the trial run
-        // by raising a special exception to signal a runtime planner that this candidate plan has
-        // completed its trial run early. Note that a trial period is executed only once per a
-        // PlanStage tree, and once completed never run again on the same tree.
-        _tracker = nullptr;
-        uasserted(ErrorCodes::QueryTrialRunCompleted, "Trial run early exit in scan");
-    }
+    trackRead();
     return trackPlanState(PlanState::ADVANCED);
 }
 
@@ -468,6 +615,13 @@ std::unique_ptr<PlanStageStats> ColumnScanStage::getStats(bool includeDebugInfo)
 
         bob.append("paths", _paths);
         bob.append("outputSlots", _fieldSlots.begin(), _fieldSlots.end());
+        if (!_pathFilters.empty()) {
+            std::vector<std::string> filteredPaths;
+            for (auto& filter : _pathFilters) {
+                filteredPaths.push_back(_paths[filter.pathIdx]);
+            }
+            bob.append("filteredPaths", filteredPaths);
+        }
 
         ret->debugInfo = bob.obj();
     }
@@ -523,6 +677,24 @@ std::vector<DebugPrinter::Block> ColumnScanStage::debugPrint() const {
     DebugPrinter::addIdentifier(ret, _columnIndexName);
     ret.emplace_back("`\"");
 
+    if (!_pathFilters.empty()) {
+        static constexpr StringData kOpNames[] = {"=="_sd, "<"_sd, "<="_sd, ">"_sd, ">="_sd};
+
+        DebugPrinter::addKeyword(ret, "filters");
+        ret.emplace_back(DebugPrinter::Block("[`"));
+        for (size_t idx = 0; idx < _pathFilters.size(); ++idx) {
+            if (idx) {
+                ret.emplace_back(DebugPrinter::Block("`,"));
+            }
+
+            const auto& filter = _pathFilters[idx];
+            ret.emplace_back(str::stream() << "\"" << _paths[filter.pathIdx] << "\"");
+            ret.emplace_back(kOpNames[static_cast<size_t>(filter.op)]);
+            DebugPrinter::addBlocks(ret, filter.value->debugPrint());
+        }
+        ret.emplace_back(DebugPrinter::Block("`]"));
+    }
+
     return ret;
 }
 
@@ -531,6 +703,9 @@ size_t ColumnScanStage::estimateCompileTimeSize() const {
     size += size_estimator::estimate(_fieldSlots);
     size += size_estimator::estimate(_paths);
     size += size_estimator::estimate(_specificStats);
+    for (auto& filter : _pathFilters) {
+        size += filter.value->estimateSize();
+    }
     return size;
 }
 }  // namespace sbe
@@ -40,9 +40,46 @@ namespace sbe {
 /**
  * A stage that scans provided columnar index. A set of paths is retrieved from the index and values
  * are put in output slots.
+ *
+ * Optional 'pathFilters' are evaluated directly on the cells of the filtered paths before a row is
+ * assembled. The filtered columns drive the scan: the stage only reads the other columns, and only
+ * assembles the output, for the records whose cells pass all of the filters.
  */
 class ColumnScanStage final : public PlanStage {
 public:
+    /**
+     * A comparison of the values of the path '_paths[pathIdx]' against the result of 'value', which
+     * is evaluated once per open() and is typically a constant or a query parameter.
+     *
+     * A path filter is only a necessary condition: it rejects a record when none of the values in
+     * the cell compare to the constant as the 'op' requires, or when the record has no cell for the
+     * path at all. Rows which pass it must still be checked against the full query predicate.
+     */
+    struct PathFilter {
+        enum class Op { kEq, kLt, kLte, kGt, kGte };
+
+        PathFilter(size_t pathIdx, Op op, std::unique_ptr<EExpression> value)
+            : pathIdx(pathIdx), op(op), value(std::move(value)) {}
+
+        PathFilter clone() const {
+            return PathFilter{pathIdx, op, value->clone()};
+        }
+
+        /**
+         * Returns true if any of the values in 'cell', the encoded cell of the filtered 'path',
+         * compares to [filterTag, filterVal] as 'op' requires. Also returns true if the cell alone
+         * is not enough to decide, for instance when the path has sub-paths.
+         */
+        bool passesCell(PathView path,
+                        StringData cell,
+                        value::TypeTags filterTag,
+                        value::Value filterVal) const;
+
+        size_t pathIdx;
+        Op op;
+        std::unique_ptr<EExpression> value;
+    };
+
     ColumnScanStage(UUID collectionUuid,
                     StringData columnIndexName,
                     value::SlotVector fieldSlots,
@@ -53,7 +90,8 @@ public:
                     std::vector<std::unique_ptr<EExpression>> pathExprs,
                     value::SlotId internalSlot,
                     PlanYieldPolicy* yieldPolicy,
-                    PlanNodeId nodeId);
+                    PlanNodeId nodeId,
+                    std::vector<PathFilter> pathFilters = {});
 
     std::unique_ptr<PlanStage> clone() const final;
 
@@ -73,6 +111,7 @@ protected:
     void doRestoreState(bool relinquishCursor) override;
     void doDetachFromOperationContext() override;
     void doAttachToOperationContext(OperationContext* opCtx) override;
+    void doBindCollection(const UUID& collUuid) override;
     void doDetachFromTrialRunTracker() override;
     TrialRunTrackerAttachResultMask doAttachToTrialRunTracker(
         TrialRunTracker* tracker, TrialRunTrackerAttachResultMask childrenAttachResult) override;
@@ -151,7 +190,26 @@ private:
                             StringDataSet* pathsReadSetOut,
                             bool first = true);
 
-    const UUID _collUuid;
+    /**
+     * Returns the smallest record id which any of the column cursors is positioned at. If there
+     * are active path filters, first advances the filtered columns to the next record which passes
+     * all of them and positions the remaining cursors at or past that record. Returns a null record
+     * id when the scan is exhausted.
+     */
+    RecordId findNextRecordId();
+
+    /**
+     * Returns true if any of the values in 'cell' satisfies the path filter '_pathFilters[idx]'.
+     */
+    bool passesPathFilter(size_t idx, const FullCellView& cell);
+
+    /**
+     * Counts a read from the index towards 'numReads' and the trial run tracker, if any. Throws
+     * 'QueryTrialRunCompleted' once the trial run has performed enough reads.
+     */
+    void trackRead();
+
+    UUID _collUuid;
     const std::string _columnIndexName;
     const value::SlotVector _fieldSlots;
     const std::vector<std::string> _paths;
@@ -165,6 +223,8 @@ private:
     // An internal slot that points to the row store document.
     const value::SlotId _rowStoreSlot;
 
+    const std::vector<PathFilter> _pathFilters;
+
     std::vector<value::OwnedValueAccessor> _outputFields;
     value::SlotAccessorMap _outputFieldsMap;
     std::unique_ptr<value::OwnedValueAccessor> _recordAccessor;
@@ -174,6 +234,13 @@ private:
     std::vector<std::unique_ptr<vm::CodeFragment>> _pathExprsCode;
     std::unique_ptr<value::OwnedValueAccessor> _rowStoreAccessor;
 
+    std::vector<std::unique_ptr<vm::CodeFragment>> _pathFilterValuesCode;
+    // The values compared against by the path filters, evaluated on every open().
+    std::vector<value::OwnedValueAccessor> _pathFilterValues;
+    // Indexes of the path filters with a supported value type. Filters with other value types are
+    // left to the full query predicate.
+    std::vector<size_t> _activePathFilters;
+
     vm::ByteCode _bytecode;
 
     // These members are default constructed to boost::none and are initialized when 'prepare()'
@@ -32,11 +32,16 @@
 #include "mongo/db/exec/sbe/stages/exchange.h"
 
 #include "mongo/base/init.h"
+#include "mongo/db/catalog/collection_catalog.h"
 #include "mongo/db/client.h"
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/exec/sbe/size_estimator.h"
+#include "mongo/util/fail_point.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo::sbe {
+MONGO_FAIL_POINT_DEFINE(hangExchangeProducerBeforeOpen);
+
 std::unique_ptr<ThreadPool> s_globalThreadPool;
 MONGO_INITIALIZER(s_globalThreadPool)(InitializerContext* context) {
     ThreadPool::Options options;
@@ -70,10 +75,11 @@ void ExchangePipe::close() {
     _cond.notify_all();
 }
 
-std::unique_ptr<ExchangeBuffer> ExchangePipe::getEmptyBuffer() {
+std::unique_ptr<ExchangeBuffer> ExchangePipe::getEmptyBuffer(OperationContext* opCtx) {
     stdx::unique_lock lock(_mutex);
 
-    _cond.wait(lock, [this]() { return _closed || _emptyCount > 0; });
+    opCtx->waitForConditionOrInterrupt(
+        _cond, lock, [this]() { return _closed || _emptyCount > 0; });
 
     if (_closed) {
         return nullptr;
@@ -84,10 +90,11 @@ std::unique_ptr<ExchangeBuffer> ExchangePipe::getEmptyBuffer() {
     return std::move(_emptyBuffers[_emptyCount]);
 }
 
-std::unique_ptr<ExchangeBuffer> ExchangePipe::getFullBuffer() {
+std::unique_ptr<ExchangeBuffer> ExchangePipe::getFullBuffer(OperationContext* opCtx) {
     stdx::unique_lock lock(_mutex);
 
-    _cond.wait(lock, [this]() { return _closed || _fullCount != _fullPosition; });
+    opCtx->waitForConditionOrInterrupt(
+        _cond, lock, [this]() { return _closed || _fullCount != _fullPosition; });
 
     if (_closed) {
         return nullptr;
@@ -134,6 +141,73 @@ ExchangePipe* ExchangeState::pipe(size_t consumerTid, size_t producerTid) {
     return _consumers[consumerTid]->pipe(producerTid);
 }
 
+void ExchangeState::captureProducerContext(OperationContext* consumerOpCtx) {
+    // The producers must see the same collections as the consumer, even when they are dropped or
+    // renamed while the producers run, so they read through the consumer's view of the catalog
+    // rather than through a collection lock.
+    _producerCatalog = CollectionCatalog::get(consumerOpCtx);
+
+    auto ru = consumerOpCtx->recoveryUnit();
+    _producerReadSource = ru->getTimestampReadSource();
+    if (_producerReadSource == RecoveryUnit::ReadSource::kProvided) {
+        _producerReadTimestamp = ru->getPointInTimeReadTimestamp(consumerOpCtx);
+    }
+
+    _producerDeadline = consumerOpCtx->getDeadline();
+    _producerTimeoutError = consumerOpCtx->getTimeoutError();
+}
+
+void ExchangeState::applyProducerContext(OperationContext* producerOpCtx) const {
+    if (_producerDeadline != Date_t::max()) {
+        producerOpCtx->setDeadlineByDate(_producerDeadline, _producerTimeoutError);
+    }
+
+    producerOpCtx->recoveryUnit()->setTimestampReadSource(_producerReadSource,
+                                                          _producerReadTimestamp);
+}
+
+void ExchangeState::registerProducerOpCtx(OperationContext* opCtx) {
+    stdx::lock_guard lock(_producerOpCtxsMutex);
+    _producerOpCtxs.insert(opCtx);
+
+    if (_producersCancelled) {
+        stdx::lock_guard<Client> clientLock(*opCtx->getClient());
+        opCtx->getServiceContext()->killOperation(clientLock, opCtx);
+    }
+}
+
+void ExchangeState::unregisterProducerOpCtx(OperationContext* opCtx) {
+    stdx::lock_guard lock(_producerOpCtxsMutex);
+    _producerOpCtxs.erase(opCtx);
+}
+
+void ExchangeState::cancelProducers() {
+    stdx::lock_guard lock(_producerOpCtxsMutex);
+    _producersCancelled = true;
+
+    for (auto opCtx : _producerOpCtxs) {
+        stdx::lock_guard<Client> clientLock(*opCtx->getClient());
+        opCtx->getServiceContext()->killOperation(clientLock, opCtx);
+    }
+}
+
+bool ExchangeState::producersCancelled() {
+    stdx::lock_guard lock(_producerOpCtxsMutex);
+    return _producersCancelled;
+}
+
+void ExchangeState::setProducerError(Status status) {
+    stdx::lock_guard lock(_producerOpCtxsMutex);
+    if (_producerError.isOK()) {
+        _producerError = std::move(status);
+    }
+}
+
+Status ExchangeState::producerError() {
+    stdx::lock_guard lock(_producerOpCtxsMutex);
+    return _producerError;
+}
+
 size_t ExchangeState::estimateCompileTimeSize() const {
     size_t size = sizeof(*this);
     size += size_estimator::estimate(_fields);
@@ -149,7 +223,14 @@ ExchangeBuffer* ExchangeConsumer::getBuffer(size_t producerId) {
         return _fullBuffers[producerId].get();
     }
 
-    _fullBuffers[producerId] = _pipes[producerId]->getFullBuffer();
+    try {
+        _fullBuffers[producerId] = _pipes[producerId]->getFullBuffer(_opCtx);
+    } catch (const DBException&) {
+        // The consumer's operation has been interrupted, so stop the producers rather than let
+        // them run to completion.
+        _state->cancelProducers();
+        throw;
+    }
 
     return _fullBuffers[producerId].get();
 }
@@ -255,6 +336,8 @@ void ExchangeConsumer::open(bool reOpen) {
                     lock, [this]() { return _state->consumerOpen() == _state->numOfConsumers(); });
             }
 
+            _state->captureProducerContext(_opCtx);
+
             // Clone n copies of the subtree for every producer.
 
             PlanStage* masterSubTree = _children[0].get();
@@ -323,7 +406,11 @@ PlanState ExchangeConsumer::getNext() {
         while (_eofs < _state->numOfProducers()) {
             auto buffer = getBuffer(0);
             if (!buffer) {
-                // early out
+                // early out, either because the consumer is being closed or because a producer
+                // has failed.
+                if (!_state->producersCancelled()) {
+                    uassertStatusOK(_state->producerError());
+                }
                 return trackPlanState(PlanState::IS_EOF);
             }
             if (_bufferPos[0] < buffer->count()) {
@@ -356,6 +443,13 @@ void ExchangeConsumer::close() {
         stdx::unique_lock lock(_state->consumerCloseMutex());
         ++_state->consumerClose();
 
+        // A consumer closed before it has seen the end of the data from all producers does not
+        // need the rest of it, so stop the producers rather than wait for them to run to
+        // completion.
+        if (_eofs < _state->numOfProducers()) {
+            _state->cancelProducers();
+        }
+
         // Signal early out.
         for (auto& p : _pipes) {
             p->close();
@@ -378,9 +472,10 @@ void ExchangeConsumer::close() {
                 lock, [this]() { return _state->consumerClose() == _state->numOfConsumers(); });
         }
     }
-    // Rethrow the first stored exception from producers.
+    // Rethrow the first stored exception from producers, unless the producers have been cancelled
+    // and failed only because of it.
     // We can do it outside of the lock as everybody else is gone by now.
-    if (_tid == 0) {
+    if (_tid == 0 && !_state->producersCancelled()) {
         // Consumer ID 0
         for (size_t idx = 0; idx < _state->numOfProducers(); ++idx) {
             _state->producerResults()[idx].get();
@@ -461,7 +556,7 @@ ExchangeBuffer* ExchangeProducer::getBuffer(size_t consumerId) {
         return _emptyBuffers[consumerId].get();
     }
 
-    _emptyBuffers[consumerId] = _pipes[consumerId]->getEmptyBuffer();
+    _emptyBuffers[consumerId] = _pipes[consumerId]->getEmptyBuffer(_opCtx);
 
     if (!_emptyBuffers[consumerId]) {
         closePipes();
@@ -504,12 +599,30 @@ void ExchangeProducer::start(OperationContext* opCtx,
                              std::unique_ptr<PlanStage> producer) {
     ExchangeProducer* p = static_cast<ExchangeProducer*>(producer.get());
 
-    // TODO: SERVER-62925. Rationalize this lock.
-    Lock::GlobalLock lock(opCtx, MODE_IS);
-
-    p->attachToOperationContext(opCtx);
+    p->_state->registerProducerOpCtx(opCtx);
+    ScopeGuard unregisterGuard([&] { p->_state->unregisterProducerOpCtx(opCtx); });
 
     try {
+        p->_state->applyProducerContext(opCtx);
+
+        // The producer reads from the catalog captured by the consumer, like a lock-free read,
+        // rather than under collection locks: the consumer holds its own locks while it waits for
+        // the producers, so a producer queued behind a conflicting lock request could never
+        // finish.
+        Lock::GlobalLock lock(opCtx,
+                              MODE_IS,
+                              Date_t::max(),
+                              Lock::InterruptBehavior::kThrow,
+                              true /* skipRSTLLock */);
+        CollectionCatalogStasher catalogStasher(opCtx, p->_state->producerCatalog());
+
+        // The plan was cloned from the consumer's plan, which yields through the consumer's yield
+        // policy. A producer never yields, its scans release their snapshots on their own.
+        p->attachNewYieldPolicy(nullptr);
+        p->attachToOperationContext(opCtx);
+
+        hangExchangeProducerBeforeOpen.pauseWhileSet(opCtx);
+
         p->prepare(ctx);
         p->open(false);
 
@@ -520,7 +633,9 @@ void ExchangeProducer::start(OperationContext* opCtx,
 
         p->close();
     } catch (...) {
-        // This is a bit sketchy but close the pipes as minimum.
+        // This is a bit sketchy but close the pipes as minimum. Record the error first, so that
+        // the consumers report it rather than mistake the closed pipes for an early out.
+        p->_state->setProducerError(exceptionToStatus());
         p->closePipes();
         throw;
     }
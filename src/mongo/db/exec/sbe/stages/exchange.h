@@ -33,11 +33,17 @@
 
 #include "mongo/db/exec/sbe/expressions/expression.h"
 #include "mongo/db/exec/sbe/stages/stages.h"
+#include "mongo/db/storage/recovery_unit.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/stdx/future.h"
+#include "mongo/stdx/unordered_set.h"
 #include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/future.h"
 
+namespace mongo {
+class CollectionCatalog;
+}  // namespace mongo
+
 namespace mongo::sbe {
 class ExchangeConsumer;
 class ExchangeProducer;
@@ -122,8 +128,13 @@ public:
     ExchangePipe(size_t size);
 
     void close();
-    std::unique_ptr<ExchangeBuffer> getEmptyBuffer();
-    std::unique_ptr<ExchangeBuffer> getFullBuffer();
+
+    /**
+     * Wait for a buffer to become available. Return nullptr if the pipe is closed. Throw if the
+     * wait is interrupted.
+     */
+    std::unique_ptr<ExchangeBuffer> getEmptyBuffer(OperationContext* opCtx);
+    std::unique_ptr<ExchangeBuffer> getFullBuffer(OperationContext* opCtx);
     void putEmptyBuffer(std::unique_ptr<ExchangeBuffer>);
     void putFullBuffer(std::unique_ptr<ExchangeBuffer>);
 
@@ -222,6 +233,43 @@ public:
 
     ExchangePipe* pipe(size_t consumerTid, size_t producerTid);
 
+    /**
+     * Captures the state of the consumer's operation which the producers must inherit: the
+     * catalog, the read source, and the deadline. Called by consumer ID 0 before it starts the
+     * producers.
+     */
+    void captureProducerContext(OperationContext* consumerOpCtx);
+
+    /**
+     * Applies the captured read source and deadline to a producer's operation context.
+     */
+    void applyProducerContext(OperationContext* producerOpCtx) const;
+
+    const std::shared_ptr<const CollectionCatalog>& producerCatalog() const {
+        return _producerCatalog;
+    }
+
+    /**
+     * Producers register their operation contexts while they run, so that the consumers can
+     * interrupt them. A producer which registers after the producers have been cancelled is
+     * interrupted right away.
+     */
+    void registerProducerOpCtx(OperationContext* opCtx);
+    void unregisterProducerOpCtx(OperationContext* opCtx);
+
+    /**
+     * Interrupts all running producers and the ones yet to start. The errors the producers fail
+     * with afterwards are not reported to the consumers.
+     */
+    void cancelProducers();
+    bool producersCancelled();
+
+    /**
+     * Records the error a producer failed with. Only the first error is kept.
+     */
+    void setProducerError(Status status);
+    Status producerError();
+
     size_t estimateCompileTimeSize() const;
 
 private:
@@ -251,6 +299,20 @@ private:
     mongo::Mutex _consumerCloseMutex;
     stdx::condition_variable _consumerCloseCond;
     size_t _consumerClose{0};
+
+    // The state of the consumer's operation which the producers inherit.
+    std::shared_ptr<const CollectionCatalog> _producerCatalog;
+    RecoveryUnit::ReadSource _producerReadSource{RecoveryUnit::ReadSource::kNoTimestamp};
+    boost::optional<Timestamp> _producerReadTimestamp;
+    Date_t _producerDeadline{Date_t::max()};
+    ErrorCodes::Error _producerTimeoutError{ErrorCodes::ExceededTimeLimit};
+
+    // Protects the running producers' operation contexts, the cancellation flag and the first
+    // producer error.
+    mongo::Mutex _producerOpCtxsMutex = MONGO_MAKE_LATCH("ExchangeState::_producerOpCtxsMutex");
+    stdx::unordered_set<OperationContext*> _producerOpCtxs;
+    bool _producersCancelled{false};
+    Status _producerError{Status::OK()};
 };
 
 class ExchangeConsumer final : public PlanStage {
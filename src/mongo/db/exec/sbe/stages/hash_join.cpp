@@ -33,6 +33,8 @@
 
 #include "mongo/db/exec/sbe/expressions/expression.h"
 #include "mongo/db/exec/sbe/size_estimator.h"
+#include "mongo/db/exec/sbe/util/spilling.h"
+#include "mongo/db/storage/storage_engine.h"
 #include "mongo/util/str.h"
 
 namespace mongo {
@@ -112,6 +114,30 @@ void HashJoinStage::prepare(CompileCtx& ctx) {
         _outOuterAccessors[slot] = _outOuterProjectAccessors.back().get();
     }
 
+    // The inner keys and projects are materialized together into '_spilledInnerRow' when the join
+    // spills, so expose them through switch accessors. Preallocate the accessors to keep the
+    // element pointers stable.
+    _outInnerSpilledAccessors.reserve(_innerCond.size() + _innerProjects.size());
+    _outInnerAccessors.reserve(_innerCond.size() + _innerProjects.size());
+    auto addInnerAccessor = [&](value::SlotId slot, value::SlotAccessor* accessor) {
+        const size_t idx = _outInnerSpilledAccessors.size();
+        _outInnerSpilledAccessors.emplace_back(_spilledInnerRow, idx);
+        _outInnerAccessors.emplace_back(
+            std::vector<value::SlotAccessor*>{accessor, &_outInnerSpilledAccessors.back()});
+        _outInnerAccessorMap[slot] = &_outInnerAccessors.back();
+    };
+    for (size_t idx = 0; idx < _innerCond.size(); ++idx) {
+        addInnerAccessor(_innerCond[idx], _inInnerKeyAccessors[idx]);
+    }
+    for (auto& slot : _innerProjects) {
+        if (_outInnerAccessorMap.find(slot) != _outInnerAccessorMap.end()) {
+            continue;
+        }
+
+        _inInnerProjectAccessors.emplace_back(_children[1]->getAccessor(ctx, slot));
+        addInnerAccessor(slot, _inInnerProjectAccessors.back());
+    }
+
     _probeKey.resize(_inInnerKeyAccessors.size());
 
     _compiled = true;
@@ -122,6 +148,9 @@ value::SlotAccessor* HashJoinStage::getAccessor(CompileCtx& ctx, value::SlotId s
         if (auto it = _outOuterAccessors.find(slot); it != _outOuterAccessors.end()) {
             return it->second;
         }
+        if (auto it = _outInnerAccessorMap.find(slot); it != _outInnerAccessorMap.end()) {
+            return it->second;
+        }
 
         return _children[1]->getAccessor(ctx, slot);
     }
@@ -129,9 +158,215 @@ value::SlotAccessor* HashJoinStage::getAccessor(CompileCtx& ctx, value::SlotId s
     return ctx.getAccessor(slot);
 }
 
+void HashJoinStage::doSaveState(bool relinquishCursor) {
+    if (relinquishCursor) {
+        if (_rsCursor) {
+            _rsCursor->save();
+        }
+    }
+    if (_rsCursor) {
+        _rsCursor->setSaveStorageCursorOnDetachFromOperationContext(!relinquishCursor);
+    }
+}
+
+void HashJoinStage::doRestoreState(bool relinquishCursor) {
+    invariant(_opCtx);
+    if (_rsCursor && relinquishCursor) {
+        auto couldRestore = _rsCursor->restore();
+        uassert(7086700, "HashJoinStage could not restore cursor", couldRestore);
+    }
+}
+
+void HashJoinStage::doDetachFromOperationContext() {
+    if (_rsCursor) {
+        _rsCursor->detachFromOperationContext();
+    }
+}
+
+void HashJoinStage::doAttachToOperationContext(OperationContext* opCtx) {
+    if (_rsCursor) {
+        _rsCursor->reattachToOperationContext(opCtx);
+    }
+}
+
+void HashJoinStage::reset() {
+    _rsCursor.reset();
+    _probeRs.reset();
+    _partitions.clear();
+    _pendingPartitions.clear();
+    _spilled = false;
+    _computedTotalMemUsage = 0;
+
+    // Reset the memory threshold if the knob changes between re-open calls.
+    _memoryUseInBytesBeforeSpill = internalQuerySBEHashJoinApproxMemoryUseInBytesBeforeSpill.load();
+
+    for (auto& accessor : _outInnerAccessors) {
+        accessor.setIndex(0);
+    }
+}
+
+std::unique_ptr<TemporaryRecordStore> HashJoinStage::makeTemporaryRecordStore() {
+    tassert(7086701,
+            "HashJoinStage attempted to write to disk in an environment which is not prepared to "
+            "do so",
+            _opCtx->getServiceContext());
+    tassert(7086702,
+            "No storage engine so HashJoinStage cannot spill to disk",
+            _opCtx->getServiceContext()->getStorageEngine());
+    assertIgnorePrepareConflictsBehavior(_opCtx);
+
+    _specificStats.usedDisk = true;
+    return _opCtx->getServiceContext()->getStorageEngine()->makeTemporaryRecordStore(
+        _opCtx, KeyFormat::Long);
+}
+
+std::vector<HashJoinStage::Partition> HashJoinStage::makePartitions(size_t depth) {
+    // The record stores of the partitions are created lazily, when the first row is spilled into
+    // them, since skewed keys can leave many partitions empty.
+    std::vector<Partition> partitions(internalQuerySBEHashJoinSpillPartitions.load());
+    for (auto& partition : partitions) {
+        partition.depth = depth;
+    }
+
+    _specificStats.numPartitions += partitions.size();
+    _specificStats.maxPartitionDepth =
+        std::max(_specificStats.maxPartitionDepth, static_cast<long long>(depth));
+    return partitions;
+}
+
+size_t HashJoinStage::getPartitionIdx(const value::MaterializedRow& key,
+                                      const std::vector<Partition>& partitions) const {
+    // Salt the hash with the partition depth and mix its bits, so that the rows which ended up in
+    // the same partition at one level are spread out across the partitions of the next level.
+    uint64_t hash = _ht->hash_function()(key) + partitions.front().depth * 0x9E3779B97F4A7C15ULL;
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 33;
+    return hash % partitions.size();
+}
+
+void HashJoinStage::spillRecord(std::unique_ptr<TemporaryRecordStore>& rs,
+                                int64_t& recordCount,
+                                const char* data,
+                                int size) {
+    if (!rs) {
+        rs = makeTemporaryRecordStore();
+    }
+
+    assertIgnorePrepareConflictsBehavior(_opCtx);
+    WriteUnitOfWork wuow(_opCtx);
+
+    // A RecordId with the value 0 is invalid, so the ids start at 1.
+    auto status = rs->rs()->insertRecord(_opCtx, RecordId(++recordCount), data, size, Timestamp{});
+    wuow.commit();
+
+    tassert(7086703,
+            str::stream() << "Failed to write to disk because " << status.getStatus().reason(),
+            status.isOK());
+}
+
+void HashJoinStage::spillOuterRow(std::vector<Partition>& partitions,
+                                  const value::MaterializedRow& key,
+                                  const value::MaterializedRow& project) {
+    BufBuilder buf;
+    key.serializeForSorter(buf);
+    project.serializeForSorter(buf);
+
+    auto& partition = partitions[getPartitionIdx(key, partitions)];
+    spillRecord(partition.outerRs, partition.outerRecords, buf.buf(), buf.len());
+
+    _specificStats.spilledOuterRecords++;
+    _specificStats.spilledOuterBytes += buf.len();
+}
+
+void HashJoinStage::spillInnerRow(std::vector<Partition>& partitions,
+                                  const value::MaterializedRow& key,
+                                  const char* data,
+                                  int size) {
+    auto& partition = partitions[getPartitionIdx(key, partitions)];
+    spillRecord(partition.innerRs, partition.innerRecords, data, size);
+
+    _specificStats.spilledInnerRecords++;
+    _specificStats.spilledInnerBytes += size;
+}
+
+void HashJoinStage::spillHashTable(std::vector<Partition>& partitions) {
+    for (auto& [key, project] : *_ht) {
+        spillOuterRow(partitions, key, project);
+    }
+
+    _ht->clear();
+    _computedTotalMemUsage = 0;
+}
+
+void HashJoinStage::loadPartition(Partition partition) {
+    _ht->clear();
+    _htIt = _ht->end();
+    _htItEnd = _ht->end();
+    _computedTotalMemUsage = 0;
+
+    if (partition.outerRecords == 0 || partition.innerRecords == 0) {
+        // The join cannot produce any rows from a partition with an empty side.
+        return;
+    }
+
+    // Build the hash table from the outer side of the partition. If it does not fit in memory
+    // either, split the partition further.
+    std::vector<Partition> subPartitions;
+    auto cursor = partition.outerRs->rs()->getCursor(_opCtx);
+    while (auto record = cursor->next()) {
+        BufReader reader(record->data.data(), record->data.size());
+        auto key = value::MaterializedRow::deserializeForSorter(reader, {});
+        auto project = value::MaterializedRow::deserializeForSorter(reader, {});
+
+        if (!subPartitions.empty()) {
+            spillOuterRow(subPartitions, key, project);
+            continue;
+        }
+
+        _computedTotalMemUsage += size_estimator::estimate(key) + size_estimator::estimate(project);
+        _ht->emplace(std::move(key), std::move(project));
+
+        if (_computedTotalMemUsage > _memoryUseInBytesBeforeSpill &&
+            partition.depth < kMaxPartitionDepth) {
+            subPartitions = makePartitions(partition.depth + 1);
+            spillHashTable(subPartitions);
+        }
+    }
+    cursor.reset();
+    partition.outerRs.reset();
+
+    if (!subPartitions.empty()) {
+        // Split the inner side of the partition the same way and join the sub-partitions before
+        // moving on to the remaining partitions.
+        cursor = partition.innerRs->rs()->getCursor(_opCtx);
+        while (auto record = cursor->next()) {
+            BufReader reader(record->data.data(), record->data.size());
+            auto row = value::MaterializedRow::deserializeForSorter(reader, {});
+            for (size_t idx = 0; idx < _probeKey.size(); ++idx) {
+                auto [tag, val] = row.getViewOfValue(idx);
+                _probeKey.reset(idx, false, tag, val);
+            }
+            spillInnerRow(subPartitions, _probeKey, record->data.data(), record->data.size());
+        }
+
+        for (auto it = subPartitions.rbegin(); it != subPartitions.rend(); ++it) {
+            _pendingPartitions.emplace_front(std::move(*it));
+        }
+        return;
+    }
+
+    _probeRs = std::move(partition.innerRs);
+    _rsCursor = _probeRs->rs()->getCursor(_opCtx);
+}
+
 void HashJoinStage::open(bool reOpen) {
     auto optTimer(getOptTimer(_opCtx));
 
+    reset();
+
     if (_collatorAccessor) {
         auto [tag, collatorVal] = _collatorAccessor->getViewOfValue();
         uassert(5402504, "collatorSlot must be of collator type", tag == value::TypeTags::collator);
@@ -164,17 +399,106 @@ void HashJoinStage::open(bool reOpen) {
             project.reset(idx++, true, tag, val);
         }
 
+        if (hasSpilledToDisk()) {
+            spillOuterRow(_partitions, key, project);
+            continue;
+        }
+
+        _computedTotalMemUsage += size_estimator::estimate(key) + size_estimator::estimate(project);
         _ht->emplace(std::move(key), std::move(project));
+
+        if (_computedTotalMemUsage > _memoryUseInBytesBeforeSpill) {
+            // The hash table has outgrown its memory budget, so move its content to the disk
+            // partitions. All of the remaining outer rows will be partitioned as well.
+            _partitions = makePartitions(1);
+            spillHashTable(_partitions);
+            _spilled = true;
+        }
     }
 
     _children[0]->close();
 
     _children[1]->open(reOpen);
 
+    if (hasSpilledToDisk()) {
+        // Partition the inner side the same way as the outer side, so that each pair of
+        // partitions can be joined independently.
+        value::MaterializedRow row{_inInnerKeyAccessors.size() + _inInnerProjectAccessors.size()};
+        BufBuilder buf;
+        while (_children[1]->getNext() == PlanState::ADVANCED) {
+            size_t idx = 0;
+            for (auto& p : _inInnerKeyAccessors) {
+                auto [tag, val] = p->getViewOfValue();
+                _probeKey.reset(idx, false, tag, val);
+                row.reset(idx++, false, tag, val);
+            }
+            for (auto& p : _inInnerProjectAccessors) {
+                auto [tag, val] = p->getViewOfValue();
+                row.reset(idx++, false, tag, val);
+            }
+
+            buf.reset();
+            row.serializeForSorter(buf);
+            spillInnerRow(_partitions, _probeKey, buf.buf(), buf.len());
+        }
+
+        for (auto& partition : _partitions) {
+            _pendingPartitions.emplace_back(std::move(partition));
+        }
+        _partitions.clear();
+
+        // From now on the inner values are read back from the spilled partitions.
+        for (auto& accessor : _outInnerAccessors) {
+            accessor.setIndex(1);
+        }
+    }
+
     _htIt = _ht->end();
     _htItEnd = _ht->end();
 }
 
+bool HashJoinStage::nextProbeRow() {
+    if (!hasSpilledToDisk()) {
+        if (_children[1]->getNext() == PlanState::IS_EOF) {
+            return false;
+        }
+
+        // Copy keys in order to do the lookup.
+        size_t idx = 0;
+        for (auto& p : _inInnerKeyAccessors) {
+            auto [tag, val] = p->getViewOfValue();
+            _probeKey.reset(idx++, false, tag, val);
+        }
+        return true;
+    }
+
+    while (true) {
+        if (_rsCursor) {
+            if (auto record = _rsCursor->next()) {
+                BufReader reader(record->data.data(), record->data.size());
+                _spilledInnerRow = value::MaterializedRow::deserializeForSorter(reader, {});
+                for (size_t idx = 0; idx < _probeKey.size(); ++idx) {
+                    auto [tag, val] = _spilledInnerRow.getViewOfValue(idx);
+                    _probeKey.reset(idx, false, tag, val);
+                }
+                return true;
+            }
+
+            // The current partition has been fully probed.
+            _rsCursor.reset();
+            _probeRs.reset();
+        }
+
+        if (_pendingPartitions.empty()) {
+            return false;
+        }
+
+        auto partition = std::move(_pendingPartitions.front());
+        _pendingPartitions.pop_front();
+        loadPartition(std::move(partition));
+    }
+}
+
 PlanState HashJoinStage::getNext() {
     auto optTimer(getOptTimer(_opCtx));
 
@@ -182,27 +506,17 @@ PlanState HashJoinStage::getNext() {
         ++_htIt;
     }
 
-    if (_htIt == _htItEnd) {
-        while (_htIt == _htItEnd) {
-            auto state = _children[1]->getNext();
-            if (state == PlanState::IS_EOF) {
-                // LEFT and OUTER joins should enumerate "non-returned" rows here.
-                return trackPlanState(state);
-            }
-
-            // Copy keys in order to do the lookup.
-            size_t idx = 0;
-            for (auto& p : _inInnerKeyAccessors) {
-                auto [tag, val] = p->getViewOfValue();
-                _probeKey.reset(idx++, false, tag, val);
-            }
-
-            auto [low, hi] = _ht->equal_range(_probeKey);
-            _htIt = low;
-            _htItEnd = hi;
-            // If _htIt == _htItEnd (i.e. no match) then RIGHT and OUTER joins
-            // should enumerate "non-returned" rows here.
+    while (_htIt == _htItEnd) {
+        if (!nextProbeRow()) {
+            // LEFT and OUTER joins should enumerate "non-returned" rows here.
+            return trackPlanState(PlanState::IS_EOF);
         }
+
+        auto [low, hi] = _ht->equal_range(_probeKey);
+        _htIt = low;
+        _htItEnd = hi;
+        // If _htIt == _htItEnd (i.e. no match) then RIGHT and OUTER joins
+        // should enumerate "non-returned" rows here.
     }
 
     return trackPlanState(PlanState::ADVANCED);
@@ -213,18 +527,30 @@ void HashJoinStage::close() {
 
     trackClose();
     _children[1]->close();
+    reset();
     _ht = boost::none;
 }
 
 std::unique_ptr<PlanStageStats> HashJoinStage::getStats(bool includeDebugInfo) const {
     auto ret = std::make_unique<PlanStageStats>(_commonStats);
+    ret->specific = std::make_unique<HashJoinStats>(_specificStats);
+    if (includeDebugInfo) {
+        BSONObjBuilder bob;
+        // Spilling stats.
+        bob.appendBool("usedDisk", _specificStats.usedDisk)
+            .appendNumber("spilledRecords", _specificStats.getSpilledRecords())
+            .appendNumber("spilledBytesApprox", _specificStats.getSpilledBytesApprox())
+            .appendNumber("spilledPartitions", _specificStats.numPartitions)
+            .appendNumber("maxPartitionDepth", _specificStats.maxPartitionDepth);
+        ret->debugInfo = bob.obj();
+    }
     ret->children.emplace_back(_children[0]->getStats(includeDebugInfo));
     ret->children.emplace_back(_children[1]->getStats(includeDebugInfo));
     return ret;
 }
 
 const SpecificStats* HashJoinStage::getSpecificStats() const {
-    return nullptr;
+    return &_specificStats;
 }
 
 std::vector<DebugPrinter::Block> HashJoinStage::debugPrint() const {
@@ -29,10 +29,13 @@
 
 #pragma once
 
+#include <deque>
 #include <vector>
 
 #include "mongo/db/exec/sbe/stages/stages.h"
 #include "mongo/db/exec/sbe/vm/vm.h"
+#include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/db/storage/temporary_record_store.h"
 
 namespace mongo::sbe {
 /**
@@ -51,6 +54,15 @@ namespace mongo::sbe {
  * for string equality. For example, this can be used to perform a case-insensitive join on string
  * values.
  *
+ * If the estimated size of the hash table exceeds the
+ * 'internalQuerySBEHashJoinApproxMemoryUseInBytesBeforeSpill' limit, the stage switches to a grace
+ * hash join: the outer rows are hash partitioned into temporary record stores, the inner rows are
+ * partitioned the same way, and each pair of partitions is then joined separately. A partition
+ * whose outer side still does not fit in memory is re-partitioned recursively using a different
+ * hash salt. Once spilled, only the 'innerCond' and 'innerProjects' slots of the inner side are
+ * visible to the stages above, and the order of the produced rows is no longer that of the inner
+ * side.
+ *
  * Debug string representation:
  *
  *   hj collatorSlot?
@@ -81,6 +93,12 @@ public:
     std::vector<DebugPrinter::Block> debugPrint() const final;
     size_t estimateCompileTimeSize() const final;
 
+protected:
+    void doSaveState(bool relinquishCursor) override;
+    void doRestoreState(bool relinquishCursor) override;
+    void doDetachFromOperationContext() override;
+    void doAttachToOperationContext(OperationContext* opCtx) override;
+
 private:
     using TableType = std::unordered_multimap<value::MaterializedRow,  // NOLINT
                                               value::MaterializedRow,
@@ -90,6 +108,53 @@ private:
     using HashKeyAccessor = value::MaterializedRowKeyAccessor<TableType::iterator>;
     using HashProjectAccessor = value::MaterializedRowValueAccessor<TableType::iterator>;
 
+    /**
+     * A pair of spilled partitions which hold the outer and inner rows that hash to the same
+     * bucket at the given recursion 'depth'. Records are keyed by a sequential RecordId.
+     */
+    struct Partition {
+        std::unique_ptr<TemporaryRecordStore> outerRs;
+        std::unique_ptr<TemporaryRecordStore> innerRs;
+        int64_t outerRecords{0};
+        int64_t innerRecords{0};
+        size_t depth{1};
+    };
+
+    // The maximum recursion depth of re-partitioning, the first level of partitions has depth 1. A
+    // partition at this depth is always loaded into memory, regardless of its size, since it most
+    // likely consists of duplicate keys.
+    static constexpr size_t kMaxPartitionDepth = 4;
+
+    void reset();
+
+    /**
+     * Fetches the next inner row and loads its key into '_probeKey'. Returns false once the inner
+     * side (or all of the spilled partitions) is exhausted.
+     */
+    bool nextProbeRow();
+
+    // Spilling helpers.
+    bool hasSpilledToDisk() const {
+        return _spilled;
+    }
+    std::unique_ptr<TemporaryRecordStore> makeTemporaryRecordStore();
+    std::vector<Partition> makePartitions(size_t depth);
+    size_t getPartitionIdx(const value::MaterializedRow& key,
+                           const std::vector<Partition>& partitions) const;
+    void spillRecord(std::unique_ptr<TemporaryRecordStore>& rs,
+                     int64_t& recordCount,
+                     const char* data,
+                     int size);
+    void spillOuterRow(std::vector<Partition>& partitions,
+                       const value::MaterializedRow& key,
+                       const value::MaterializedRow& project);
+    void spillInnerRow(std::vector<Partition>& partitions,
+                       const value::MaterializedRow& key,
+                       const char* data,
+                       int size);
+    void spillHashTable(std::vector<Partition>& partitions);
+    void loadPartition(Partition partition);
+
     const value::SlotVector _outerCond;
     const value::SlotVector _outerProjects;
     const value::SlotVector _innerCond;
@@ -127,5 +192,33 @@ private:
     vm::ByteCode _bytecode;
 
     bool _compiled{false};
+
+    // Accessors of the inner side values which are visible to the stages above. They switch
+    // between the inner child accessors and the '_spilledInnerRow' once the join has spilled.
+    std::vector<value::SlotAccessor*> _inInnerProjectAccessors;
+    std::vector<value::MaterializedSingleRowAccessor> _outInnerSpilledAccessors;
+    std::vector<value::SwitchAccessor> _outInnerAccessors;
+    value::SlotAccessorMap _outInnerAccessorMap;
+
+    // The inner row (keys followed by projects) currently being probed from a spilled partition.
+    value::MaterializedRow _spilledInnerRow{0};
+
+    // Memory tracking and spilling to disk.
+    long long _memoryUseInBytesBeforeSpill =
+        internalQuerySBEHashJoinApproxMemoryUseInBytesBeforeSpill.load();
+    long long _computedTotalMemUsage{0};
+    bool _spilled{false};
+
+    // Partitions being filled while the stage is consuming its children.
+    std::vector<Partition> _partitions;
+
+    // Partitions which are yet to be joined.
+    std::deque<Partition> _pendingPartitions;
+
+    // The inner side of the partition which is currently being probed and a cursor over it.
+    std::unique_ptr<TemporaryRecordStore> _probeRs;
+    std::unique_ptr<SeekableRecordCursor> _rsCursor;
+
+    HashJoinStats _specificStats;
 };
 }  // namespace mongo::sbe
@@ -237,6 +237,11 @@ void IndexScanStage::doAttachToOperationContext(OperationContext* opCtx) {
     }
 }
 
+void IndexScanStage::doBindCollection(const UUID& collUuid) {
+    tassert(7086762, "Cannot bind a collection to a prepared IndexScanStage", !_collName);
+    _collUuid = collUuid;
+}
+
 void IndexScanStage::doDetachFromTrialRunTracker() {
     _tracker = nullptr;
 }
@@ -104,6 +104,7 @@ protected:
     void doRestoreState(bool relinquishCursor) override;
     void doDetachFromOperationContext() override;
     void doAttachToOperationContext(OperationContext* opCtx) override;
+    void doBindCollection(const UUID& collUuid) override;
     void doDetachFromTrialRunTracker() override;
     TrialRunTrackerAttachResultMask doAttachToTrialRunTracker(
         TrialRunTracker* tracker, TrialRunTrackerAttachResultMask childrenAttachResult) override;
@@ -119,7 +120,7 @@ private:
     const KeyString::Value& getSeekKeyLow() const;
     const KeyString::Value* getSeekKeyHigh() const;
 
-    const UUID _collUuid;
+    UUID _collUuid;
     const std::string _indexName;
     const bool _forward;
     const boost::optional<value::SlotId> _recordSlot;
@@ -282,6 +282,42 @@ struct HashAggStats : public SpecificStats {
     long long lastSpilledRecordSize{0};
 };
 
+struct HashJoinStats : public SpecificStats {
+    std::unique_ptr<SpecificStats> clone() const final {
+        return std::make_unique<HashJoinStats>(*this);
+    }
+
+    uint64_t estimateObjectSizeInBytes() const final {
+        return sizeof(*this);
+    }
+
+    void acceptVisitor(PlanStatsConstVisitor* visitor) const final {
+        visitor->visit(this);
+    }
+
+    void acceptVisitor(PlanStatsMutableVisitor* visitor) final {
+        visitor->visit(this);
+    }
+
+    long long getSpilledRecords() const {
+        return spilledOuterRecords + spilledInnerRecords;
+    }
+
+    long long getSpilledBytesApprox() const {
+        return spilledOuterBytes + spilledInnerBytes;
+    }
+
+    bool usedDisk{false};
+    long long spilledOuterRecords{0};
+    long long spilledOuterBytes{0};
+    long long spilledInnerRecords{0};
+    long long spilledInnerBytes{0};
+    // The total number of spilled partitions created, including those created by recursive
+    // re-partitioning, and the deepest level of recursion that was reached.
+    long long numPartitions{0};
+    long long maxPartitionDepth{0};
+};
+
 struct HashLookupStats : public SpecificStats {
     std::unique_ptr<SpecificStats> clone() const final {
         return std::make_unique<HashLookupStats>(*this);
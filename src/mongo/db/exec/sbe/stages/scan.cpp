@@ -32,10 +32,12 @@
 #include "mongo/db/exec/sbe/stages/scan.h"
 
 #include "mongo/config.h"
+#include "mongo/db/catalog/collection_catalog.h"
 #include "mongo/db/exec/sbe/expressions/expression.h"
 #include "mongo/db/exec/sbe/size_estimator.h"
 #include "mongo/db/exec/trial_run_tracker.h"
 #include "mongo/db/index/index_access_method.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/repl/optime.h"
 #include "mongo/util/str.h"
 
@@ -277,6 +279,11 @@ void ScanStage::doAttachToOperationContext(OperationContext* opCtx) {
     }
 }
 
+void ScanStage::doBindCollection(const UUID& collUuid) {
+    tassert(7086760, "Cannot bind a collection to a prepared ScanStage", !_collName);
+    _collUuid = collUuid;
+}
+
 void ScanStage::doDetachFromTrialRunTracker() {
     _tracker = nullptr;
 }
@@ -339,10 +346,33 @@ void ScanStage::open(bool reOpen) {
         MONGO_UNREACHABLE_TASSERT(5959701);
     }
 
+    // Reading ahead is only done where the exact position of the cursor does not matter, as capped
+    // collections and the oplog can lose records behind the cursor.
+    _recordBatchSize = !_coll || _useRandomCursor || _coll->isCapped() ||
+            _coll->ns().isOplogOrChangeCollection()
+        ? 0
+        : static_cast<size_t>(internalQueryCollectionScanRecordBatchSize.load());
+    _recordBatch.clear();
+    _recordBatchPos = 0;
+
     _open = true;
     _firstGetNext = true;
 }
 
+boost::optional<Record> ScanStage::nextRecord() {
+    if (_recordBatchSize == 0) {
+        return _cursor->next();
+    }
+
+    if (_recordBatchPos == _recordBatch.size()) {
+        _recordBatchPos = 0;
+        if (_cursor->nextBatch(_recordBatchSize, &_recordBatch) == 0) {
+            return boost::none;
+        }
+    }
+    return _recordBatch[_recordBatchPos++];
+}
+
 PlanState ScanStage::getNext() {
     auto optTimer(getOptTimer(_opCtx));
 
@@ -368,7 +398,7 @@ PlanState ScanStage::getNext() {
 
     auto res = _firstGetNext && _seekKeyAccessor;
     auto nextRecord = _useRandomCursor ? _randomCursor->next()
-                                       : (res ? _cursor->seekExact(_key) : _cursor->next());
+                                       : (res ? _cursor->seekExact(_key) : nextRecord());
     _firstGetNext = false;
 
     if (!nextRecord) {
@@ -795,6 +825,11 @@ void ParallelScanStage::doAttachToOperationContext(OperationContext* opCtx) {
     }
 }
 
+void ParallelScanStage::doBindCollection(const UUID& collUuid) {
+    tassert(7086761, "Cannot bind a collection to a prepared ParallelScanStage", !_collName);
+    _collUuid = collUuid;
+}
+
 void ParallelScanStage::open(bool reOpen) {
     auto optTimer(getOptTimer(_opCtx));
 
@@ -846,16 +881,65 @@ void ParallelScanStage::open(bool reOpen) {
 
 boost::optional<Record> ParallelScanStage::nextRange() {
     invariant(_cursor);
-    _currentRange = _state->currentRange.fetchAndAdd(1);
-    if (_currentRange < _state->ranges.size()) {
+    while (true) {
+        _currentRange = _state->currentRange.fetchAndAdd(1);
+        if (_currentRange >= _state->ranges.size()) {
+            return boost::none;
+        }
         _range = _state->ranges[_currentRange];
 
-        return _range.begin.isNull() ? _cursor->next() : _cursor->seekExact(_range.begin);
-    } else {
-        return boost::none;
+        if (!_yieldPolicy) {
+            releaseSnapshotBetweenRanges();
+        }
+
+        // The records bounding the range may have been deleted since the ranges were computed, so
+        // position the cursor on the first record at or after the beginning of the range.
+        boost::optional<Record> record;
+        if (_range.begin.isNull()) {
+            record = _cursor->next();
+        } else {
+            record = _cursor->seekNear(_range.begin);
+            if (record && record->id < _range.begin) {
+                record = _cursor->next();
+            }
+        }
+
+        // Move on to the next range if this one is empty.
+        if (record && (_range.end.isNull() || record->id < _range.end)) {
+            return record;
+        }
     }
 }
 
+void ParallelScanStage::releaseSnapshotBetweenRanges() {
+    // A scan without a yield policy, such as the one run by an exchange producer, never yields.
+    // It gives up its storage snapshot between ranges instead, so that it neither pins old data
+    // for the duration of the whole scan nor misses a drop or a rename of the collection.
+    _cursor->save();
+    _opCtx->recoveryUnit()->abandonSnapshot();
+    _opCtx->checkForInterrupt();
+
+    tassert(5777410, "Collection name should be initialized", _collName);
+    tassert(5777411, "Catalog epoch should be initialized", _catalogEpoch);
+    auto latestCatalog = CollectionCatalog::get(_opCtx->getServiceContext());
+    auto latestColl = latestCatalog->lookupCollectionByUUID(_opCtx, _collUuid);
+    if (!latestColl) {
+        PlanYieldPolicy::throwCollectionDroppedError(_collUuid);
+    }
+    if (*_collName != latestColl->ns()) {
+        PlanYieldPolicy::throwCollectionRenamedError(*_collName, latestColl->ns(), _collUuid);
+    }
+    uassert(ErrorCodes::QueryPlanKilled,
+            "the catalog was closed and reopened",
+            latestCatalog->getEpoch() == *_catalogEpoch);
+
+    const bool couldRestore = _cursor->restore();
+    uassert(ErrorCodes::CappedPositionLost,
+            str::stream()
+                << "CollectionScan died due to position in capped collection being deleted. ",
+            couldRestore);
+}
+
 PlanState ParallelScanStage::getNext() {
     auto optTimer(getOptTimer(_opCtx));
 
@@ -892,7 +976,7 @@ PlanState ParallelScanStage::getNext() {
             return trackPlanState(PlanState::IS_EOF);
         }
 
-        if (!_range.end.isNull() && nextRecord->id == _range.end) {
+        if (!_range.end.isNull() && nextRecord->id >= _range.end) {
             setNeedsRange();
             nextRecord = boost::none;
             continue;
@@ -128,6 +128,7 @@ protected:
     void doRestoreState(bool relinquishCursor) override;
     void doDetachFromOperationContext() override;
     void doAttachToOperationContext(OperationContext* opCtx) override;
+    void doBindCollection(const UUID& collUuid) override;
     void doDetachFromTrialRunTracker() override;
     TrialRunTrackerAttachResultMask doAttachToTrialRunTracker(
         TrialRunTracker* tracker, TrialRunTrackerAttachResultMask childrenAttachResult) override;
@@ -136,7 +137,11 @@ private:
     // Returns the primary cursor or the random cursor depending on whether _useRandomCursor is set.
     RecordCursor* getActiveCursor() const;
 
-    const UUID _collUuid;
+    // Returns the next record from the primary cursor, reading records in batches of
+    // '_recordBatchSize' if it is non-zero, or boost::none at EOF.
+    boost::optional<Record> nextRecord();
+
+    UUID _collUuid;
     const boost::optional<value::SlotId> _recordSlot;
     const boost::optional<value::SlotId> _recordIdSlot;
     const boost::optional<value::SlotId> _snapshotIdSlot;
@@ -191,6 +196,13 @@ private:
     RecordId _key;
     bool _firstGetNext{false};
 
+    // The number of records to read from the primary cursor at a time, or zero to read them one by
+    // one. Set when the stage is opened. The records read ahead are buffered in '_recordBatch',
+    // from position '_recordBatchPos' on.
+    size_t _recordBatchSize{0};
+    RecordBatch _recordBatch;
+    size_t _recordBatchPos{0};
+
     ScanStats _specificStats;
 
     // Flag set upon restoring the stage that indicates whether the cursor's position in the
@@ -261,9 +273,11 @@ protected:
     void doRestoreState(bool fullSave) final;
     void doDetachFromOperationContext() final;
     void doAttachToOperationContext(OperationContext* opCtx) final;
+    void doBindCollection(const UUID& collUuid) final;
 
 private:
     boost::optional<Record> nextRange();
+    void releaseSnapshotBetweenRanges();
     bool needsRange() const {
         return _currentRange == std::numeric_limits<std::size_t>::max();
     }
@@ -271,7 +285,7 @@ private:
         _currentRange = std::numeric_limits<std::size_t>::max();
     }
 
-    const UUID _collUuid;
+    UUID _collUuid;
     const boost::optional<value::SlotId> _recordSlot;
     const boost::optional<value::SlotId> _recordIdSlot;
     const boost::optional<value::SlotId> _snapshotIdSlot;
@@ -39,6 +39,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/query/plan_yield_policy.h"
 #include "mongo/util/str.h"
+#include "mongo/util/uuid.h"
 
 namespace mongo {
 namespace sbe {
@@ -556,6 +557,18 @@ public:
      */
     virtual size_t estimateCompileTimeSize() const = 0;
 
+    /**
+     * Re-targets every stage in this tree which reads from a collection at the collection with
+     * the given UUID. Must be called before prepare(). This allows a plan compiled for one
+     * collection to be executed against another collection with identical indexes.
+     */
+    void bindCollection(const UUID& collUuid) {
+        for (auto&& child : _children) {
+            child->bindCollection(collUuid);
+        }
+        doBindCollection(collUuid);
+    }
+
     friend class CanSwitchOperationContext<PlanStage>;
     friend class CanChangeState<PlanStage>;
     friend class CanTrackStats<PlanStage>;
@@ -568,6 +581,7 @@ protected:
     virtual void doDetachFromOperationContext() {}
     virtual void doAttachToOperationContext(OperationContext* opCtx) {}
     virtual void doDetachFromTrialRunTracker() {}
+    virtual void doBindCollection(const UUID& collUuid) {}
     virtual TrialRunTrackerAttachResultMask doAttachToTrialRunTracker(
         TrialRunTracker* tracker, TrialRunTrackerAttachResultMask childrenAttachResult) {
         return TrialRunTrackerAttachResultFlags::NoAttachment;
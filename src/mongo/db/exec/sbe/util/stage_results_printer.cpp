@@ -114,6 +114,14 @@ struct PlanStatsSpecificStatsPrinter : PlanStatsVisitorBase<true> {
     // To avoid overloaded-virtual warnings.
     using PlanStatsConstVisitor::visit;
 
+    void visit(tree_walker::MaybeConstPtr<true, sbe::HashJoinStats> stats) override final {
+        _stream << "dsk:" << stats->usedDisk << "\n";
+        _stream << "outerRecs:" << stats->spilledOuterRecords << "\n";
+        _stream << "innerRecs:" << stats->spilledInnerRecords << "\n";
+        _stream << "partitions:" << stats->numPartitions << "\n";
+        _stream << "depth:" << stats->maxPartitionDepth << "\n";
+    }
+
     void visit(tree_walker::MaybeConstPtr<true, sbe::HashLookupStats> stats) override final {
         _stream << "dsk:" << stats->usedDisk << "\n";
         _stream << "htRecs:" << stats->spilledHtRecords << "\n";
@@ -505,6 +505,54 @@ void ByteCode::aggDoubleDoubleSumImpl(value::Array* arr,
     }
 }
 
+void ByteCode::aggMergeDoubleDoubleSumsImpl(value::Array* arr, const value::Array* partialArr) {
+    tassert(7086731,
+            str::stream() << "The partial sum must have at least "
+                          << AggSumValueElems::kMaxSizeOfArray - 1
+                          << " elements but got: " << partialArr->size(),
+            partialArr->size() >= AggSumValueElems::kMaxSizeOfArray - 1);
+
+    auto [nonDecimalTotalTag, _] = arr->getAt(AggSumValueElems::kNonDecimalTotalTag);
+    auto partialTotalTag = partialArr->getAt(AggSumValueElems::kNonDecimalTotalTag).first;
+    auto [sumTag, sum] = arr->getAt(AggSumValueElems::kNonDecimalTotalSum);
+    auto [addendTag, addend] = arr->getAt(AggSumValueElems::kNonDecimalTotalAddend);
+    auto [partialSumTag, partialSum] = partialArr->getAt(AggSumValueElems::kNonDecimalTotalSum);
+    auto [partialAddendTag, partialAddend] =
+        partialArr->getAt(AggSumValueElems::kNonDecimalTotalAddend);
+    tassert(7086732,
+            "The sum and addend must be NumberDouble",
+            sumTag == TypeTags::NumberDouble && addendTag == TypeTags::NumberDouble &&
+                partialSumTag == TypeTags::NumberDouble &&
+                partialAddendTag == TypeTags::NumberDouble);
+
+    // Both double-double pairs are exact representations of their totals, so adding the four
+    // components loses no more precision than summing all of the inputs in a single group would.
+    auto nonDecimalTotal = DoubleDoubleSummation::create(value::bitcastTo<double>(sum),
+                                                         value::bitcastTo<double>(addend));
+    nonDecimalTotal.addDouble(value::bitcastTo<double>(partialSum));
+    nonDecimalTotal.addDouble(value::bitcastTo<double>(partialAddend));
+    nonDecimalTotalTag = getWidestNumericalType(nonDecimalTotalTag, partialTotalTag);
+
+    if (partialArr->size() < AggSumValueElems::kMaxSizeOfArray &&
+        arr->size() < AggSumValueElems::kMaxSizeOfArray) {
+        // Neither side has seen a decimal value.
+        setNonDecimalTotal(nonDecimalTotalTag, nonDecimalTotal, arr);
+        return;
+    }
+
+    auto decimalTotal = Decimal128{};
+    for (auto total : {static_cast<const value::Array*>(arr), partialArr}) {
+        if (total->size() == AggSumValueElems::kMaxSizeOfArray) {
+            auto [decimalTotalTag, decimalTotalVal] = total->getAt(AggSumValueElems::kDecimalTotal);
+            tassert(7086733,
+                    "The decimalTotal must be NumberDecimal",
+                    decimalTotalTag == TypeTags::NumberDecimal);
+            decimalTotal = decimalTotal.add(value::bitcastTo<Decimal128>(decimalTotalVal));
+        }
+    }
+    setDecimalTotal(nonDecimalTotalTag, nonDecimalTotal, decimalTotal, arr);
+}
+
 void ByteCode::aggStdDevImpl(value::Array* arr, value::TypeTags rhsTag, value::Value rhsValue) {
     if (!isNumber(rhsTag)) {
         return;
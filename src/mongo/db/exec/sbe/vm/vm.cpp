@@ -155,6 +155,14 @@ int Instruction::stackOffset[Instruction::Tags::lastInstruction] = {
     -1,  // fail
 
     0,  // applyClassicMatcher
+
+    1,  // pushAccessValGetFieldConst
+    0,  // eqConst
+    0,  // neqConst
+    0,  // lessConst
+    0,  // lessEqConst
+    0,  // greaterConst
+    0,  // greaterEqConst
 };
 
 namespace {
@@ -268,7 +276,13 @@ std::string CodeFragment::toString() const {
                 break;
             }
             // Instructions with other kinds of arguments.
-            case Instruction::pushConstVal: {
+            case Instruction::pushConstVal:
+            case Instruction::eqConst:
+            case Instruction::neqConst:
+            case Instruction::lessConst:
+            case Instruction::lessEqConst:
+            case Instruction::greaterConst:
+            case Instruction::greaterEqConst: {
                 auto tag = readFromMemory<value::TypeTags>(pcPointer);
                 pcPointer += sizeof(tag);
                 auto val = readFromMemory<value::Value>(pcPointer);
@@ -276,6 +290,17 @@ std::string CodeFragment::toString() const {
                 ss << "value: " << std::make_pair(tag, val);
                 break;
             }
+            case Instruction::pushAccessValGetFieldConst: {
+                auto accessor = readFromMemory<value::SlotAccessor*>(pcPointer);
+                pcPointer += sizeof(accessor);
+                auto tag = readFromMemory<value::TypeTags>(pcPointer);
+                pcPointer += sizeof(tag);
+                auto val = readFromMemory<value::Value>(pcPointer);
+                pcPointer += sizeof(val);
+                ss << "accessor: " << static_cast<void*>(accessor)
+                   << ", field: " << std::make_pair(tag, val);
+                break;
+            }
             case Instruction::pushAccessVal:
             case Instruction::pushMoveVal: {
                 auto accessor = readFromMemory<value::SlotAccessor*>(pcPointer);
@@ -503,6 +528,20 @@ void CodeFragment::appendSimpleInstruction(Instruction::Tags tag) {
     offset += writeToMemory(offset, i);
 }
 
+void CodeFragment::appendConstInstruction(Instruction::Tags tag,
+                                          value::TypeTags constTag,
+                                          value::Value val) {
+    Instruction i;
+    i.tag = tag;
+    adjustStackSimple(i);
+
+    auto offset = allocateSpace(sizeof(Instruction) + sizeof(constTag) + sizeof(val));
+
+    offset += writeToMemory(offset, i);
+    offset += writeToMemory(offset, constTag);
+    offset += writeToMemory(offset, val);
+}
+
 void CodeFragment::appendFillEmpty(Instruction::Constants k) {
     Instruction i;
     i.tag = Instruction::fillEmptyConst;
@@ -532,6 +571,24 @@ void CodeFragment::appendGetField(value::TypeTags tag, value::Value val) {
     offset += writeToMemory(offset, val);
 }
 
+void CodeFragment::appendGetField(value::SlotAccessor* accessor,
+                                  value::TypeTags tag,
+                                  value::Value val) {
+    invariant(value::isString(tag));
+
+    Instruction i;
+    i.tag = Instruction::pushAccessValGetFieldConst;
+    adjustStackSimple(i);
+
+    auto offset =
+        allocateSpace(sizeof(Instruction) + sizeof(accessor) + sizeof(tag) + sizeof(val));
+
+    offset += writeToMemory(offset, i);
+    offset += writeToMemory(offset, accessor);
+    offset += writeToMemory(offset, tag);
+    offset += writeToMemory(offset, val);
+}
+
 void CodeFragment::appendGetElement() {
     appendSimpleInstruction(Instruction::getElement);
 }
@@ -1202,6 +1259,32 @@ std::tuple<bool, value::TypeTags, value::Value> ByteCode::builtinAggDoubleDouble
     return {true, accTag, accValue};
 }
 
+std::tuple<bool, value::TypeTags, value::Value> ByteCode::builtinAggMergeDoubleDoubleSums(
+    ArityType arity) {
+    auto [_, fieldTag, fieldValue] = getFromStack(1);
+    // Move the incoming accumulator state from the stack. Given that we are now the owner of the
+    // state we are free to do any in-place update as we see fit.
+    auto [accTag, accValue] = moveOwnedFromStack(0);
+    value::ValueGuard guard{accTag, accValue};
+
+    // A partial result is missing if it was produced by a group that had no numeric input at all.
+    if (fieldTag != value::TypeTags::Array) {
+        guard.reset();
+        return {true, accTag, accValue};
+    }
+
+    // Initialize the accumulator with the first partial result.
+    if (accTag == value::TypeTags::Nothing) {
+        auto [tag, val] = value::copyValue(fieldTag, fieldValue);
+        return {true, tag, val};
+    }
+    tassert(7086730, "The result slot must be Array-typed", accTag == value::TypeTags::Array);
+
+    aggMergeDoubleDoubleSumsImpl(value::getArrayView(accValue), value::getArrayView(fieldValue));
+    guard.reset();
+    return {true, accTag, accValue};
+}
+
 // This function is necessary because 'aggDoubleDoubleSum()' result is 'Array' type but we need
 // to produce a scalar value out of it.
 std::tuple<bool, value::TypeTags, value::Value> ByteCode::builtinDoubleDoubleSumFinalize(
@@ -4575,6 +4658,8 @@ std::tuple<bool, value::TypeTags, value::Value> ByteCode::dispatchBuiltin(Builti
             return builtinDoubleDoubleSum(arity);
         case Builtin::aggDoubleDoubleSum:
             return builtinAggDoubleDoubleSum(arity);
+        case Builtin::aggMergeDoubleDoubleSums:
+            return builtinAggMergeDoubleDoubleSums(arity);
         case Builtin::doubleDoubleSumFinalize:
             return builtinDoubleDoubleSumFinalize(arity);
         case Builtin::doubleDoublePartialSumFinalize:
@@ -4743,18 +4828,137 @@ std::tuple<bool, value::TypeTags, value::Value> ByteCode::runLambdaInternal(
     return {retOwn, retTag, retVal};
 }
 
+/**
+ * When the compiler supports taking the address of a label, the interpreter loop uses threaded
+ * dispatch: every instruction handler ends with its own indirect jump to the handler of the next
+ * instruction through 'kDispatchTable'. Compared to returning to a single 'switch' this avoids the
+ * range check of the jump table and gives the branch predictor a separate history for each
+ * handler, so it can learn the common instruction sequences. Otherwise 'MONGO_SBE_VM_NEXT()' just
+ * leaves the 'switch'.
+ */
+#if defined(__GNUC__)
+#define MONGO_SBE_VM_THREADED_DISPATCH 1
+#define MONGO_SBE_VM_CASE(name) \
+    case Instruction::name:     \
+    label_##name:
+#define MONGO_SBE_VM_NEXT()                         \
+    do {                                            \
+        if (pcPointer == pcEnd) {                   \
+            return;                                 \
+        }                                           \
+        i = readFromMemory<Instruction>(pcPointer); \
+        pcPointer += sizeof(i);                     \
+        goto* kDispatchTable[i.tag];                \
+    } while (false)
+#else
+#define MONGO_SBE_VM_THREADED_DISPATCH 0
+#define MONGO_SBE_VM_CASE(name) case Instruction::name:
+#define MONGO_SBE_VM_NEXT() break
+#endif
+
 void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
     auto pcPointer = code->instrs().data() + position;
     auto pcEnd = pcPointer + code->instrs().size();
 
+#if MONGO_SBE_VM_THREADED_DISPATCH
+    // This table must be kept in sync with Instruction::Tags.
+    static const void* const kDispatchTable[] = {
+        &&label_pushConstVal,
+        &&label_pushAccessVal,
+        &&label_pushMoveVal,
+        &&label_pushLocalVal,
+        &&label_pushMoveLocalVal,
+        &&label_pushLocalLambda,
+        &&label_pop,
+        &&label_swap,
+        &&label_add,
+        &&label_sub,
+        &&label_mul,
+        &&label_div,
+        &&label_idiv,
+        &&label_mod,
+        &&label_negate,
+        &&label_numConvert,
+        &&label_logicNot,
+        &&label_less,
+        &&label_lessEq,
+        &&label_greater,
+        &&label_greaterEq,
+        &&label_eq,
+        &&label_neq,
+        &&label_cmp3w,
+        &&label_collLess,
+        &&label_collLessEq,
+        &&label_collGreater,
+        &&label_collGreaterEq,
+        &&label_collEq,
+        &&label_collNeq,
+        &&label_collCmp3w,
+        &&label_fillEmpty,
+        &&label_fillEmptyConst,
+        &&label_getField,
+        &&label_getFieldConst,
+        &&label_getElement,
+        &&label_collComparisonKey,
+        &&label_getFieldOrElement,
+        &&label_traverseP,
+        &&label_traversePConst,
+        &&label_traverseF,
+        &&label_traverseFConst,
+        &&label_setField,
+        &&label_getArraySize,
+        &&label_aggSum,
+        &&label_aggMin,
+        &&label_aggMax,
+        &&label_aggFirst,
+        &&label_aggLast,
+        &&label_aggCollMin,
+        &&label_aggCollMax,
+        &&label_exists,
+        &&label_isNull,
+        &&label_isObject,
+        &&label_isArray,
+        &&label_isString,
+        &&label_isNumber,
+        &&label_isBinData,
+        &&label_isDate,
+        &&label_isNaN,
+        &&label_isInfinity,
+        &&label_isRecordId,
+        &&label_isMinKey,
+        &&label_isMaxKey,
+        &&label_isTimestamp,
+        &&label_function,
+        &&label_functionSmall,
+        &&label_jmp,
+        &&label_jmpTrue,
+        &&label_jmpNothing,
+        &&label_ret,
+        &&label_fail,
+        &&label_applyClassicMatcher,
+        &&label_pushAccessValGetFieldConst,
+        &&label_eqConst,
+        &&label_neqConst,
+        &&label_lessConst,
+        &&label_lessEqConst,
+        &&label_greaterConst,
+        &&label_greaterEqConst,
+    };
+    static_assert(sizeof(kDispatchTable) / sizeof(kDispatchTable[0]) ==
+                  Instruction::lastInstruction);
+#endif
+
     for (;;) {
         if (pcPointer == pcEnd) {
             break;
         } else {
             Instruction i = readFromMemory<Instruction>(pcPointer);
             pcPointer += sizeof(i);
+#if MONGO_SBE_VM_THREADED_DISPATCH
+            goto* kDispatchTable[i.tag];
+#endif
             switch (i.tag) {
-                case Instruction::pushConstVal: {
+                MONGO_SBE_VM_CASE(pushConstVal) {
                     auto tag = readFromMemory<value::TypeTags>(pcPointer);
                     pcPointer += sizeof(tag);
                     auto val = readFromMemory<value::Value>(pcPointer);
@@ -4762,27 +4966,27 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
 
                     pushStack(false, tag, val);
 
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::pushAccessVal: {
+                MONGO_SBE_VM_CASE(pushAccessVal) {
                     auto accessor = readFromMemory<value::SlotAccessor*>(pcPointer);
                     pcPointer += sizeof(accessor);
 
                     auto [tag, val] = accessor->getViewOfValue();
                     pushStack(false, tag, val);
 
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::pushMoveVal: {
+                MONGO_SBE_VM_CASE(pushMoveVal) {
                     auto accessor = readFromMemory<value::SlotAccessor*>(pcPointer);
                     pcPointer += sizeof(accessor);
 
                     auto [tag, val] = accessor->copyOrMoveValue();
                     pushStack(true, tag, val);
 
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::pushLocalVal: {
+                MONGO_SBE_VM_CASE(pushLocalVal) {
                     auto stackOffset = readFromMemory<int>(pcPointer);
                     pcPointer += sizeof(stackOffset);
 
@@ -4790,9 +4994,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
 
                     pushStack(false, tag, val);
 
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::pushMoveLocalVal: {
+                MONGO_SBE_VM_CASE(pushMoveLocalVal) {
                     auto stackOffset = readFromMemory<int>(pcPointer);
                     pcPointer += sizeof(stackOffset);
 
@@ -4801,9 +5005,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
 
                     pushStack(owned, tag, val);
 
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::pushLocalLambda: {
+                MONGO_SBE_VM_CASE(pushLocalLambda) {
                     auto offset = readFromMemory<int>(pcPointer);
                     pcPointer += sizeof(offset);
                     auto newPosition = pcPointer - code->instrs().data() + offset;
@@ -4811,9 +5015,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     pushStack(false,
                               value::TypeTags::LocalLambda,
                               value::bitcastFrom<int64_t>(newPosition));
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::pop: {
+                MONGO_SBE_VM_CASE(pop) {
                     auto [owned, tag, val] = getFromStack(0);
                     popStack();
 
@@ -4821,13 +5025,13 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                         value::releaseValue(tag, val);
                     }
 
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::swap: {
+                MONGO_SBE_VM_CASE(swap) {
                     swapStack();
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::add: {
+                MONGO_SBE_VM_CASE(add) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -4842,9 +5046,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (lhsOwned) {
                         value::releaseValue(lhsTag, lhsVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::sub: {
+                MONGO_SBE_VM_CASE(sub) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -4859,9 +5063,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (lhsOwned) {
                         value::releaseValue(lhsTag, lhsVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::mul: {
+                MONGO_SBE_VM_CASE(mul) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -4876,9 +5080,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (lhsOwned) {
                         value::releaseValue(lhsTag, lhsVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::div: {
+                MONGO_SBE_VM_CASE(div) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -4893,9 +5097,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (lhsOwned) {
                         value::releaseValue(lhsTag, lhsVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::idiv: {
+                MONGO_SBE_VM_CASE(idiv) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -4910,9 +5114,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (lhsOwned) {
                         value::releaseValue(lhsTag, lhsVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::mod: {
+                MONGO_SBE_VM_CASE(mod) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -4927,9 +5131,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (lhsOwned) {
                         value::releaseValue(lhsTag, lhsVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::negate: {
+                MONGO_SBE_VM_CASE(negate) {
                     auto [owned, tag, val] = getFromStack(0);
 
                     auto [resultOwned, resultTag, resultVal] = genericSub(
@@ -4941,9 +5145,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                         value::releaseValue(resultTag, resultVal);
                     }
 
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::numConvert: {
+                MONGO_SBE_VM_CASE(numConvert) {
                     auto tag = readFromMemory<value::TypeTags>(pcPointer);
                     pcPointer += sizeof(tag);
 
@@ -4957,9 +5161,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                         value::releaseValue(lhsTag, lhsVal);
                     }
 
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::logicNot: {
+                MONGO_SBE_VM_CASE(logicNot) {
                     auto [owned, tag, val] = getFromStack(0);
 
                     auto [resultTag, resultVal] = genericNot(tag, val);
@@ -4969,9 +5173,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (owned) {
                         value::releaseValue(tag, val);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::less: {
+                MONGO_SBE_VM_CASE(less) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -4986,9 +5190,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (lhsOwned) {
                         value::releaseValue(lhsTag, lhsVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::collLess: {
+                MONGO_SBE_VM_CASE(collLess) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -5009,9 +5213,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (collOwned) {
                         value::releaseValue(collTag, collVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::lessEq: {
+                MONGO_SBE_VM_CASE(lessEq) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -5027,9 +5231,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (lhsOwned) {
                         value::releaseValue(lhsTag, lhsVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::collLessEq: {
+                MONGO_SBE_VM_CASE(collLessEq) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -5050,9 +5254,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (collOwned) {
                         value::releaseValue(collTag, collVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::greater: {
+                MONGO_SBE_VM_CASE(greater) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -5068,9 +5272,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (lhsOwned) {
                         value::releaseValue(lhsTag, lhsVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::collGreater: {
+                MONGO_SBE_VM_CASE(collGreater) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -5091,9 +5295,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (collOwned) {
                         value::releaseValue(collTag, collVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::greaterEq: {
+                MONGO_SBE_VM_CASE(greaterEq) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -5109,9 +5313,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (lhsOwned) {
                         value::releaseValue(lhsTag, lhsVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::collGreaterEq: {
+                MONGO_SBE_VM_CASE(collGreaterEq) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -5132,9 +5336,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (collOwned) {
                         value::releaseValue(collTag, collVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::eq: {
+                MONGO_SBE_VM_CASE(eq) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -5150,9 +5354,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (lhsOwned) {
                         value::releaseValue(lhsTag, lhsVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::collEq: {
+                MONGO_SBE_VM_CASE(collEq) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -5173,9 +5377,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (collOwned) {
                         value::releaseValue(collTag, collVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::neq: {
+                MONGO_SBE_VM_CASE(neq) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -5192,9 +5396,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (lhsOwned) {
                         value::releaseValue(lhsTag, lhsVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::collNeq: {
+                MONGO_SBE_VM_CASE(collNeq) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -5216,9 +5420,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (collOwned) {
                         value::releaseValue(collTag, collVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::cmp3w: {
+                MONGO_SBE_VM_CASE(cmp3w) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -5233,9 +5437,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (lhsOwned) {
                         value::releaseValue(lhsTag, lhsVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::collCmp3w: {
+                MONGO_SBE_VM_CASE(collCmp3w) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -5255,9 +5459,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (collOwned) {
                         value::releaseValue(collTag, collVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::fillEmpty: {
+                MONGO_SBE_VM_CASE(fillEmpty) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -5273,9 +5477,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                             value::releaseValue(rhsTag, rhsVal);
                         }
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::fillEmptyConst: {
+                MONGO_SBE_VM_CASE(fillEmptyConst) {
                     auto k = readFromMemory<Instruction::Constants>(pcPointer);
                     pcPointer += sizeof(k);
 
@@ -5299,9 +5503,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                                 MONGO_UNREACHABLE;
                         }
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::getField: {
+                MONGO_SBE_VM_CASE(getField) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -5316,9 +5520,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (lhsOwned) {
                         value::releaseValue(lhsTag, lhsVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::getFieldConst: {
+                MONGO_SBE_VM_CASE(getFieldConst) {
                     auto tagField = readFromMemory<value::TypeTags>(pcPointer);
                     pcPointer += sizeof(tagField);
                     auto valField = readFromMemory<value::Value>(pcPointer);
@@ -5334,9 +5538,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (lhsOwned) {
                         value::releaseValue(lhsTag, lhsVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::getElement: {
+                MONGO_SBE_VM_CASE(getElement) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -5351,9 +5555,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (lhsOwned) {
                         value::releaseValue(lhsTag, lhsVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::getArraySize: {
+                MONGO_SBE_VM_CASE(getArraySize) {
                     auto [owned, tag, val] = getFromStack(0);
                     auto [resultOwned, resultTag, resultVal] = getArraySize(tag, val);
                     topStack(resultOwned, resultTag, resultVal);
@@ -5361,9 +5565,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (owned) {
                         value::releaseValue(tag, val);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::collComparisonKey: {
+                MONGO_SBE_VM_CASE(collComparisonKey) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -5391,9 +5595,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (lhsOwned) {
                         value::releaseValue(lhsTag, lhsVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::getFieldOrElement: {
+                MONGO_SBE_VM_CASE(getFieldOrElement) {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
                     auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
@@ -5408,15 +5612,15 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (lhsOwned) {
                         value::releaseValue(lhsTag, lhsVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::traverseP: {
+                MONGO_SBE_VM_CASE(traverseP) {
                     auto [owned, tag, val] = traverseP(code);
 
                     pushStack(owned, tag, val);
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::traversePConst: {
+                MONGO_SBE_VM_CASE(traversePConst) {
                     auto offset = readFromMemory<int>(pcPointer);
                     pcPointer += sizeof(offset);
                     auto codePosition = pcPointer - code->instrs().data() + offset;
@@ -5424,15 +5628,15 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     auto [owned, tag, val] = traverseP(code, codePosition);
 
                     pushStack(owned, tag, val);
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::traverseF: {
+                MONGO_SBE_VM_CASE(traverseF) {
                     auto [owned, tag, val] = traverseF(code);
 
                     pushStack(owned, tag, val);
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::traverseFConst: {
+                MONGO_SBE_VM_CASE(traverseFConst) {
                     auto k = readFromMemory<Instruction::Constants>(pcPointer);
                     pcPointer += sizeof(k);
 
@@ -5444,18 +5648,18 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                         traverseF(code, codePosition, k == Instruction::True ? true : false);
 
                     pushStack(owned, tag, val);
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::setField: {
+                MONGO_SBE_VM_CASE(setField) {
                     auto [owned, tag, val] = setField();
                     popAndReleaseStack();
                     popAndReleaseStack();
                     popAndReleaseStack();
 
                     pushStack(owned, tag, val);
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::aggSum: {
+                MONGO_SBE_VM_CASE(aggSum) {
                     auto [fieldOwned, fieldTag, fieldVal] = getFromStack(0);
                     popStack();
                     auto [accOwned, accTag, accVal] = getFromStack(0);
@@ -5470,9 +5674,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (accOwned) {
                         value::releaseValue(accTag, accVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::aggMin: {
+                MONGO_SBE_VM_CASE(aggMin) {
                     auto [fieldOwned, fieldTag, fieldVal] = getFromStack(0);
                     popStack();
                     auto [accOwned, accTag, accVal] = getFromStack(0);
@@ -5487,9 +5691,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (accOwned) {
                         value::releaseValue(accTag, accVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::aggCollMin: {
+                MONGO_SBE_VM_CASE(aggCollMin) {
                     auto [fieldOwned, fieldTag, fieldVal] = getFromStack(0);
                     popStack();
                     auto [collOwned, collTag, collVal] = getFromStack(0);
@@ -5517,9 +5721,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (accOwned) {
                         value::releaseValue(accTag, accVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::aggMax: {
+                MONGO_SBE_VM_CASE(aggMax) {
                     auto [fieldOwned, fieldTag, fieldVal] = getFromStack(0);
                     popStack();
                     auto [accOwned, accTag, accVal] = getFromStack(0);
@@ -5534,9 +5738,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (accOwned) {
                         value::releaseValue(accTag, accVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::aggCollMax: {
+                MONGO_SBE_VM_CASE(aggCollMax) {
                     auto [fieldOwned, fieldTag, fieldVal] = getFromStack(0);
                     popStack();
                     auto [collOwned, collTag, collVal] = getFromStack(0);
@@ -5564,9 +5768,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (accOwned) {
                         value::releaseValue(accTag, accVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::aggFirst: {
+                MONGO_SBE_VM_CASE(aggFirst) {
                     auto [fieldOwned, fieldTag, fieldVal] = getFromStack(0);
                     popStack();
                     auto [accOwned, accTag, accVal] = getFromStack(0);
@@ -5581,9 +5785,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (accOwned) {
                         value::releaseValue(accTag, accVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::aggLast: {
+                MONGO_SBE_VM_CASE(aggLast) {
                     auto [fieldOwned, fieldTag, fieldVal] = getFromStack(0);
                     popStack();
                     auto [accOwned, accTag, accVal] = getFromStack(0);
@@ -5598,9 +5802,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (accOwned) {
                         value::releaseValue(accTag, accVal);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::exists: {
+                MONGO_SBE_VM_CASE(exists) {
                     auto [owned, tag, val] = getFromStack(0);
 
                     topStack(false,
@@ -5610,9 +5814,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (owned) {
                         value::releaseValue(tag, val);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::isNull: {
+                MONGO_SBE_VM_CASE(isNull) {
                     auto [owned, tag, val] = getFromStack(0);
 
                     if (tag != value::TypeTags::Nothing) {
@@ -5624,9 +5828,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (owned) {
                         value::releaseValue(tag, val);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::isObject: {
+                MONGO_SBE_VM_CASE(isObject) {
                     auto [owned, tag, val] = getFromStack(0);
 
                     if (tag != value::TypeTags::Nothing) {
@@ -5638,9 +5842,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (owned) {
                         value::releaseValue(tag, val);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::isArray: {
+                MONGO_SBE_VM_CASE(isArray) {
                     auto [owned, tag, val] = getFromStack(0);
 
                     if (tag != value::TypeTags::Nothing) {
@@ -5652,9 +5856,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (owned) {
                         value::releaseValue(tag, val);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::isString: {
+                MONGO_SBE_VM_CASE(isString) {
                     auto [owned, tag, val] = getFromStack(0);
 
                     if (tag != value::TypeTags::Nothing) {
@@ -5666,9 +5870,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (owned) {
                         value::releaseValue(tag, val);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::isNumber: {
+                MONGO_SBE_VM_CASE(isNumber) {
                     auto [owned, tag, val] = getFromStack(0);
 
                     if (tag != value::TypeTags::Nothing) {
@@ -5680,9 +5884,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (owned) {
                         value::releaseValue(tag, val);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::isBinData: {
+                MONGO_SBE_VM_CASE(isBinData) {
                     auto [owned, tag, val] = getFromStack(0);
 
                     if (tag != value::TypeTags::Nothing) {
@@ -5694,9 +5898,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (owned) {
                         value::releaseValue(tag, val);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::isDate: {
+                MONGO_SBE_VM_CASE(isDate) {
                     auto [owned, tag, val] = getFromStack(0);
 
                     if (tag != value::TypeTags::Nothing) {
@@ -5708,9 +5912,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (owned) {
                         value::releaseValue(tag, val);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::isNaN: {
+                MONGO_SBE_VM_CASE(isNaN) {
                     auto [owned, tag, val] = getFromStack(0);
 
                     if (tag != value::TypeTags::Nothing) {
@@ -5722,9 +5926,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (owned) {
                         value::releaseValue(tag, val);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::isInfinity: {
+                MONGO_SBE_VM_CASE(isInfinity) {
                     auto [owned, tag, val] = getFromStack(0);
                     if (tag != value::TypeTags::Nothing) {
                         topStack(false,
@@ -5734,9 +5938,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (owned) {
                         value::releaseValue(tag, val);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::isRecordId: {
+                MONGO_SBE_VM_CASE(isRecordId) {
                     auto [owned, tag, val] = getFromStack(0);
 
                     if (tag != value::TypeTags::Nothing) {
@@ -5748,9 +5952,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (owned) {
                         value::releaseValue(tag, val);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::isMinKey: {
+                MONGO_SBE_VM_CASE(isMinKey) {
                     auto [owned, tag, val] = getFromStack(0);
 
                     if (tag != value::TypeTags::Nothing) {
@@ -5762,9 +5966,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (owned) {
                         value::releaseValue(tag, val);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::isMaxKey: {
+                MONGO_SBE_VM_CASE(isMaxKey) {
                     auto [owned, tag, val] = getFromStack(0);
 
                     if (tag != value::TypeTags::Nothing) {
@@ -5776,9 +5980,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (owned) {
                         value::releaseValue(tag, val);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::isTimestamp: {
+                MONGO_SBE_VM_CASE(isTimestamp) {
                     auto [owned, tag, val] = getFromStack(0);
 
                     if (tag != value::TypeTags::Nothing) {
@@ -5790,10 +5994,10 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (owned) {
                         value::releaseValue(tag, val);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::function:
-                case Instruction::functionSmall: {
+                MONGO_SBE_VM_CASE(function)
+                MONGO_SBE_VM_CASE(functionSmall) {
                     auto f = readFromMemory<Builtin>(pcPointer);
                     pcPointer += sizeof(f);
                     ArityType arity{0};
@@ -5813,16 +6017,16 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
 
                     pushStack(owned, tag, val);
 
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::jmp: {
+                MONGO_SBE_VM_CASE(jmp) {
                     auto jumpOffset = readFromMemory<int>(pcPointer);
                     pcPointer += sizeof(jumpOffset);
 
                     pcPointer += jumpOffset;
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::jmpTrue: {
+                MONGO_SBE_VM_CASE(jmpTrue) {
                     auto jumpOffset = readFromMemory<int>(pcPointer);
                     pcPointer += sizeof(jumpOffset);
 
@@ -5836,9 +6040,9 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (owned) {
                         value::releaseValue(tag, val);
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::jmpNothing: {
+                MONGO_SBE_VM_CASE(jmpNothing) {
                     auto jumpOffset = readFromMemory<int>(pcPointer);
                     pcPointer += sizeof(jumpOffset);
 
@@ -5846,13 +6050,13 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     if (tag == value::TypeTags::Nothing) {
                         pcPointer += jumpOffset;
                     }
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::ret: {
+                MONGO_SBE_VM_CASE(ret) {
                     pcPointer = pcEnd;
-                    break;
+                    MONGO_SBE_VM_NEXT();
                 }
-                case Instruction::fail: {
+                MONGO_SBE_VM_CASE(fail) {
                     auto [ownedCode, tagCode, valCode] = getFromStack(1);
                     invariant(tagCode == value::TypeTags::NumberInt64);
 
@@ -5867,7 +6071,7 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
 
                     break;
                 }
-                case Instruction::applyClassicMatcher: {
+                MONGO_SBE_VM_CASE(applyClassicMatcher) {
                     const auto* matcher = readFromMemory<const MatchExpression*>(pcPointer);
                     pcPointer += sizeof(matcher);
 
@@ -5890,8 +6094,83 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                         value::releaseValue(tagObj, valObj);
                     }
                     topStack(false, value::TypeTags::Boolean, value::bitcastFrom<bool>(res));
+                    // A computed goto would skip the destructor of 'bsonObjForMatching', so leave
+                    // the 'switch' instead.
                     break;
                 }
+                MONGO_SBE_VM_CASE(pushAccessValGetFieldConst) {
+                    auto accessor = readFromMemory<value::SlotAccessor*>(pcPointer);
+                    pcPointer += sizeof(accessor);
+                    auto tagField = readFromMemory<value::TypeTags>(pcPointer);
+                    pcPointer += sizeof(tagField);
+                    auto valField = readFromMemory<value::Value>(pcPointer);
+                    pcPointer += sizeof(valField);
+
+                    auto [objTag, objVal] = accessor->getViewOfValue();
+                    auto [owned, tag, val] =
+                        getField(objTag, objVal, value::getStringView(tagField, valField));
+
+                    pushStack(owned, tag, val);
+                    MONGO_SBE_VM_NEXT();
+                }
+                MONGO_SBE_VM_CASE(eqConst) {
+                    auto rhsTag = readFromMemory<value::TypeTags>(pcPointer);
+                    pcPointer += sizeof(rhsTag);
+                    auto rhsVal = readFromMemory<value::Value>(pcPointer);
+                    pcPointer += sizeof(rhsVal);
+
+                    runCompareConst<std::equal_to<>>(rhsTag, rhsVal);
+                    MONGO_SBE_VM_NEXT();
+                }
+                MONGO_SBE_VM_CASE(neqConst) {
+                    auto rhsTag = readFromMemory<value::TypeTags>(pcPointer);
+                    pcPointer += sizeof(rhsTag);
+                    auto rhsVal = readFromMemory<value::Value>(pcPointer);
+                    pcPointer += sizeof(rhsVal);
+
+                    runCompareConst<std::equal_to<>>(rhsTag, rhsVal);
+
+                    auto [owned, tag, val] = getFromStack(0);
+                    std::tie(tag, val) = genericNot(tag, val);
+                    topStack(false, tag, val);
+                    MONGO_SBE_VM_NEXT();
+                }
+                MONGO_SBE_VM_CASE(lessConst) {
+                    auto rhsTag = readFromMemory<value::TypeTags>(pcPointer);
+                    pcPointer += sizeof(rhsTag);
+                    auto rhsVal = readFromMemory<value::Value>(pcPointer);
+                    pcPointer += sizeof(rhsVal);
+
+                    runCompareConst<std::less<>>(rhsTag, rhsVal);
+                    MONGO_SBE_VM_NEXT();
+                }
+                MONGO_SBE_VM_CASE(lessEqConst) {
+                    auto rhsTag = readFromMemory<value::TypeTags>(pcPointer);
+                    pcPointer += sizeof(rhsTag);
+                    auto rhsVal = readFromMemory<value::Value>(pcPointer);
+                    pcPointer += sizeof(rhsVal);
+
+                    runCompareConst<std::less_equal<>>(rhsTag, rhsVal);
+                    MONGO_SBE_VM_NEXT();
+                }
+                MONGO_SBE_VM_CASE(greaterConst) {
+                    auto rhsTag = readFromMemory<value::TypeTags>(pcPointer);
+                    pcPointer += sizeof(rhsTag);
+                    auto rhsVal = readFromMemory<value::Value>(pcPointer);
+                    pcPointer += sizeof(rhsVal);
+
+                    runCompareConst<std::greater<>>(rhsTag, rhsVal);
+                    MONGO_SBE_VM_NEXT();
+                }
+                MONGO_SBE_VM_CASE(greaterEqConst) {
+                    auto rhsTag = readFromMemory<value::TypeTags>(pcPointer);
+                    pcPointer += sizeof(rhsTag);
+                    auto rhsVal = readFromMemory<value::Value>(pcPointer);
+                    pcPointer += sizeof(rhsVal);
+
+                    runCompareConst<std::greater_equal<>>(rhsTag, rhsVal);
+                    MONGO_SBE_VM_NEXT();
+                }
                 default:
                     MONGO_UNREACHABLE;
             }
@@ -5899,6 +6178,10 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
     }
 }
 
+#undef MONGO_SBE_VM_NEXT
+#undef MONGO_SBE_VM_CASE
+#undef MONGO_SBE_VM_THREADED_DISPATCH
+
 std::tuple<uint8_t, value::TypeTags, value::Value> ByteCode::run(const CodeFragment* code) {
     uassert(6040900, "The evaluation stack must be empty", _argStack.size() == 0);
 
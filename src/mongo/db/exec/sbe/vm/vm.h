@@ -323,6 +323,16 @@ struct Instruction {
 
         applyClassicMatcher,  // Instruction which calls into the classic engine MatchExpression.
 
+        // Superinstructions which fuse frequent instruction sequences into a single dispatch. They
+        // are emitted directly by the expression compiler.
+        pushAccessValGetFieldConst,  // pushAccessVal + getFieldConst
+        eqConst,                     // pushConstVal + eq
+        neqConst,                    // pushConstVal + neq
+        lessConst,                   // pushConstVal + less
+        lessEqConst,                 // pushConstVal + lessEq
+        greaterConst,                // pushConstVal + greater
+        greaterEqConst,              // pushConstVal + greaterEq
+
         lastInstruction  // this is just a marker used to calculate number of instructions
     };
 
@@ -485,6 +495,20 @@ struct Instruction {
                 return "fail";
             case applyClassicMatcher:
                 return "applyClassicMatcher";
+            case pushAccessValGetFieldConst:
+                return "pushAccessValGetFieldConst";
+            case eqConst:
+                return "eqConst";
+            case neqConst:
+                return "neqConst";
+            case lessConst:
+                return "lessConst";
+            case lessEqConst:
+                return "lessEqConst";
+            case greaterConst:
+                return "greaterConst";
+            case greaterEqConst:
+                return "greaterEqConst";
             default:
                 return "unrecognized";
         }
@@ -531,6 +555,7 @@ enum class Builtin : uint8_t {
                          // reaches specified size
     doubleDoubleSum,     // special double summation
     aggDoubleDoubleSum,
+    aggMergeDoubleDoubleSums,  // agg function to combine partial results of 'aggDoubleDoubleSum'
     doubleDoubleSumFinalize,
     doubleDoublePartialSumFinalize,
     aggStdDev,
@@ -674,21 +699,39 @@ public:
     void appendLess() {
         appendSimpleInstruction(Instruction::less);
     }
+    void appendLess(value::TypeTags tag, value::Value val) {
+        appendConstInstruction(Instruction::lessConst, tag, val);
+    }
     void appendLessEq() {
         appendSimpleInstruction(Instruction::lessEq);
     }
+    void appendLessEq(value::TypeTags tag, value::Value val) {
+        appendConstInstruction(Instruction::lessEqConst, tag, val);
+    }
     void appendGreater() {
         appendSimpleInstruction(Instruction::greater);
     }
+    void appendGreater(value::TypeTags tag, value::Value val) {
+        appendConstInstruction(Instruction::greaterConst, tag, val);
+    }
     void appendGreaterEq() {
         appendSimpleInstruction(Instruction::greaterEq);
     }
+    void appendGreaterEq(value::TypeTags tag, value::Value val) {
+        appendConstInstruction(Instruction::greaterEqConst, tag, val);
+    }
     void appendEq() {
         appendSimpleInstruction(Instruction::eq);
     }
+    void appendEq(value::TypeTags tag, value::Value val) {
+        appendConstInstruction(Instruction::eqConst, tag, val);
+    }
     void appendNeq() {
         appendSimpleInstruction(Instruction::neq);
     }
+    void appendNeq(value::TypeTags tag, value::Value val) {
+        appendConstInstruction(Instruction::neqConst, tag, val);
+    }
     void appendCmp3w() {
         appendSimpleInstruction(Instruction::cmp3w);
     }
@@ -719,6 +762,7 @@ public:
     void appendFillEmpty(Instruction::Constants k);
     void appendGetField();
     void appendGetField(value::TypeTags tag, value::Value val);
+    void appendGetField(value::SlotAccessor* accessor, value::TypeTags tag, value::Value val);
     void appendGetElement();
     void appendCollComparisonKey();
     void appendGetFieldOrElement();
@@ -779,6 +823,7 @@ public:
 
 private:
     void appendSimpleInstruction(Instruction::Tags tag);
+    void appendConstInstruction(Instruction::Tags tag, value::TypeTags constTag, value::Value val);
     auto allocateSpace(size_t size) {
         auto oldSize = _instrs.size();
         _instrs.resize(oldSize + size);
@@ -899,6 +944,24 @@ private:
     Stack _argStack;
 
     void runInternal(const CodeFragment* code, int64_t position);
+
+    /**
+     * Compares the value on the top of the stack with the constant 'rhs' and replaces it with the
+     * result of the comparison.
+     */
+    template <typename Op>
+    void runCompareConst(value::TypeTags rhsTag, value::Value rhsVal) {
+        auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
+
+        auto [tag, val] = genericCompare<Op>(lhsTag, lhsVal, rhsTag, rhsVal);
+
+        topStack(false, tag, val);
+
+        if (lhsOwned) {
+            value::releaseValue(lhsTag, lhsVal);
+        }
+    }
+
     std::tuple<bool, value::TypeTags, value::Value> runLambdaInternal(const CodeFragment* code,
                                                                       int64_t position);
 
@@ -1013,6 +1076,7 @@ private:
                                                            value::Value fieldValue);
 
     void aggDoubleDoubleSumImpl(value::Array* arr, value::TypeTags rhsTag, value::Value rhsValue);
+    void aggMergeDoubleDoubleSumsImpl(value::Array* arr, const value::Array* partialArr);
 
     // This is an implementation of the following algorithm:
     // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Welford's_online_algorithm
@@ -1137,6 +1201,8 @@ private:
     std::tuple<bool, value::TypeTags, value::Value> builtinCollAddToSetCapped(ArityType arity);
     std::tuple<bool, value::TypeTags, value::Value> builtinDoubleDoubleSum(ArityType arity);
     std::tuple<bool, value::TypeTags, value::Value> builtinAggDoubleDoubleSum(ArityType arity);
+    std::tuple<bool, value::TypeTags, value::Value> builtinAggMergeDoubleDoubleSums(
+        ArityType arity);
     std::tuple<bool, value::TypeTags, value::Value> builtinDoubleDoubleSumFinalize(ArityType arity);
     std::tuple<bool, value::TypeTags, value::Value> builtinDoubleDoublePartialSumFinalize(
         ArityType arity);
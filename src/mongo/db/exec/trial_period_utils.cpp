@@ -32,6 +32,7 @@
 #include "mongo/db/exec/trial_period_utils.h"
 
 #include "mongo/db/catalog/collection.h"
+#include "mongo/db/query/query_knobs_gen.h"
 
 namespace mongo::trial_period {
 size_t getTrialPeriodMaxWorks(OperationContext* opCtx,
@@ -58,4 +59,19 @@ size_t getTrialPeriodNumToReturn(const CanonicalQuery& query) {
 
     return numResults;
 }
+
+bool hasCardinalityDiverged(size_t work,
+                            size_t numResults,
+                            size_t decisionWork,
+                            size_t decisionResults) {
+    if (!internalQueryCacheEnableAdaptiveReplanning.load() || decisionResults == 0 ||
+        work < decisionWork) {
+        return false;
+    }
+
+    // Scale the number of results the plan produced when it was cached to the work done so far.
+    const double expectedResults =
+        static_cast<double>(decisionResults) * work / std::max<size_t>(decisionWork, 1);
+    return numResults * internalQueryCacheReplanCardinalityRatio.load() < expectedResults;
+}
 }  // namespace mongo::trial_period
@@ -54,5 +54,20 @@ size_t getTrialPeriodMaxWorks(OperationContext* opCtx,
  * trial period. As soon as any plan hits this number of documents, the trial period ends.
  */
 size_t getTrialPeriodNumToReturn(const CanonicalQuery& query);
+
+/**
+ * Returns true if a plan recovered from the plan cache, which has so far done 'work' units of work
+ * and produced 'numResults' results during its trial period, has produced so many fewer results
+ * than the 'decisionResults' it produced within 'decisionWork' when it was cached that the query
+ * should be replanned without waiting for the trial period to run out of work. The unit of work is
+ * a work cycle in the classic engine and a physical read in SBE.
+ *
+ * Always returns false unless adaptive replanning is enabled, or before the plan has done as much
+ * work as when it was cached.
+ */
+bool hasCardinalityDiverged(size_t work,
+                            size_t numResults,
+                            size_t decisionWork,
+                            size_t decisionResults);
 }  // namespace trial_period
 }  // namespace mongo
@@ -34,6 +34,8 @@
 #include <functional>
 #include <type_traits>
 
+#include "mongo/util/assert_util.h"
+
 namespace mongo {
 /**
  * During the runtime planning phase this tracker is used to track the progress of the work done
@@ -122,8 +124,21 @@ public:
         return _metrics[metric];
     }
 
+    /**
+     * Changes the maximum of the trial run metric specified as a template parameter 'metric'. This
+     * allows an '_onMetricReached' callback, which returns false to let the trial run continue, to
+     * be called again once the metric exceeds 'maxMetric'. The metric must already be tracked, and
+     * 'maxMetric' must be non-zero.
+     */
+    template <TrialRunMetric metric>
+    void setMaxMetric(size_t maxMetric) {
+        static_assert(metric >= 0 && metric < sizeof(_metrics) / sizeof(size_t));
+        invariant(_maxMetrics[metric] != 0 && maxMetric != 0);
+        _maxMetrics[metric] = maxMetric;
+    }
+
 private:
-    const size_t _maxMetrics[TrialRunMetric::kLastElem];
+    size_t _maxMetrics[TrialRunMetric::kLastElem];
     size_t _metrics[TrialRunMetric::kLastElem]{0};
     bool _done{false};
     std::function<bool(TrialRunMetric)> _onMetricReached{};
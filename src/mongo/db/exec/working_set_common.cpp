@@ -42,6 +42,7 @@
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/execution_context.h"
 #include "mongo/db/storage/index_entry_comparison.h"
+#include "mongo/db/storage/record_store.h"
 #include "mongo/logv2/log.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kQuery
@@ -81,6 +82,26 @@ bool WorkingSetCommon::fetch(OperationContext* opCtx,
     invariant(member->hasRecordId());
 
     auto record = cursor->seekExact(member->recordId);
+    return fetch(opCtx,
+                 workingSet,
+                 id,
+                 record.get_ptr(),
+                 opCtx->recoveryUnit()->getSnapshotId(),
+                 collection,
+                 ns);
+}
+
+// static
+bool WorkingSetCommon::fetch(OperationContext* opCtx,
+                             WorkingSet* workingSet,
+                             WorkingSetID id,
+                             const Record* record,
+                             SnapshotId snapshotId,
+                             const CollectionPtr& collection,
+                             const NamespaceString& ns) {
+    WorkingSetMember* member = workingSet->get(id);
+    invariant(member->hasRecordId());
+
     if (!record) {
         // The record referenced by this index entry is gone. If the query yielded some time after
         // we first examined the index entry, then it's likely that the record was deleted while we
@@ -95,9 +116,8 @@ bool WorkingSetCommon::fetch(OperationContext* opCtx,
                 PrepareConflictBehavior::kEnforce &&
             (keyDataIt = std::find_if(member->keyData.begin(),
                                       member->keyData.end(),
-                                      [currentSnapshotId = opCtx->recoveryUnit()->getSnapshotId()](
-                                          const auto& keyDatum) {
-                                          return keyDatum.snapshotId == currentSnapshotId;
+                                      [&](const auto& keyDatum) {
+                                          return keyDatum.snapshotId == snapshotId;
                                       })) != member->keyData.end()) {
             auto indexKeyEntryToObjFn = [](const IndexKeyDatum& ikd) {
                 BSONObjBuilder builder;
@@ -123,8 +143,7 @@ bool WorkingSetCommon::fetch(OperationContext* opCtx,
         return false;
     }
 
-    auto currentSnapshotId = opCtx->recoveryUnit()->getSnapshotId();
-    member->resetDocument(currentSnapshotId, record->data.releaseToBson());
+    member->resetDocument(snapshotId, record->data.toBson());
 
     // Make sure that all of the keyData is still valid for this copy of the document.  This ensures
     // both that index-provided filters and sort orders still hold.
@@ -135,9 +154,10 @@ bool WorkingSetCommon::fetch(OperationContext* opCtx,
         auto& executionCtx = StorageExecutionContext::get(opCtx);
         for (size_t i = 0; i < member->keyData.size(); i++) {
             auto&& memberKey = member->keyData[i];
-            // If this key was obtained in the current snapshot, then move on to the next key. There
-            // is no way for this key to be inconsistent with the document it points to.
-            if (memberKey.snapshotId == currentSnapshotId) {
+            // If this key was obtained in the snapshot the document was read in, then move on to the
+            // next key. There is no way for this key to be inconsistent with the document it points
+            // to.
+            if (memberKey.snapshotId == snapshotId) {
                 continue;
             }
 
@@ -37,6 +37,7 @@ namespace mongo {
 class CollectionPtr;
 class OperationContext;
 class SeekableRecordCursor;
+struct Record;
 
 class WorkingSetCommon {
 public:
@@ -55,6 +56,19 @@ public:
                       SeekableRecordCursor* cursor,
                       const CollectionPtr& collection,
                       const NamespaceString& ns);
+
+    /**
+     * Like the above, but for a document that has already been read in the storage snapshot
+     * 'snapshotId'. 'record' is the record for the member's RecordId, or nullptr if no such record
+     * was found. Does not throw WriteConflict exceptions.
+     */
+    static bool fetch(OperationContext* opCtx,
+                      WorkingSet* workingSet,
+                      WorkingSetID id,
+                      const Record* record,
+                      SnapshotId snapshotId,
+                      const CollectionPtr& collection,
+                      const NamespaceString& ns);
 };
 
 }  // namespace mongo
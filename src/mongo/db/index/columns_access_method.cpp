@@ -283,8 +283,8 @@ long long ColumnStoreAccessMethod::getFreeStorageBytes(OperationContext* opCtx)
     return _store->getFreeStorageBytes(opCtx);
 }
 
-Status ColumnStoreAccessMethod::compact(OperationContext* opCtx) {
-    return _store->compact(opCtx);
+Status ColumnStoreAccessMethod::compact(OperationContext* opCtx, const CompactOptions& options) {
+    return _store->compact(opCtx, options);
 }
 
 
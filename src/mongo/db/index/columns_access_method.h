@@ -92,7 +92,7 @@ public:
 
     long long getFreeStorageBytes(OperationContext* opCtx) const final;
 
-    Status compact(OperationContext* opCtx) final;
+    Status compact(OperationContext* opCtx, const CompactOptions& options) final;
 
     std::unique_ptr<IndexAccessMethod::BulkBuilder> initiateBulk(
         size_t maxMemoryUsageBytes,
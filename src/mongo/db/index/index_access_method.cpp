@@ -602,8 +602,9 @@ Status SortedDataIndexAccessMethod::doUpdate(OperationContext* opCtx,
     return Status::OK();
 }
 
-Status SortedDataIndexAccessMethod::compact(OperationContext* opCtx) {
-    return this->_newInterface->compact(opCtx);
+Status SortedDataIndexAccessMethod::compact(OperationContext* opCtx,
+                                            const CompactOptions& options) {
+    return this->_newInterface->compact(opCtx, options);
 }
 
 Ident* SortedDataIndexAccessMethod::getIdentPtr() const {
@@ -632,6 +633,10 @@ public:
                   const std::function<void()>& saveCursorBeforeWrite,
                   const std::function<void()>& restoreCursorAfterWrite) final;
 
+    void insertKeys(const KeyStringSet& keys,
+                    const KeyStringSet& multikeyMetadataKeys,
+                    const MultikeyPaths& multikeyPaths) final;
+
     Status commit(OperationContext* opCtx,
                   const CollectionPtr& collection,
                   bool dupsAllowed,
@@ -651,6 +656,13 @@ private:
                 const NamespaceString& ns) const;
     void _insertMultikeyMetadataKeysIntoSorter();
 
+    /**
+     * Adds the keys generated for a document to the sorter, and accumulates its multikey paths.
+     * The document's multikey metadata keys must already have been added to
+     * '_multikeyMetadataKeys'.
+     */
+    void _addKeys(const KeyStringSet& keys, const MultikeyPaths& multikeyPaths);
+
     Sorter* _makeSorter(
         size_t maxMemoryUsageBytes,
         StringData dbName,
@@ -757,28 +769,40 @@ Status SortedDataIndexAccessMethod::BulkBuilderImpl::insert(
         return exceptionToStatus();
     }
 
-    if (!multikeyPaths->empty()) {
+    _addKeys(*keys, *multikeyPaths);
+    return Status::OK();
+}
+
+void SortedDataIndexAccessMethod::BulkBuilderImpl::insertKeys(
+    const KeyStringSet& keys,
+    const KeyStringSet& multikeyMetadataKeys,
+    const MultikeyPaths& multikeyPaths) {
+    _multikeyMetadataKeys.insert(multikeyMetadataKeys.begin(), multikeyMetadataKeys.end());
+    _addKeys(keys, multikeyPaths);
+}
+
+void SortedDataIndexAccessMethod::BulkBuilderImpl::_addKeys(const KeyStringSet& keys,
+                                                            const MultikeyPaths& multikeyPaths) {
+    if (!multikeyPaths.empty()) {
         if (_indexMultikeyPaths.empty()) {
-            _indexMultikeyPaths = *multikeyPaths;
+            _indexMultikeyPaths = multikeyPaths;
         } else {
-            invariant(_indexMultikeyPaths.size() == multikeyPaths->size());
-            for (size_t i = 0; i < multikeyPaths->size(); ++i) {
+            invariant(_indexMultikeyPaths.size() == multikeyPaths.size());
+            for (size_t i = 0; i < multikeyPaths.size(); ++i) {
                 _indexMultikeyPaths[i].insert(boost::container::ordered_unique_range_t(),
-                                              (*multikeyPaths)[i].begin(),
-                                              (*multikeyPaths)[i].end());
+                                              multikeyPaths[i].begin(),
+                                              multikeyPaths[i].end());
             }
         }
     }
 
-    for (const auto& keyString : *keys) {
+    for (const auto& keyString : keys) {
         _sorter->add(keyString, mongo::NullValue());
         ++_keysInserted;
     }
 
     _isMultiKey = _isMultiKey ||
-        _iam->shouldMarkIndexAsMultikey(keys->size(), _multikeyMetadataKeys, *multikeyPaths);
-
-    return Status::OK();
+        _iam->shouldMarkIndexAsMultikey(keys.size(), _multikeyMetadataKeys, multikeyPaths);
 }
 
 const MultikeyPaths& SortedDataIndexAccessMethod::BulkBuilderImpl::getMultikeyPaths() const {
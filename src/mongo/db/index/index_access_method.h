@@ -161,7 +161,7 @@ public:
      * Attempt compaction to regain disk space if the indexed record store supports
      * compaction-in-place.
      */
-    virtual Status compact(OperationContext* opCtx) = 0;
+    virtual Status compact(OperationContext* opCtx, const CompactOptions& options) = 0;
 
     virtual Ident* getIdentPtr() const = 0;
 
@@ -193,6 +193,17 @@ public:
                               const std::function<void()>& saveCursorBeforeWrite,
                               const std::function<void()>& restoreCursorAfterWrite) = 0;
 
+        /**
+         * Inserts the keys, multikey metadata keys and multikey paths that
+         * SortedDataIndexAccessMethod::getKeys() generated for a document, as insert() would have.
+         * Used when the keys are generated ahead of time, on other threads.
+         */
+        virtual void insertKeys(const KeyStringSet& keys,
+                                const KeyStringSet& multikeyMetadataKeys,
+                                const MultikeyPaths& multikeyPaths) {
+            MONGO_UNREACHABLE;
+        }
+
         /**
          * Call this when you are ready to finish your bulk work.
          * @param dupsAllowed - If false and 'dupRecords' is not null, append with the RecordIds of
@@ -532,7 +543,7 @@ public:
 
     long long getFreeStorageBytes(OperationContext* opCtx) const final;
 
-    Status compact(OperationContext* opCtx) final;
+    Status compact(OperationContext* opCtx, const CompactOptions& options) final;
 
     Ident* getIdentPtr() const final;
 
@@ -64,6 +64,7 @@ std::map<StringData, BSONElement> populateOptionsMapForEqualityCheck(const BSONO
         IndexDescriptor::kBackgroundFieldName,         // this is a creation time option only
         IndexDescriptor::kDropDuplicatesFieldName,     // this is now ignored
         IndexDescriptor::kHiddenFieldName,             // not considered for equivalence
+        IndexDescriptor::kCacheResidentFieldName,      // not considered for equivalence
         IndexDescriptor::kCollationFieldName,          // checked specially
         IndexDescriptor::kPartialFilterExprFieldName,  // checked specially
         IndexDescriptor::kUniqueFieldName,             // checked specially
@@ -92,6 +93,7 @@ constexpr StringData IndexDescriptor::k2dsphereCoarsestIndexedLevel;
 constexpr StringData IndexDescriptor::k2dsphereFinestIndexedLevel;
 constexpr StringData IndexDescriptor::k2dsphereVersionFieldName;
 constexpr StringData IndexDescriptor::kBackgroundFieldName;
+constexpr StringData IndexDescriptor::kCacheResidentFieldName;
 constexpr StringData IndexDescriptor::kCollationFieldName;
 constexpr StringData IndexDescriptor::kDefaultLanguageFieldName;
 constexpr StringData IndexDescriptor::kDropDuplicatesFieldName;
@@ -123,7 +125,8 @@ IndexDescriptor::IndexDescriptor(const std::string& accessMethodName, BSONObj in
       _sparse(infoObj[IndexDescriptor::kSparseFieldName].trueValue()),
       _unique(_isIdIndex || infoObj[kUniqueFieldName].trueValue()),
       _hidden(infoObj[kHiddenFieldName].trueValue()),
-      _partial(!infoObj[kPartialFilterExprFieldName].eoo()) {
+      _partial(!infoObj[kPartialFilterExprFieldName].eoo()),
+      _cacheResident(infoObj[kCacheResidentFieldName].trueValue()) {
     BSONElement e = _infoObj[IndexDescriptor::kIndexVersionFieldName];
     fassert(50942, e.isNumber());
     _version = static_cast<IndexVersion>(e.numberInt());
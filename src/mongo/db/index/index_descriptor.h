@@ -70,6 +70,7 @@ public:
     static constexpr StringData k2dsphereFinestIndexedLevel = "finestIndexedLevel"_sd;
     static constexpr StringData k2dsphereVersionFieldName = "2dsphereIndexVersion"_sd;
     static constexpr StringData kBackgroundFieldName = "background"_sd;
+    static constexpr StringData kCacheResidentFieldName = "cacheResident"_sd;
     static constexpr StringData kCollationFieldName = "collation"_sd;
     static constexpr StringData kDefaultLanguageFieldName = "default_language"_sd;
     static constexpr StringData kDropDuplicatesFieldName = "dropDups"_sd;
@@ -232,6 +233,13 @@ public:
         return _prepareUnique;
     }
 
+    /**
+     * Returns true if the storage engine should keep this index in its cache.
+     */
+    bool cacheResident() const {
+        return _cacheResident;
+    }
+
     /**
      * Returns true if the key pattern is for the _id index.
      * The _id index must have form exactly {_id : 1} or {_id : -1}.
@@ -282,6 +290,7 @@ private:
     BSONObj _collation;
     BSONObj _partialFilterExpression;
     bool _prepareUnique = false;
+    bool _cacheResident;
 
     // Many query stages require going from an IndexDescriptor to its IndexCatalogEntry, so for
     // now we need this.
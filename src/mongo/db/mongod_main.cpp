@@ -51,6 +51,7 @@
 #include "mongo/db/auth/auth_op_observer.h"
 #include "mongo/db/auth/authorization_manager.h"
 #include "mongo/db/auth/sasl_options.h"
+#include "mongo/db/background_compaction.h"
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/catalog/collection_catalog.h"
 #include "mongo/db/catalog/collection_impl.h"
@@ -745,6 +746,8 @@ ExitCode _initAndListen(ServiceContext* serviceContext, int listenPort) {
             startTTLMonitor(serviceContext);
         }
 
+        startBackgroundCompactor(serviceContext);
+
         if (replSettings.usingReplSets() || !gInternalValidateFeaturesAsPrimary) {
             serverGlobalParams.validateFeaturesAsPrimary.store(false);
         }
@@ -1415,6 +1418,9 @@ void shutdownTask(const ShutdownTaskArgs& shutdownArgs) {
     LOGV2(4784928, "Shutting down the TTL monitor");
     shutdownTTLMonitor(serviceContext);
 
+    LOGV2(7086794, "Shutting down the background compactor");
+    shutdownBackgroundCompactor(serviceContext);
+
     LOGV2(6278511, "Shutting down the Change Stream Expired Pre-images Remover");
     shutdownChangeStreamExpiredPreImagesRemover(serviceContext);
 
@@ -406,6 +406,10 @@ bool NamespaceString::isTimeseriesBucketsCollection() const {
     return coll().startsWith(kTimeseriesBucketsCollectionPrefix);
 }
 
+bool NamespaceString::isSystemStatsCollection() const {
+    return coll().startsWith(kStatisticsCollectionPrefix);
+}
+
 bool NamespaceString::isChangeStreamPreImagesCollection() const {
     return ns() == kChangeStreamPreImagesNamespace.ns();
 }
@@ -436,6 +440,15 @@ NamespaceString NamespaceString::makeTimeseriesBucketsNamespace() const {
     return {db(), kTimeseriesBucketsCollectionPrefix.toString() + coll()};
 }
 
+NamespaceString NamespaceString::makeStatisticsNamespace() const {
+    return {db(), kStatisticsCollectionPrefix.toString() + coll()};
+}
+
+NamespaceString NamespaceString::getStatisticsSourceNamespace() const {
+    invariant(isSystemStatsCollection(), ns());
+    return {db(), coll().substr(kStatisticsCollectionPrefix.size())};
+}
+
 NamespaceString NamespaceString::getTimeseriesViewNamespace() const {
     invariant(isTimeseriesBucketsCollection(), ns());
     return {db(), coll().substr(kTimeseriesBucketsCollectionPrefix.size())};
@@ -103,6 +103,9 @@ public:
     // Prefix for time-series buckets collection.
     static constexpr StringData kTimeseriesBucketsCollectionPrefix = "system.buckets."_sd;
 
+    // Prefix for the collection holding the persisted query statistics of a user collection.
+    static constexpr StringData kStatisticsCollectionPrefix = "system.statistics."_sd;
+
     // Namespace for storing configuration data, which needs to be replicated if the server is
     // running as a replica set. Documents in this collection should represent some configuration
     // state of the server, which needs to be recovered/consulted at startup. Each document in this
@@ -461,6 +464,11 @@ public:
      */
     bool isTimeseriesBucketsCollection() const;
 
+    /**
+     * Returns whether the specified namespace is <database>.system.statistics.<>.
+     */
+    bool isSystemStatsCollection() const;
+
     /**
      * Returns whether the specified namespace is config.system.preimages.
      */
@@ -496,6 +504,16 @@ public:
      */
     NamespaceString makeTimeseriesBucketsNamespace() const;
 
+    /**
+     * Returns the namespace of the collection holding the persisted statistics for this namespace.
+     */
+    NamespaceString makeStatisticsNamespace() const;
+
+    /**
+     * Returns the namespace of the collection whose statistics this statistics namespace holds.
+     */
+    NamespaceString getStatisticsSourceNamespace() const;
+
     /**
      * Returns the time-series view namespace for this buckets namespace.
      */
@@ -137,6 +137,16 @@ TEST(NamespaceStringTest, IsLegalClientSystemNamespace) {
     ASSERT_FALSE(NamespaceString{"test.system.buckets..1234"}.isLegalClientSystemNS(currentFCV));
     ASSERT_FALSE(NamespaceString{"test.system.buckets.a234$"}.isLegalClientSystemNS(currentFCV));
     ASSERT_FALSE(NamespaceString{"test.system.buckets."}.isLegalClientSystemNS(currentFCV));
+    ASSERT_FALSE(NamespaceString{"test.system.statistics.foo"}.isLegalClientSystemNS(currentFCV));
+}
+
+TEST(NamespaceStringTest, StatisticsNamespace) {
+    const NamespaceString nss{"test.foo"};
+    const auto statsNss = nss.makeStatisticsNamespace();
+    ASSERT_EQUALS(NamespaceString{"test.system.statistics.foo"}, statsNss);
+    ASSERT_TRUE(statsNss.isSystemStatsCollection());
+    ASSERT_FALSE(nss.isSystemStatsCollection());
+    ASSERT_EQUALS(nss, statsNss.getStatisticsSourceNamespace());
 }
 
 TEST(NamespaceStringTest, IsDropPendingNamespace) {
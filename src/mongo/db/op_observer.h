@@ -384,6 +384,18 @@ public:
                                const NamespaceString& collectionName,
                                const UUID& uuid) = 0;
 
+    /**
+     * Called when the records with ids in ['minRecordId', 'maxRecordId'] are removed from 'coll'
+     * by a single storage-level range truncate, instead of onDelete() being called for each of
+     * them. 'bytesDeleted' and 'docsDeleted' are the size and number of the removed records.
+     */
+    virtual void onTruncateRange(OperationContext* opCtx,
+                                 const CollectionPtr& coll,
+                                 const RecordId& minRecordId,
+                                 const RecordId& maxRecordId,
+                                 int64_t bytesDeleted,
+                                 int64_t docsDeleted) = 0;
+
     /**
      * The onUnpreparedTransactionCommit method is called on the commit of an unprepared
      * transaction, before the RecoveryUnit onCommit() is called.  It must not be called when no
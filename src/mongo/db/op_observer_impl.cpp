@@ -42,6 +42,7 @@
 #include "mongo/db/catalog/database_holder.h"
 #include "mongo/db/catalog/document_validation.h"
 #include "mongo/db/catalog/import_collection_oplog_entry_gen.h"
+#include "mongo/db/catalog/truncate_range_oplog_entry_gen.h"
 #include "mongo/db/catalog_raii.h"
 #include "mongo/db/commands/txn_cmds_gen.h"
 #include "mongo/db/concurrency/d_concurrency.h"
@@ -57,6 +58,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/pipeline/change_stream_pre_image_helpers.h"
 #include "mongo/db/pipeline/change_stream_preimage_gen.h"
+#include "mongo/db/query/ce/collection_statistics_cache.h"
 #include "mongo/db/read_write_concern_defaults.h"
 #include "mongo/db/repl/image_collection_entry_gen.h"
 #include "mongo/db/repl/oplog.h"
@@ -362,6 +364,19 @@ bool shouldTimestampIndexBuildSinglePhase(OperationContext* opCtx, const Namespa
     return true;
 }
 
+/**
+ * Invalidates the cached query statistics affected by a change to the collection 'nss' once the
+ * change commits: the statistics of 'nss' itself or, if 'nss' holds statistics, the statistics of
+ * the collection they describe.
+ */
+void invalidateCollectionStatisticsOnCommit(OperationContext* opCtx, const NamespaceString& nss) {
+    auto sourceNss = nss.isSystemStatsCollection() ? nss.getStatisticsSourceNamespace() : nss;
+    opCtx->recoveryUnit()->onCommit(
+        [svcCtx = opCtx->getServiceContext(), sourceNss](boost::optional<Timestamp>) {
+            ce::CollectionStatisticsCache::get(svcCtx).invalidate(sourceNss);
+        });
+}
+
 }  // namespace
 
 void OpObserverImpl::onCreateIndex(OperationContext* opCtx,
@@ -669,6 +684,8 @@ void OpObserverImpl::onInserts(OperationContext* opCtx,
             ReadWriteConcernDefaults::get(opCtx).observeDirectWriteToConfigSettings(
                 opCtx, it->doc["_id"], it->doc);
         }
+    } else if (nss.isSystemStatsCollection()) {
+        invalidateCollectionStatisticsOnCommit(opCtx, nss);
     } else if (nss == NamespaceString::kExternalKeysCollectionNamespace) {
         for (auto it = first; it != last; it++) {
             auto externalKey = ExternalKeysCollectionDocument::parse(
@@ -882,6 +899,8 @@ void OpObserverImpl::onUpdate(OperationContext* opCtx, const OplogUpdateEntryArg
             auto& bucketCatalog = BucketCatalog::get(opCtx);
             bucketCatalog.clear(args.updateArgs->updatedDoc["_id"].OID());
         }
+    } else if (args.nss.isSystemStatsCollection()) {
+        invalidateCollectionStatisticsOnCommit(opCtx, args.nss);
     }
 }
 
@@ -1074,6 +1093,8 @@ void OpObserverImpl::onDelete(OperationContext* opCtx,
     } else if (nss == NamespaceString::kConfigSettingsNamespace) {
         ReadWriteConcernDefaults::get(opCtx).observeDirectWriteToConfigSettings(
             opCtx, documentKey.getId().firstElement(), boost::none);
+    } else if (nss.isSystemStatsCollection()) {
+        invalidateCollectionStatisticsOnCommit(opCtx, nss);
     }
 }
 
@@ -1204,6 +1225,11 @@ void OpObserverImpl::onDropDatabase(OperationContext* opCtx, const std::string&
     }
 
     BucketCatalog::get(opCtx).clear(dbName);
+
+    opCtx->recoveryUnit()->onCommit(
+        [svcCtx = opCtx->getServiceContext(), dbName](boost::optional<Timestamp>) {
+            ce::CollectionStatisticsCache::get(svcCtx).invalidateDatabase(dbName);
+        });
 }
 
 repl::OpTime OpObserverImpl::onDropCollection(OperationContext* opCtx,
@@ -1263,6 +1289,8 @@ repl::OpTime OpObserverImpl::onDropCollection(OperationContext* opCtx,
         BucketCatalog::get(opCtx).clear(collectionName.getTimeseriesViewNamespace());
     }
 
+    invalidateCollectionStatisticsOnCommit(opCtx, collectionName);
+
     return {};
 }
 
@@ -1336,6 +1364,9 @@ void OpObserverImpl::postRenameCollection(OperationContext* const opCtx,
         DurableViewCatalog::onExternalChange(opCtx, fromCollection);
     if (toCollection.isSystemDotViews())
         DurableViewCatalog::onExternalChange(opCtx, toCollection);
+
+    invalidateCollectionStatisticsOnCommit(opCtx, fromCollection);
+    invalidateCollectionStatisticsOnCommit(opCtx, toCollection);
 }
 
 void OpObserverImpl::onRenameCollection(OperationContext* const opCtx,
@@ -1416,6 +1447,23 @@ void OpObserverImpl::onEmptyCapped(OperationContext* opCtx,
     }
 }
 
+void OpObserverImpl::onTruncateRange(OperationContext* opCtx,
+                                     const CollectionPtr& coll,
+                                     const RecordId& minRecordId,
+                                     const RecordId& maxRecordId,
+                                     int64_t bytesDeleted,
+                                     int64_t docsDeleted) {
+    TruncateRangeOplogEntry objectEntry(
+        coll->ns().coll().toString(), minRecordId, maxRecordId, bytesDeleted, docsDeleted);
+
+    MutableOplogEntry oplogEntry;
+    oplogEntry.setOpType(repl::OpTypeEnum::kCommand);
+    oplogEntry.setNss(coll->ns().getCommandNS());
+    oplogEntry.setUuid(coll->uuid());
+    oplogEntry.setObject(objectEntry.toBSON());
+    logOperation(opCtx, &oplogEntry);
+}
+
 namespace {
 
 /**
@@ -367,6 +367,17 @@ public:
             o->onEmptyCapped(opCtx, collectionName, uuid);
     }
 
+    void onTruncateRange(OperationContext* opCtx,
+                         const CollectionPtr& coll,
+                         const RecordId& minRecordId,
+                         const RecordId& maxRecordId,
+                         int64_t bytesDeleted,
+                         int64_t docsDeleted) override {
+        ReservedTimes times{opCtx};
+        for (auto& o : _observers)
+            o->onTruncateRange(opCtx, coll, minRecordId, maxRecordId, bytesDeleted, docsDeleted);
+    }
+
     void onUnpreparedTransactionCommit(OperationContext* opCtx,
                                        std::vector<repl::ReplOperation>* statements,
                                        size_t numberOfPrePostImagesToWrite) override {
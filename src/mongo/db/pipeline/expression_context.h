@@ -417,6 +417,11 @@ public:
     // 'jsHeapLimitMB' server parameter.
     boost::optional<int> jsHeapLimitMB;
 
+    // When set restricts the number of worker threads that may be used to execute this query in
+    // parallel. This limit is ignored if larger than the global limit dictated by the
+    // 'internalQuerySlotBasedExecutionMaxDegreeOfParallelism' server parameter.
+    boost::optional<int> maxDegreeOfParallelism;
+
     // An interface for accessing information or performing operations that have different
     // implementations on mongod and mongos, or that only make sense on one of the two.
     // Additionally, putting some of this functionality behind an interface prevents aggregation
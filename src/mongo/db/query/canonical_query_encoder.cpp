@@ -1085,6 +1085,13 @@ std::string encodeSBE(const CanonicalQuery& cq) {
 
     encodeFindCommandRequest(cq.getFindCommandRequest(), &bufBuilder);
 
+    // The number of workers which may compute a $group in parallel shapes the plan, so queries
+    // with different limits must not share a cache entry.
+    if (auto maxDegreeOfParallelism = cq.getExpCtx()->maxDegreeOfParallelism) {
+        bufBuilder.appendChar('p');
+        bufBuilder.appendNum(*maxDegreeOfParallelism);
+    }
+
     return base64::encode(StringData(bufBuilder.buf(), bufBuilder.len()));
 }
 
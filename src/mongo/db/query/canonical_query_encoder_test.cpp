@@ -519,5 +519,25 @@ TEST(CanonicalQueryEncoderTest, ComputeKeySBE) {
         std::move(findCommand));
 }
 
+TEST(CanonicalQueryEncoderTest, ComputeKeySBEDependsOnMaxDegreeOfParallelism) {
+    // SBE must be enabled in order to generate SBE plan cache keys.
+    RAIIServerParameterControllerForTest controllerSBE("internalQueryForceClassicEngine", false);
+
+    // TODO SERVER-61314: Remove when featureFlagSbePlanCache is removed.
+    RAIIServerParameterControllerForTest controllerSBEPlanCache("featureFlagSbePlanCache", true);
+
+    unique_ptr<CanonicalQuery> cq(canonicalize("{a: 1}"));
+    cq->setSbeCompatible(true);
+    const auto keyWithoutDop = makeKey(*cq);
+
+    cq->getExpCtx()->maxDegreeOfParallelism = 2;
+    const auto keyWithDop2 = makeKey(*cq);
+    ASSERT_NOT_EQUALS(keyWithoutDop.toString(), keyWithDop2.toString());
+
+    cq->getExpCtx()->maxDegreeOfParallelism = 4;
+    const auto keyWithDop4 = makeKey(*cq);
+    ASSERT_NOT_EQUALS(keyWithDop2.toString(), keyWithDop4.toString());
+}
+
 }  // namespace
 }  // namespace mongo
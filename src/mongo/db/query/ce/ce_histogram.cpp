@@ -0,0 +1,248 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/db/query/ce/ce_histogram.h"
+
+#include <algorithm>
+
+#include "mongo/db/exec/sbe/values/bson.h"
+#include "mongo/db/query/optimizer/cascades/ce_heuristic.h"
+
+namespace mongo::optimizer::cascades {
+
+using namespace properties;
+
+namespace {
+
+/**
+ * Converts a path made only of PathGet and PathTraverse elements, ending in PathIdentity, into the
+ * dotted field path the statistics are keyed by.
+ */
+boost::optional<std::string> getDottedPath(const ABT& path) {
+    std::string result;
+    for (ABT::reference_type current = path.ref();;) {
+        if (current.is<PathIdentity>()) {
+            break;
+        } else if (const auto traverse = current.cast<PathTraverse>(); traverse != nullptr) {
+            current = traverse->getPath().ref();
+        } else if (const auto get = current.cast<PathGet>(); get != nullptr) {
+            if (!result.empty()) {
+                result += '.';
+            }
+            result += get->name();
+            current = get->getPath().ref();
+        } else {
+            return {};
+        }
+    }
+
+    if (result.empty()) {
+        return {};
+    }
+    return result;
+}
+
+/**
+ * Appends the value of a constant interval bound to 'builder'. Infinite, MinKey and MaxKey bounds
+ * are left out so the histogram treats them as open. Returns false if the bound is not a constant.
+ */
+bool appendBound(const BoundRequirement& bound, BSONObjBuilder& builder) {
+    if (bound.isInfinite()) {
+        return true;
+    }
+
+    const auto constant = bound.getBound().cast<Constant>();
+    if (constant == nullptr) {
+        return false;
+    }
+
+    const auto [tag, val] = constant->get();
+    if (tag != sbe::value::TypeTags::MinKey && tag != sbe::value::TypeTags::MaxKey) {
+        sbe::bson::appendValueToBsonObj(builder, "", tag, val);
+    }
+    return true;
+}
+
+/**
+ * Estimated number of values in 'interval', or none if its bounds are not constants.
+ */
+boost::optional<double> estimateInterval(const ce::Histogram& histogram,
+                                         const IntervalRequirement& interval) {
+    BSONObjBuilder lowBuilder, highBuilder;
+    if (!appendBound(interval.getLowBound(), lowBuilder) ||
+        !appendBound(interval.getHighBound(), highBuilder)) {
+        return {};
+    }
+
+    const BSONObj low = lowBuilder.obj();
+    const BSONObj high = highBuilder.obj();
+    return histogram.estimateRange(low.firstElement(),
+                                   interval.getLowBound().isInclusive(),
+                                   high.firstElement(),
+                                   interval.getHighBound().isInclusive());
+}
+
+/**
+ * Estimated number of values satisfying the DNF 'intervals'. The intervals of a conjunction are
+ * normally already intersected, so its smallest estimate is used; disjunctions are assumed not to
+ * overlap.
+ */
+boost::optional<double> estimateIntervals(const ce::Histogram& histogram,
+                                          const IntervalReqExpr::Node& intervals) {
+    const auto disjunction = intervals.cast<IntervalReqExpr::Disjunction>();
+    if (disjunction == nullptr) {
+        return {};
+    }
+
+    double result = 0.0;
+    for (const auto& child : disjunction->nodes()) {
+        const auto conjunction = child.cast<IntervalReqExpr::Conjunction>();
+        if (conjunction == nullptr) {
+            return {};
+        }
+
+        boost::optional<double> conjunctionResult;
+        for (const auto& atom : conjunction->nodes()) {
+            const auto atomPtr = atom.cast<IntervalReqExpr::Atom>();
+            if (atomPtr == nullptr) {
+                return {};
+            }
+            const auto estimate = estimateInterval(histogram, atomPtr->getExpr());
+            if (!estimate) {
+                return {};
+            }
+            conjunctionResult = std::min(conjunctionResult.value_or(*estimate), *estimate);
+        }
+        result += conjunctionResult.value_or(0.0);
+    }
+
+    return std::min(result, histogram.getValueCount());
+}
+
+}  // namespace
+
+class CEHistogramTransport {
+public:
+    // Selectivity used for a requirement which cannot be estimated from a histogram. This matches
+    // the selectivity the heuristic estimator gives to a lowered requirement.
+    static constexpr SelectivityType kDefaultSelectivity = 0.1;
+
+    CEHistogramTransport(std::string scanDefName,
+                         std::shared_ptr<const ce::CollectionStatistics> stats)
+        : _scanDefName(std::move(scanDefName)), _stats(std::move(stats)), _heuristicCE() {}
+
+    CEType transport(const ABT& n,
+                     const SargableNode& node,
+                     const Memo& memo,
+                     const LogicalProps& logicalProps,
+                     CEType childResult,
+                     CEType /*bindsResult*/,
+                     CEType /*refsResult*/) {
+        if (!hasProperty<IndexingAvailability>(logicalProps)) {
+            return _heuristicCE.deriveCE(memo, logicalProps, n.ref());
+        }
+        const auto& indexingAvailability = getPropertyConst<IndexingAvailability>(logicalProps);
+        if (indexingAvailability.getScanDefName() != _scanDefName) {
+            return _heuristicCE.deriveCE(memo, logicalProps, n.ref());
+        }
+
+        // Assume that the requirements are independent.
+        CEType result = childResult;
+        for (const auto& [key, req] : node.getReqMap()) {
+            if (isIntervalReqFullyOpenDNF(req.getIntervals())) {
+                continue;
+            }
+            result *= estimateSelectivity(indexingAvailability, key, req);
+        }
+        return result;
+    }
+
+    template <typename T, typename... Ts>
+    CEType transport(const ABT& n,
+                     const T& /*node*/,
+                     const Memo& memo,
+                     const LogicalProps& logicalProps,
+                     Ts&&...) {
+        if (canBeLogicalNode<T>()) {
+            return _heuristicCE.deriveCE(memo, logicalProps, n.ref());
+        }
+        return 0.0;
+    }
+
+    CEType derive(const Memo& memo,
+                  const LogicalProps& logicalProps,
+                  const ABT::reference_type logicalNodeRef) {
+        return algebra::transport<true>(logicalNodeRef, *this, memo, logicalProps);
+    }
+
+private:
+    SelectivityType estimateSelectivity(const IndexingAvailability& indexingAvailability,
+                                        const PartialSchemaKey& key,
+                                        const PartialSchemaRequirement& req) const {
+        if (key._projectionName != indexingAvailability.getScanProjection()) {
+            return kDefaultSelectivity;
+        }
+
+        const auto path = getDottedPath(key._path);
+        if (!path) {
+            return kDefaultSelectivity;
+        }
+
+        const ce::Histogram* histogram = _stats->getHistogram(*path);
+        if (histogram == nullptr || histogram->getDocumentCount() <= 0.0) {
+            return kDefaultSelectivity;
+        }
+
+        const auto estimate = estimateIntervals(*histogram, req.getIntervals());
+        if (!estimate) {
+            return kDefaultSelectivity;
+        }
+        return std::min(1.0, *estimate / histogram->getDocumentCount());
+    }
+
+    const std::string _scanDefName;
+    const std::shared_ptr<const ce::CollectionStatistics> _stats;
+    HeuristicCE _heuristicCE;
+};
+
+HistogramCE::HistogramCE(std::string scanDefName,
+                         std::shared_ptr<const ce::CollectionStatistics> stats)
+    : _transport(std::make_unique<CEHistogramTransport>(std::move(scanDefName), std::move(stats))) {
+}
+
+HistogramCE::~HistogramCE() {}
+
+CEType HistogramCE::deriveCE(const Memo& memo,
+                             const LogicalProps& logicalProps,
+                             const ABT::reference_type logicalNodeRef) const {
+    return _transport->derive(memo, logicalProps, logicalNodeRef);
+}
+
+}  // namespace mongo::optimizer::cascades
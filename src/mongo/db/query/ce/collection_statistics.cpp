@@ -0,0 +1,94 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kQuery
+
+#include "mongo/db/query/ce/collection_statistics.h"
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/dbdirectclient.h"
+#include "mongo/db/query/ce/collection_statistics_cache.h"
+#include "mongo/logv2/log.h"
+
+namespace mongo::ce {
+
+std::shared_ptr<const CollectionStatistics> CollectionStatistics::get(
+    OperationContext* opCtx, const NamespaceString& nss) {
+    return CollectionStatisticsCache::get(opCtx).getOrLoad(nss,
+                                                           [&] { return load(opCtx, nss); });
+}
+
+CollectionStatistics CollectionStatistics::load(OperationContext* opCtx,
+                                                const NamespaceString& nss) {
+    CollectionStatistics stats;
+
+    DBDirectClient client(opCtx);
+    auto cursor = client.find(FindCommandRequest{nss.makeStatisticsNamespace()});
+    while (cursor && cursor->more()) {
+        const BSONObj doc = cursor->nextSafe();
+        const auto path = doc[kPathField];
+        const auto statistics = doc[kStatisticsField];
+        if (path.type() != BSONType::String || statistics.type() != BSONType::Object) {
+            LOGV2_WARNING(7086750,
+                          "Ignoring malformed statistics document",
+                          "namespace"_attr = nss,
+                          "document"_attr = doc);
+            continue;
+        }
+
+        auto histogram = Histogram::parse(statistics.Obj());
+        if (!histogram.isOK()) {
+            LOGV2_WARNING(7086751,
+                          "Ignoring statistics which failed to parse",
+                          "namespace"_attr = nss,
+                          "path"_attr = path.valueStringData(),
+                          "error"_attr = histogram.getStatus());
+            continue;
+        }
+        stats.addHistogram(path.str(), std::move(histogram.getValue()));
+    }
+
+    return stats;
+}
+
+BSONObj CollectionStatistics::makeStatisticsDocument(StringData path, const Histogram& histogram) {
+    return BSON(kPathField << path << kStatisticsField << histogram.serialize());
+}
+
+void CollectionStatistics::addHistogram(std::string path, Histogram histogram) {
+    _histograms.insert_or_assign(std::move(path), std::move(histogram));
+}
+
+const Histogram* CollectionStatistics::getHistogram(const std::string& path) const {
+    auto it = _histograms.find(path);
+    return it == _histograms.end() ? nullptr : &it->second;
+}
+
+}  // namespace mongo::ce
@@ -0,0 +1,85 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/query/ce/histogram.h"
+
+namespace mongo::ce {
+
+/**
+ * The persisted statistics of a collection: one histogram per analyzed path. They are stored in
+ * the <db>.system.statistics.<coll> collection, one document per path:
+ *
+ * {_id: <path>, statistics: <serialized histogram>}
+ */
+class CollectionStatistics {
+public:
+    static constexpr StringData kPathField = "_id"_sd;
+    static constexpr StringData kStatisticsField = "statistics"_sd;
+
+    /**
+     * Returns the statistics persisted for 'nss', reading them only if they are not cached yet.
+     */
+    static std::shared_ptr<const CollectionStatistics> get(OperationContext* opCtx,
+                                                           const NamespaceString& nss);
+
+    /**
+     * Reads the statistics persisted for 'nss'. Documents which fail to parse are skipped.
+     */
+    static CollectionStatistics load(OperationContext* opCtx, const NamespaceString& nss);
+
+    /**
+     * Builds the document persisting 'histogram' for 'path'.
+     */
+    static BSONObj makeStatisticsDocument(StringData path, const Histogram& histogram);
+
+    void addHistogram(std::string path, Histogram histogram);
+
+    /**
+     * Returns the histogram for the dotted 'path', or nullptr if the path was not analyzed.
+     */
+    const Histogram* getHistogram(const std::string& path) const;
+
+    bool empty() const {
+        return _histograms.empty();
+    }
+
+private:
+    std::map<std::string, Histogram> _histograms;
+};
+
+}  // namespace mongo::ce
@@ -0,0 +1,76 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/query/ce/collection_statistics.h"
+#include "mongo/db/service_context.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/unordered_map.h"
+
+namespace mongo::ce {
+
+/**
+ * Caches the persisted statistics of each collection, so that the Cascades optimizer does not read
+ * <db>.system.statistics.<coll> for every query it optimizes. A collection without statistics is
+ * cached as well.
+ *
+ * The OpObserver invalidates the entry of a collection when its statistics collection is written
+ * to or dropped, and when the collection itself is dropped or renamed.
+ */
+class CollectionStatisticsCache {
+public:
+    static CollectionStatisticsCache& get(ServiceContext* serviceContext);
+    static CollectionStatisticsCache& get(OperationContext* opCtx);
+
+    /**
+     * Returns the cached statistics of 'nss'. On a miss, calls 'load' without holding the cache
+     * mutex and caches its result, unless the cache was invalidated in the meantime.
+     */
+    std::shared_ptr<const CollectionStatistics> getOrLoad(
+        const NamespaceString& nss, const std::function<CollectionStatistics()>& load);
+
+    void invalidate(const NamespaceString& nss);
+    void invalidateDatabase(StringData dbName);
+
+private:
+    Mutex _mutex = MONGO_MAKE_LATCH("CollectionStatisticsCache::_mutex");
+    stdx::unordered_map<NamespaceString, std::shared_ptr<const CollectionStatistics>> _statistics;
+
+    // Incremented by every invalidation, so that statistics loaded concurrently with an
+    // invalidation are not cached.
+    uint64_t _epoch{0};
+};
+
+}  // namespace mongo::ce
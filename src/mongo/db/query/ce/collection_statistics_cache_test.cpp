@@ -0,0 +1,102 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/db/query/ce/collection_statistics_cache.h"
+
+#include "mongo/unittest/unittest.h"
+
+namespace mongo::ce {
+namespace {
+
+const NamespaceString kNss("test.coll");
+const NamespaceString kOtherNss("test.other");
+const NamespaceString kOtherDbNss("other.coll");
+
+class CollectionStatisticsCacheTest : public unittest::Test {
+protected:
+    std::shared_ptr<const CollectionStatistics> getOrLoad(const NamespaceString& nss) {
+        return _cache.getOrLoad(nss, [&] {
+            ++_loads;
+            return CollectionStatistics{};
+        });
+    }
+
+    CollectionStatisticsCache _cache;
+    int _loads = 0;
+};
+
+TEST_F(CollectionStatisticsCacheTest, LoadsOnlyOnMiss) {
+    auto stats = getOrLoad(kNss);
+    ASSERT_EQ(1, _loads);
+    ASSERT_EQ(stats, getOrLoad(kNss));
+    ASSERT_EQ(1, _loads);
+
+    getOrLoad(kOtherNss);
+    ASSERT_EQ(2, _loads);
+}
+
+TEST_F(CollectionStatisticsCacheTest, InvalidateReloads) {
+    auto stats = getOrLoad(kNss);
+    getOrLoad(kOtherNss);
+
+    _cache.invalidate(kNss);
+    ASSERT_NE(stats, getOrLoad(kNss));
+    ASSERT_EQ(3, _loads);
+
+    // Other collections stay cached.
+    getOrLoad(kOtherNss);
+    ASSERT_EQ(3, _loads);
+}
+
+TEST_F(CollectionStatisticsCacheTest, InvalidateDatabaseReloadsOnlyItsCollections) {
+    getOrLoad(kNss);
+    getOrLoad(kOtherNss);
+    getOrLoad(kOtherDbNss);
+
+    _cache.invalidateDatabase(kNss.db());
+    getOrLoad(kNss);
+    getOrLoad(kOtherNss);
+    getOrLoad(kOtherDbNss);
+    ASSERT_EQ(5, _loads);
+}
+
+TEST_F(CollectionStatisticsCacheTest, StatisticsLoadedDuringInvalidationAreNotCached) {
+    _cache.getOrLoad(kNss, [&] {
+        ++_loads;
+        _cache.invalidate(kNss);
+        return CollectionStatistics{};
+    });
+
+    getOrLoad(kNss);
+    ASSERT_EQ(2, _loads);
+}
+
+}  // namespace
+}  // namespace mongo::ce
@@ -0,0 +1,371 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/db/query/ce/histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/bson/dotted_path_support.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/str.h"
+
+namespace mongo::ce {
+
+namespace {
+
+constexpr StringData kDocumentsField = "documents"_sd;
+constexpr StringData kNDVField = "ndv"_sd;
+constexpr StringData kTypeCountsField = "typeCounts"_sd;
+constexpr StringData kBucketsField = "buckets"_sd;
+constexpr StringData kBoundField = "bound"_sd;
+constexpr StringData kEqualFreqField = "equalFreq"_sd;
+constexpr StringData kRangeFreqField = "rangeFreq"_sd;
+constexpr StringData kRangeNDVField = "rangeNDV"_sd;
+
+int compareValues(const BSONElement& lhs, const BSONElement& rhs) {
+    // Compare the values only, ignoring field names.
+    return lhs.woCompare(rhs, 0 /*rules*/);
+}
+
+/**
+ * Position of 'value' between 'low' and 'high' as a fraction in [0, 1]. Only numbers are
+ * interpolated, anything else is assumed to be in the middle of the range.
+ */
+double interpolate(const BSONElement& low, const BSONElement& value, const BSONElement& high) {
+    if (!low.isNumber() || !value.isNumber() || !high.isNumber()) {
+        return 0.5;
+    }
+
+    const double lowNum = low.numberDouble();
+    const double highNum = high.numberDouble();
+    const double width = highNum - lowNum;
+    if (!std::isfinite(width) || width <= 0.0) {
+        return 0.5;
+    }
+    return std::clamp((value.numberDouble() - lowNum) / width, 0.0, 1.0);
+}
+
+/**
+ * GEE estimate of the number of distinct values in a population 'scale' times larger than a
+ * uniform sample holding 'distinct' distinct values, 'singletons' of which were seen only once.
+ */
+double estimateNDV(double distinct, double singletons, double scale) {
+    return std::sqrt(scale) * singletons + (distinct - singletons);
+}
+
+StatusWith<double> parseCount(const BSONObj& obj, StringData fieldName) {
+    const auto elem = obj[fieldName];
+    if (!elem.isNumber() || elem.numberDouble() < 0.0) {
+        return Status(ErrorCodes::BadValue,
+                      str::stream() << "Histogram field '" << fieldName
+                                    << "' must be a non-negative number: " << obj);
+    }
+    return elem.numberDouble();
+}
+
+}  // namespace
+
+StatusWith<Histogram> Histogram::parse(const BSONObj& obj) {
+    Histogram histogram;
+
+    auto documents = parseCount(obj, kDocumentsField);
+    if (!documents.isOK()) {
+        return documents.getStatus();
+    }
+    histogram._documents = documents.getValue();
+
+    auto ndv = parseCount(obj, kNDVField);
+    if (!ndv.isOK()) {
+        return ndv.getStatus();
+    }
+    histogram._ndv = ndv.getValue();
+
+    const auto typeCounts = obj[kTypeCountsField];
+    if (typeCounts.type() != BSONType::Object) {
+        return Status(ErrorCodes::BadValue,
+                      str::stream() << "Histogram type counts must be an object: " << obj);
+    }
+    for (auto&& elem : typeCounts.Obj()) {
+        if (!elem.isNumber()) {
+            return Status(ErrorCodes::BadValue,
+                          str::stream() << "Histogram type count must be a number: " << elem);
+        }
+        histogram._typeCounts.emplace(elem.fieldName(), elem.numberDouble());
+    }
+
+    const auto buckets = obj[kBucketsField];
+    if (buckets.type() != BSONType::Array) {
+        return Status(ErrorCodes::BadValue,
+                      str::stream() << "Histogram buckets must be an array: " << obj);
+    }
+
+    BSONArrayBuilder bounds;
+    double cumulativeFreq = 0.0;
+    BSONElement prevBound;
+    for (auto&& elem : buckets.Obj()) {
+        if (elem.type() != BSONType::Object) {
+            return Status(ErrorCodes::BadValue,
+                          str::stream() << "Histogram bucket must be an object: " << elem);
+        }
+
+        const auto bucketObj = elem.Obj();
+        const auto bound = bucketObj[kBoundField];
+        if (bound.eoo() || (!prevBound.eoo() && compareValues(prevBound, bound) >= 0)) {
+            return Status(ErrorCodes::BadValue,
+                          str::stream()
+                              << "Histogram bucket bounds must be present and strictly increasing: "
+                              << bucketObj);
+        }
+        prevBound = bound;
+
+        Bucket bucket;
+        for (auto&& [field, count] : {std::pair{kEqualFreqField, &bucket.equalFreq},
+                                      std::pair{kRangeFreqField, &bucket.rangeFreq},
+                                      std::pair{kRangeNDVField, &bucket.rangeNDV}}) {
+            auto parsed = parseCount(bucketObj, field);
+            if (!parsed.isOK()) {
+                return parsed.getStatus();
+            }
+            *count = parsed.getValue();
+        }
+        cumulativeFreq += bucket.equalFreq + bucket.rangeFreq;
+        bucket.cumulativeFreq = cumulativeFreq;
+
+        bounds.append(bound);
+        histogram._buckets.push_back(bucket);
+    }
+
+    histogram._bounds = bounds.obj();
+    histogram.linkBounds();
+    return histogram;
+}
+
+BSONObj Histogram::serialize() const {
+    BSONObjBuilder builder;
+    builder.append(kDocumentsField, _documents);
+    builder.append(kNDVField, _ndv);
+    {
+        BSONObjBuilder typeCounts(builder.subobjStart(kTypeCountsField));
+        for (auto&& [typeName, count] : _typeCounts) {
+            typeCounts.append(typeName, count);
+        }
+    }
+    {
+        BSONArrayBuilder buckets(builder.subarrayStart(kBucketsField));
+        for (auto&& bucket : _buckets) {
+            BSONObjBuilder bucketBuilder(buckets.subobjStart());
+            bucketBuilder.appendAs(bucket.bound, kBoundField);
+            bucketBuilder.append(kEqualFreqField, bucket.equalFreq);
+            bucketBuilder.append(kRangeFreqField, bucket.rangeFreq);
+            bucketBuilder.append(kRangeNDVField, bucket.rangeNDV);
+        }
+    }
+    return builder.obj();
+}
+
+void Histogram::linkBounds() {
+    size_t i = 0;
+    for (auto&& bound : _bounds) {
+        invariant(i < _buckets.size());
+        _buckets[i++].bound = bound;
+    }
+    invariant(i == _buckets.size());
+}
+
+double Histogram::estimateEqual(const BSONElement& value) const {
+    const auto it = std::lower_bound(
+        _buckets.begin(), _buckets.end(), value, [](const Bucket& bucket, const BSONElement& v) {
+            return compareValues(bucket.bound, v) < 0;
+        });
+    if (it == _buckets.end()) {
+        return 0.0;
+    }
+    if (compareValues(it->bound, value) == 0) {
+        return it->equalFreq;
+    }
+    if (it == _buckets.begin() || it->rangeNDV <= 0.0) {
+        return 0.0;
+    }
+
+    // Assume that the distinct values in the bucket's range are uniformly distributed.
+    return it->rangeFreq / it->rangeNDV;
+}
+
+double Histogram::estimateLessThan(const BSONElement& value, bool inclusive) const {
+    const auto it = std::lower_bound(
+        _buckets.begin(), _buckets.end(), value, [](const Bucket& bucket, const BSONElement& v) {
+            return compareValues(bucket.bound, v) < 0;
+        });
+    if (it == _buckets.end()) {
+        return getValueCount();
+    }
+
+    const double prevCumulativeFreq = it->cumulativeFreq - it->equalFreq - it->rangeFreq;
+    if (compareValues(it->bound, value) == 0) {
+        return prevCumulativeFreq + it->rangeFreq + (inclusive ? it->equalFreq : 0.0);
+    }
+    if (it == _buckets.begin()) {
+        return 0.0;
+    }
+
+    // The value falls strictly inside the range of this bucket.
+    return prevCumulativeFreq +
+        interpolate(std::prev(it)->bound, value, it->bound) * it->rangeFreq;
+}
+
+double Histogram::estimateRange(const BSONElement& low,
+                                bool lowInclusive,
+                                const BSONElement& high,
+                                bool highInclusive) const {
+    if (low.eoo() && high.eoo()) {
+        return getValueCount();
+    }
+
+    // Bracket an open side by the type of the other bound.
+    BSONObjBuilder bracketBuilder;
+    if (low.eoo()) {
+        bracketBuilder.appendMinForType("", high.type());
+    } else if (high.eoo()) {
+        bracketBuilder.appendMaxForType("", low.type());
+    }
+    const BSONObj bracket = bracketBuilder.obj();
+    const BSONElement lowBound = low.eoo() ? bracket.firstElement() : low;
+    const BSONElement highBound = high.eoo() ? bracket.firstElement() : high;
+    lowInclusive = lowInclusive || low.eoo();
+    highInclusive = highInclusive || high.eoo();
+
+    const int cmp = compareValues(lowBound, highBound);
+    if (cmp > 0 || (cmp == 0 && !(lowInclusive && highInclusive))) {
+        return 0.0;
+    }
+    if (cmp == 0) {
+        return estimateEqual(lowBound);
+    }
+
+    return std::max(0.0,
+                    estimateLessThan(highBound, highInclusive) -
+                        estimateLessThan(lowBound, !lowInclusive));
+}
+
+HistogramBuilder::HistogramBuilder(std::string path, size_t maxBuckets, size_t maxSampleSize)
+    : _path(std::move(path)),
+      _maxBuckets(std::max<size_t>(maxBuckets, 1)),
+      _maxSampleSize(std::max<size_t>(maxSampleSize, 1)),
+      _random(SecureRandom().nextInt64()) {}
+
+void HistogramBuilder::addDocument(const BSONObj& doc) {
+    _documents += 1.0;
+
+    BSONElementSet values;
+    dotted_path_support::extractAllElementsAlongPath(doc, _path, values);
+    for (auto&& value : values) {
+        addValue(value);
+    }
+}
+
+void HistogramBuilder::addValue(const BSONElement& value) {
+    _values += 1.0;
+    _typeCounts[typeName(value.type())] += 1.0;
+
+    if (_sample.size() < _maxSampleSize) {
+        _sample.push_back(value.wrap(""));
+        return;
+    }
+
+    // Reservoir sampling: keep the new value with probability sampleSize / values.
+    const auto slot = static_cast<size_t>(_random.nextInt64(static_cast<int64_t>(_values)));
+    if (slot < _maxSampleSize) {
+        _sample[slot] = value.wrap("");
+    }
+}
+
+Histogram HistogramBuilder::build() {
+    Histogram histogram;
+    histogram._documents = _documents;
+    histogram._typeCounts = _typeCounts;
+    if (_sample.empty()) {
+        return histogram;
+    }
+
+    std::sort(_sample.begin(), _sample.end(), [](const BSONObj& lhs, const BSONObj& rhs) {
+        return compareValues(lhs.firstElement(), rhs.firstElement()) < 0;
+    });
+
+    const double scale = _values / _sample.size();
+    const double depth = std::max(1.0, static_cast<double>(_sample.size()) / _maxBuckets);
+
+    BSONArrayBuilder bounds;
+    double cumulativeFreq = 0.0;
+    double rangeFreq = 0.0, rangeDistinct = 0.0, rangeSingletons = 0.0;
+    double distinct = 0.0, singletons = 0.0;
+
+    for (size_t begin = 0; begin < _sample.size();) {
+        const auto value = _sample[begin].firstElement();
+        size_t end = begin + 1;
+        while (end < _sample.size() && compareValues(_sample[end].firstElement(), value) == 0) {
+            ++end;
+        }
+        const double runLength = end - begin;
+
+        distinct += 1.0;
+        singletons += runLength == 1.0 ? 1.0 : 0.0;
+
+        // The minimum value always gets a bucket of its own, so that the range of every other
+        // bucket has a lower bound to interpolate from.
+        if (histogram._buckets.empty() || rangeFreq + runLength >= depth ||
+            end == _sample.size()) {
+            Histogram::Bucket bucket;
+            bucket.equalFreq = runLength * scale;
+            bucket.rangeFreq = rangeFreq * scale;
+            bucket.rangeNDV = estimateNDV(rangeDistinct, rangeSingletons, scale);
+            cumulativeFreq += bucket.equalFreq + bucket.rangeFreq;
+            bucket.cumulativeFreq = cumulativeFreq;
+
+            bounds.append(value);
+            histogram._buckets.push_back(bucket);
+            rangeFreq = rangeDistinct = rangeSingletons = 0.0;
+        } else {
+            rangeFreq += runLength;
+            rangeDistinct += 1.0;
+            rangeSingletons += runLength == 1.0 ? 1.0 : 0.0;
+        }
+
+        begin = end;
+    }
+
+    histogram._ndv = estimateNDV(distinct, singletons, scale);
+    histogram._bounds = bounds.obj();
+    histogram.linkBounds();
+    return histogram;
+}
+
+}  // namespace mongo::ce
@@ -0,0 +1,173 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "mongo/base/status_with.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/platform/random.h"
+
+namespace mongo::ce {
+
+/**
+ * An equi-depth histogram over the values found at a single, possibly dotted, path of a
+ * collection. Values are ordered according to the BSON canonical type ordering. Every document
+ * contributes each distinct value it holds along the path once, so values found inside arrays are
+ * counted individually and the total number of values may exceed the number of documents.
+ *
+ * Each bucket is identified by its inclusive upper bound and records how many values are equal to
+ * the bound, how many values lie strictly between the previous bound and this one, and how many
+ * distinct values that range holds. The first bucket never has a range, its bound is the minimum
+ * value seen.
+ */
+class Histogram {
+public:
+    struct Bucket {
+        // Points into the histogram's owned bounds array.
+        BSONElement bound;
+
+        double equalFreq = 0.0;
+        double rangeFreq = 0.0;
+        double rangeNDV = 0.0;
+
+        // Number of values less than or equal to 'bound'.
+        double cumulativeFreq = 0.0;
+    };
+
+    /**
+     * Parses a histogram previously produced by serialize().
+     */
+    static StatusWith<Histogram> parse(const BSONObj& obj);
+
+    Histogram() = default;
+
+    BSONObj serialize() const;
+
+    /**
+     * Estimated number of values equal to 'value'.
+     */
+    double estimateEqual(const BSONElement& value) const;
+
+    /**
+     * Estimated number of values between 'low' and 'high' (inclusivity determined by the flags).
+     * An EOO bound is treated as unbounded on that side. Since MQL comparisons are type bracketed,
+     * an unbounded side only extends to the extreme value of the other bound's canonical type.
+     */
+    double estimateRange(const BSONElement& low,
+                         bool lowInclusive,
+                         const BSONElement& high,
+                         bool highInclusive) const;
+
+    /**
+     * Number of documents the histogram was built from.
+     */
+    double getDocumentCount() const {
+        return _documents;
+    }
+
+    /**
+     * Number of values the histogram holds, which may differ from the number of documents when
+     * the path contains arrays or is missing in some documents.
+     */
+    double getValueCount() const {
+        return _buckets.empty() ? 0.0 : _buckets.back().cumulativeFreq;
+    }
+
+    /**
+     * Estimated number of distinct values.
+     */
+    double getNDV() const {
+        return _ndv;
+    }
+
+    /**
+     * Number of values per type, keyed by the type name.
+     */
+    const std::map<std::string, double>& getTypeCounts() const {
+        return _typeCounts;
+    }
+
+    const std::vector<Bucket>& getBuckets() const {
+        return _buckets;
+    }
+
+private:
+    friend class HistogramBuilder;
+
+    // Estimated number of values strictly less than 'value', or less than or equal to it when
+    // 'inclusive' is set.
+    double estimateLessThan(const BSONElement& value, bool inclusive) const;
+
+    // Points the bucket bounds into '_bounds'.
+    void linkBounds();
+
+    // Owns the bucket bounds, one array element per bucket.
+    BSONObj _bounds;
+    std::vector<Bucket> _buckets;
+    std::map<std::string, double> _typeCounts;
+    double _documents = 0.0;
+    double _ndv = 0.0;
+};
+
+/**
+ * Accumulates the values found along 'path' in a stream of documents and builds an equi-depth
+ * histogram from them. Once more than 'maxSampleSize' values have been seen, a uniform reservoir
+ * sample of them is kept and the bucket counts are scaled to the total number of values. The
+ * number of distinct values is then extrapolated with the GEE estimator of Charikar et al.
+ */
+class HistogramBuilder {
+public:
+    HistogramBuilder(std::string path, size_t maxBuckets, size_t maxSampleSize);
+
+    void addDocument(const BSONObj& doc);
+
+    Histogram build();
+
+private:
+    void addValue(const BSONElement& value);
+
+    const std::string _path;
+    const size_t _maxBuckets;
+    const size_t _maxSampleSize;
+
+    PseudoRandom _random;
+
+    // Each sampled value is the only element of its wrapping object.
+    std::vector<BSONObj> _sample;
+    std::map<std::string, double> _typeCounts;
+    double _documents = 0.0;
+    double _values = 0.0;
+};
+
+}  // namespace mongo::ce
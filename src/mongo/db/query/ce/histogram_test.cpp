@@ -0,0 +1,169 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/db/query/ce/histogram.h"
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo::ce {
+namespace {
+
+Histogram buildHistogram(const std::vector<BSONObj>& docs,
+                         size_t maxBuckets,
+                         size_t maxSampleSize = 1000) {
+    HistogramBuilder builder("a", maxBuckets, maxSampleSize);
+    for (auto&& doc : docs) {
+        builder.addDocument(doc);
+    }
+    return builder.build();
+}
+
+TEST(HistogramTest, EmptyHistogram) {
+    const auto histogram = buildHistogram({BSON("b" << 1)}, 4);
+    ASSERT_EQ(1.0, histogram.getDocumentCount());
+    ASSERT_EQ(0.0, histogram.getValueCount());
+    ASSERT_EQ(0.0, histogram.estimateEqual(BSON("" << 1).firstElement()));
+}
+
+TEST(HistogramTest, EqualityAndRangeOverIntegers) {
+    // Values 0..99, each appearing once, plus 50 copies of the value 7.
+    std::vector<BSONObj> docs;
+    for (int i = 0; i < 100; ++i) {
+        docs.push_back(BSON("a" << i));
+    }
+    for (int i = 0; i < 50; ++i) {
+        docs.push_back(BSON("a" << 7));
+    }
+
+    const auto histogram = buildHistogram(docs, 10);
+    ASSERT_EQ(150.0, histogram.getDocumentCount());
+    ASSERT_EQ(150.0, histogram.getValueCount());
+    ASSERT_EQ(100.0, histogram.getNDV());
+    ASSERT_LTE(histogram.getBuckets().size(), 11U);
+    ASSERT_EQ(150.0, histogram.getTypeCounts().at("int"));
+
+    // The frequent value gets a bucket of its own.
+    ASSERT_EQ(51.0, histogram.estimateEqual(BSON("" << 7).firstElement()));
+    ASSERT_APPROX_EQUAL(1.0, histogram.estimateEqual(BSON("" << 42).firstElement()), 0.5);
+    ASSERT_EQ(0.0, histogram.estimateEqual(BSON("" << 1000).firstElement()));
+    ASSERT_EQ(0.0, histogram.estimateEqual(BSON("" << -1).firstElement()));
+
+    // a >= 50.
+    const BSONObj fifty = BSON("" << 50);
+    ASSERT_APPROX_EQUAL(
+        50.0, histogram.estimateRange(fifty.firstElement(), true, BSONElement(), false), 5.0);
+
+    // a < 10, which includes the frequent value.
+    const BSONObj ten = BSON("" << 10);
+    ASSERT_APPROX_EQUAL(
+        60.0, histogram.estimateRange(BSONElement(), false, ten.firstElement(), false), 5.0);
+
+    // The whole histogram.
+    ASSERT_EQ(150.0, histogram.estimateRange(BSONElement(), false, BSONElement(), false));
+}
+
+TEST(HistogramTest, RangesAreTypeBracketed) {
+    std::vector<BSONObj> docs;
+    for (int i = 0; i < 20; ++i) {
+        docs.push_back(BSON("a" << i));
+        docs.push_back(BSON("a" << std::string(1, 'a' + i)));
+    }
+
+    const auto histogram = buildHistogram(docs, 8);
+    ASSERT_EQ(20.0, histogram.getTypeCounts().at("int"));
+    ASSERT_EQ(20.0, histogram.getTypeCounts().at("string"));
+
+    // a >= 0 does not match any strings. The bucket straddling both types is split in half.
+    const BSONObj zero = BSON("" << 0);
+    ASSERT_APPROX_EQUAL(
+        20.0, histogram.estimateRange(zero.firstElement(), true, BSONElement(), false), 3.0);
+
+    // a <= "z" does not match any numbers.
+    const BSONObj z = BSON(""
+                           << "z");
+    ASSERT_APPROX_EQUAL(
+        20.0, histogram.estimateRange(BSONElement(), false, z.firstElement(), true), 3.0);
+}
+
+TEST(HistogramTest, ArrayElementsAreCountedIndividually) {
+    const auto histogram =
+        buildHistogram({BSON("a" << BSON_ARRAY(1 << 2 << 2)), BSON("a" << BSON_ARRAY(2 << 3))}, 4);
+    ASSERT_EQ(2.0, histogram.getDocumentCount());
+    ASSERT_EQ(4.0, histogram.getValueCount());
+    ASSERT_EQ(2.0, histogram.estimateEqual(BSON("" << 2).firstElement()));
+}
+
+TEST(HistogramTest, SampledHistogramIsScaled) {
+    std::vector<BSONObj> docs;
+    for (int i = 0; i < 10000; ++i) {
+        docs.push_back(BSON("a" << (i % 100)));
+    }
+
+    const auto histogram = buildHistogram(docs, 10, 1000 /*maxSampleSize*/);
+    ASSERT_APPROX_EQUAL(10000.0, histogram.getValueCount(), 1.0);
+    ASSERT_EQ(10000.0, histogram.getTypeCounts().at("int"));
+    ASSERT_APPROX_EQUAL(100.0, histogram.getNDV(), 20.0);
+
+    const BSONObj fifty = BSON("" << 50);
+    ASSERT_APPROX_EQUAL(
+        5000.0, histogram.estimateRange(BSONElement(), false, fifty.firstElement(), false), 1000.0);
+}
+
+TEST(HistogramTest, SerializationRoundTrip) {
+    std::vector<BSONObj> docs;
+    for (int i = 0; i < 100; ++i) {
+        docs.push_back(BSON("a" << (i % 10) * 1.5));
+    }
+
+    const auto histogram = buildHistogram(docs, 4);
+    const auto parsed = Histogram::parse(histogram.serialize());
+    ASSERT_OK(parsed.getStatus());
+    ASSERT_BSONOBJ_EQ(histogram.serialize(), parsed.getValue().serialize());
+
+    const BSONObj value = BSON("" << 4.5);
+    ASSERT_EQ(histogram.estimateEqual(value.firstElement()),
+              parsed.getValue().estimateEqual(value.firstElement()));
+}
+
+TEST(HistogramTest, ParseRejectsUnorderedBounds) {
+    const BSONObj obj = BSON("documents" << 2 << "ndv" << 2 << "typeCounts" << BSON("int" << 2)
+                                         << "buckets"
+                                         << BSON_ARRAY(BSON("bound" << 2 << "equalFreq" << 1
+                                                                    << "rangeFreq" << 0
+                                                                    << "rangeNDV" << 0)
+                                                       << BSON("bound" << 1 << "equalFreq" << 1
+                                                                       << "rangeFreq" << 0
+                                                                       << "rangeNDV" << 0)));
+    ASSERT_NOT_OK(Histogram::parse(obj).getStatus());
+}
+
+}  // namespace
+}  // namespace mongo::ce
@@ -35,9 +35,15 @@ namespace mongo {
 namespace {
 ServerStatusMetricField<Counter64> totalPlanCacheSizeEstimateBytesMetric(
     "query.planCacheTotalSizeEstimateBytes", &mongo::planCacheTotalSizeEstimateBytes);
+ServerStatusMetricField<Counter64> planCacheEvictionsMetric("query.planCacheEvictions",
+                                                            &mongo::planCacheEvictions);
+ServerStatusMetricField<Counter64> planCacheAdmissionRejectionsMetric(
+    "query.planCacheAdmissionRejections", &mongo::planCacheAdmissionRejections);
 }  // namespace
 
 Counter64 planCacheTotalSizeEstimateBytes;
+Counter64 planCacheEvictions;
+Counter64 planCacheAdmissionRejections;
 
 std::ostream& operator<<(std::ostream& stream, const PlanCacheKey& key) {
     stream << key.toString();
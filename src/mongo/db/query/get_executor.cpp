@@ -381,6 +381,11 @@ void fillOutPlannerParams(OperationContext* opCtx,
         plannerParams->options |= QueryPlannerParams::GENERATE_COVERED_IXSCANS;
     }
 
+    if (internalQueryColumnScanPushDownPathFilters.load() &&
+        !plannerParams->columnarIndexes.empty()) {
+        plannerParams->options |= QueryPlannerParams::GENERATE_PER_COLUMN_FILTERS;
+    }
+
     if (shouldWaitForOplogVisibility(
             opCtx, collection, canonicalQuery->getFindCommandRequest().getTailable())) {
         plannerParams->options |= QueryPlannerParams::OPLOG_SCAN_WAIT_FOR_VISIBLE;
@@ -514,7 +519,8 @@ private:
  *     - An optional decisionWorks value, which is populated when a solution was reconstructed from
  *       the PlanCache, and will hold the number of work cycles taken to decide on a winning plan
  *       when the plan was first cached. It used to decided whether cached solution runtime planning
- *       needs to be done or not.
+ *       needs to be done or not. It is accompanied by the number of results the plan produced
+ *       within those work cycles.
  *     - A 'needSubplanning' flag indicating that the query contains rooted $or predicate and is
  *       eligible for runtime sub-planning.
  */
@@ -554,6 +560,10 @@ public:
         return _decisionWorks;
     }
 
+    size_t decisionResults() const {
+        return _decisionResults;
+    }
+
     bool needsSubplanning() const {
         return _needSubplanning;
     }
@@ -562,8 +572,9 @@ public:
         _needSubplanning = needsSubplanning;
     }
 
-    void setDecisionWorks(boost::optional<size_t> decisionWorks) {
+    void setDecisionWorks(boost::optional<size_t> decisionWorks, size_t decisionResults) {
         _decisionWorks = decisionWorks;
+        _decisionResults = decisionResults;
     }
 
     bool recoveredPinnedCacheEntry() const {
@@ -578,6 +589,7 @@ private:
     QuerySolutionVector _solutions;
     PlanStageVector _roots;
     boost::optional<size_t> _decisionWorks;
+    size_t _decisionResults{0};
     bool _needSubplanning{false};
     bool _recoveredPinnedCacheEntry{false};
 };
@@ -918,14 +930,15 @@ protected:
 
                     // Add a CachedPlanStage on top of the previous root.
                     //
-                    // 'decisionWorks' is used to determine whether the existing cache entry should
-                    // be evicted, and the query replanned.
+                    // 'decisionWorks' and 'decisionResults' are used to determine whether the
+                    // existing cache entry should be evicted, and the query replanned.
                     result->emplace(std::make_unique<CachedPlanStage>(_cq->getExpCtxRaw(),
                                                                       _collection,
                                                                       _ws,
                                                                       _cq,
                                                                       _plannerParams,
                                                                       cs->decisionWorks.get(),
+                                                                      cs->decisionResults,
                                                                       std::move(root)),
                                     std::move(querySolution));
                     return result;
@@ -1107,7 +1120,7 @@ protected:
                 auto&& planCache = sbe::getPlanCache(_opCtx);
                 auto cacheEntry = planCache.getCacheEntryIfActive(planCacheKey);
                 if (!cacheEntry) {
-                    return nullptr;
+                    return buildCachedPlanFromTemplateCache();
                 }
 
                 auto&& cachedPlan = std::move(cacheEntry->cachedPlan);
@@ -1116,7 +1129,7 @@ protected:
                 stageData.debugInfo = cacheEntry->debugInfo;
 
                 auto result = makeResult();
-                result->setDecisionWorks(cacheEntry->decisionWorks);
+                result->setDecisionWorks(cacheEntry->decisionWorks, cacheEntry->decisionResults);
                 result->setRecoveredPinnedCacheEntry(cacheEntry->isPinned());
                 result->emplace(std::make_pair(std::move(root), std::move(stageData)));
                 return result;
@@ -1128,6 +1141,57 @@ protected:
         return buildIdHackPlan();
     }
 
+    /**
+     * Recovers a plan compiled for the same query shape against another collection with identical
+     * indexes, and binds it to the main collection. The plan is subject to the same trial period
+     * as a plan recovered from the SBE plan cache, so a plan which performs poorly against this
+     * collection's data is replaced through replanning.
+     */
+    std::unique_ptr<SlotBasedPrepareExecutionResult> buildCachedPlanFromTemplateCache() {
+        if (!sbe::isPlanTemplateCacheEnabled() || !_collections.getSecondaryCollections().empty()) {
+            return nullptr;
+        }
+
+        initializePlannerParamsIfNeeded();
+        if (_plannerParams.indexFiltersApplied ||
+            (_plannerParams.options & QueryPlannerParams::INCLUDE_SHARD_FILTER)) {
+            return nullptr;
+        }
+
+        const auto& mainColl = getMainCollection();
+        auto cacheEntry = sbe::getPlanTemplateCache(_opCtx).getCacheEntryIfActive(
+            plan_cache_key_factory::make<sbe::PlanTemplateKey>(*_cq, mainColl));
+        if (!cacheEntry) {
+            return nullptr;
+        }
+
+        auto&& cachedPlan = std::move(cacheEntry->cachedPlan);
+        auto root = std::move(cachedPlan->root);
+        auto stageData = std::move(cachedPlan->planStageData);
+        stageData.debugInfo = cacheEntry->debugInfo;
+
+        // The index entries used to re-evaluate index bounds point into the index catalog of the
+        // collection the plan was compiled against. Replace them with this collection's entries.
+        for (auto&& indexBoundsInfo : stageData.indexBoundsEvaluationInfos) {
+            auto it = std::find_if(_plannerParams.indices.begin(),
+                                   _plannerParams.indices.end(),
+                                   [&](const IndexEntry& index) {
+                                       return index.identifier == indexBoundsInfo.index.identifier;
+                                   });
+            if (it == _plannerParams.indices.end()) {
+                return nullptr;
+            }
+            indexBoundsInfo.index = *it;
+        }
+
+        root->bindCollection(mainColl->uuid());
+
+        auto result = makeResult();
+        result->setDecisionWorks(cacheEntry->decisionWorks, cacheEntry->decisionResults);
+        result->emplace(std::make_pair(std::move(root), std::move(stageData)));
+        return result;
+    }
+
     // A temporary function to allow recovering SBE plans from the classic plan cache.
     // TODO SERVER-61314: Remove this function when "featureFlagSbePlanCache" is removed.
     std::unique_ptr<SlotBasedPrepareExecutionResult> buildCachedPlanFromClassicCache() {
@@ -1156,7 +1220,7 @@ protected:
                 auto&& execTree = buildExecutableTree(*querySolution);
 
                 result->emplace(std::move(execTree), std::move(querySolution));
-                result->setDecisionWorks(cs->decisionWorks);
+                result->setDecisionWorks(cs->decisionWorks, cs->decisionResults);
 
                 return result;
             }
@@ -1232,6 +1296,7 @@ std::unique_ptr<sbe::RuntimePlanner> makeRuntimePlannerIfNeeded(
     CanonicalQuery* canonicalQuery,
     size_t numSolutions,
     boost::optional<size_t> decisionWorks,
+    size_t decisionResults,
     bool needsSubplanning,
     PlanYieldPolicySBE* yieldPolicy,
     size_t plannerOptions) {
@@ -1268,13 +1333,18 @@ std::unique_ptr<sbe::RuntimePlanner> makeRuntimePlannerIfNeeded(
 
     // If we have a single solution but it was created from a cached plan, we will need to do the
     // runtime planning to check if the cached plan still performs efficiently, or requires
-    // re-planning. The 'decisionWorks' is used to determine whether the existing cache entry should
-    // be evicted, and the query re-planned.
+    // re-planning. The 'decisionWorks' and 'decisionResults' are used to determine whether the
+    // existing cache entry should be evicted, and the query re-planned.
     if (decisionWorks) {
         QueryPlannerParams plannerParams;
         plannerParams.options = plannerOptions;
-        return std::make_unique<sbe::CachedSolutionPlanner>(
-            opCtx, collections, *canonicalQuery, plannerParams, *decisionWorks, yieldPolicy);
+        return std::make_unique<sbe::CachedSolutionPlanner>(opCtx,
+                                                            collections,
+                                                            *canonicalQuery,
+                                                            plannerParams,
+                                                            *decisionWorks,
+                                                            decisionResults,
+                                                            yieldPolicy);
     }
 
     // Runtime planning is not required.
@@ -1329,6 +1399,7 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> getSlotBasedExe
                                                   cq.get(),
                                                   solutions.size(),
                                                   planningResult->decisionWorks(),
+                                                  planningResult->decisionResults(),
                                                   planningResult->needsSubplanning(),
                                                   yieldPolicy.get(),
                                                   plannerParams.options)) {
@@ -72,6 +72,11 @@ public:
         return _current > _max;
     }
 
+    // Returns true if the cache would run over budget if 'v' were added to it.
+    bool wouldBeOverBudget(const V& v) const {
+        return _current + Estimator{}(v) > _max;
+    }
+
     size_t currentBudget() const {
         return _current;
     }
@@ -229,6 +234,22 @@ public:
         return _kvMap.find(key) != _kvMap.end();
     }
 
+    /**
+     * Returns true if adding 'entry' under a key which is not yet in the kv-store would cause
+     * entries to be evicted.
+     */
+    bool wouldEvict(const V& entry) const {
+        return _budgetTracker.wouldBeOverBudget(entry);
+    }
+
+    /**
+     * Returns the least recently used entry, which is the next one to be evicted, or nullptr if
+     * the kv-store is empty. Unlike get(), this does not promote the entry.
+     */
+    const KVListEntry* leastRecentlyUsed() const {
+        return _kvList.empty() ? nullptr : &_kvList.back();
+    }
+
     /**
      * Returns the size (current budget) of the kv-store.
      */
@@ -335,6 +335,24 @@ TEST(LRUKeyValueTest, RemoveIfTest) {
     ASSERT_EQ(sizeAfter + nRemoved * TrivialBudgetEstimator::kSize, sizeBefore);
 }
 
+TEST(LRUKeyValueTest, LeastRecentlyUsedAndWouldEvict) {
+    NonTrivialTestSharedPtrValue cache{10};
+    ASSERT_EQ(cache.leastRecentlyUsed(), nullptr);
+
+    cache.add(1, std::make_shared<NonTrivialEntry>(1, 4));
+    cache.add(2, std::make_shared<NonTrivialEntry>(2, 4));
+    ASSERT_EQ(cache.leastRecentlyUsed()->first, 1U);
+
+    // Peeking at the least recently used entry does not promote it, unlike get().
+    ASSERT_EQ(cache.leastRecentlyUsed()->first, 1U);
+    ASSERT_OK(cache.get(1).getStatus());
+    ASSERT_EQ(cache.leastRecentlyUsed()->first, 2U);
+
+    ASSERT_FALSE(cache.wouldEvict(std::make_shared<NonTrivialEntry>(3, 2)));
+    ASSERT_TRUE(cache.wouldEvict(std::make_shared<NonTrivialEntry>(3, 3)));
+    ASSERT_EQ(cache.size(), 8U);
+}
+
 using TestUniquePtrValue = LRUKeyValue<int, std::unique_ptr<int>, TrivialBudgetEstimator>;
 
 TEST(LRUKeyValueTest, UniquePtrKeyValue) {
@@ -33,6 +33,7 @@
 #include "mongo/db/query/lru_key_value.h"
 #include "mongo/db/query/plan_cache_callbacks.h"
 #include "mongo/db/query/plan_cache_debug_info.h"
+#include "mongo/db/query/plan_cache_frequency_sketch.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/util/container_size_helper.h"
 
@@ -48,6 +49,13 @@ class PlanCacheEntryBase;
  */
 extern Counter64 planCacheTotalSizeEstimateBytes;
 
+/**
+ * Count the plan cache entries evicted to make room for new ones, and the new entries which were
+ * not admitted by the cost-aware admission policy, across all the plan caches.
+ */
+extern Counter64 planCacheEvictions;
+extern Counter64 planCacheAdmissionRejections;
+
 /**
  * Information returned from a get(...) query.
  */
@@ -61,6 +69,7 @@ public:
     CachedPlanHolder(const PlanCacheEntryBase<CachedPlanType, DebugInfoType>& entry)
         : cachedPlan(entry.cachedPlan->clone()),
           decisionWorks(entry.works),
+          decisionResults(entry.decisionResults),
           debugInfo(entry.debugInfo) {}
 
     /**
@@ -78,6 +87,9 @@ public:
     // is not subject to replanning.
     const boost::optional<size_t> decisionWorks;
 
+    // The number of results the plan produced within 'decisionWorks' when it was first cached.
+    const size_t decisionResults;
+
     // Per-plan cache entry information that is used for debugging purpose. Shared across all plans
     // recovered from the same cached entry.
     const std::shared_ptr<const DebugInfoType> debugInfo;
@@ -99,7 +111,9 @@ public:
                                          Date_t timeOfCreation,
                                          bool isActive,
                                          size_t works,
-                                         DebugInfoType debugInfo) {
+                                         DebugInfoType debugInfo,
+                                         size_t planningCost = 0,
+                                         size_t decisionResults = 0) {
         // If the cumulative size of the plan caches is estimated to remain within a predefined
         // threshold, then then include additional debug info which is not strictly necessary for
         // the plan cache to be functional. Once the cumulative plan cache size exceeds this
@@ -126,7 +140,9 @@ public:
                                                 indexFilterKey,
                                                 isActive,
                                                 works,
-                                                std::move(debugInfoOpt)));
+                                                std::move(debugInfoOpt),
+                                                planningCost,
+                                                decisionResults));
     }
 
     /**
@@ -148,7 +164,9 @@ public:
                       indexFilterKey,
                       true,         // isActive
                       boost::none,  // decisionWorks
-                      std::make_shared<const DebugInfoType>(std::move(debugInfo))));
+                      std::make_shared<const DebugInfoType>(std::move(debugInfo)),
+                      0,    // planningCost
+                      0));  // decisionResults
     }
 
     ~PlanCacheEntryBase() {
@@ -175,7 +193,9 @@ public:
                                                 indexFilterKey,
                                                 isActive,
                                                 works,
-                                                debugInfo));
+                                                debugInfo,
+                                                planningCost,
+                                                decisionResults));
     }
 
     std::string debugString() const {
@@ -223,6 +243,16 @@ public:
     // debug information. Read-only and shared between all plans recovered from this entry.
     const std::shared_ptr<const DebugInfoType> debugInfo;
 
+    // The amount of work, summed over all candidate plans, which was spent in the trial period to
+    // pick this plan. This is the work a cache hit saves, and is used to weigh the entry against
+    // others by the cost-aware admission policy. Zero for pinned entries.
+    const size_t planningCost;
+
+    // The number of results the winning plan produced during the trial period which picked it. It
+    // is compared against the results the cached plan produces when it is recovered from the cache,
+    // so that the query can be replanned early if the two diverge. Zero for pinned entries.
+    const size_t decisionResults;
+
     // An estimate of the size in bytes of this plan cache entry. This is the "deep size",
     // calculated by recursively incorporating the size of owned objects, the objects that they in
     // turn own, and so on.
@@ -239,7 +269,9 @@ private:
                        uint32_t indexFilterKey,
                        bool isActive,
                        boost::optional<size_t> works,
-                       std::shared_ptr<const DebugInfoType> debugInfo)
+                       std::shared_ptr<const DebugInfoType> debugInfo,
+                       size_t planningCost,
+                       size_t decisionResults)
         : cachedPlan(std::move(cachedPlan)),
           timeOfCreation(timeOfCreation),
           queryHash(queryHash),
@@ -248,6 +280,8 @@ private:
           isActive(isActive),
           works(works),
           debugInfo(std::move(debugInfo)),
+          planningCost(planningCost),
+          decisionResults(decisionResults),
           estimatedEntrySizeBytes(_estimateObjectSizeInBytes()) {
         tassert(6108300, "A plan cache entry should never be empty", this->cachedPlan);
         tassert(6108301, "Pinned cache entry should always be active", !isPinned() || isActive);
@@ -278,6 +312,13 @@ private:
  * 'KeyType' to 'CachedPlanType'. The cache key is derived from the query, and can be used to
  * determine whether a cached plan is available. The cache has an LRU replacement policy, so it only
  * keeps the most recently used plans.
+ *
+ * If the cache is constructed with a frequency sketch, it additionally applies a TinyLFU-style
+ * admission policy when 'internalQueryCacheEnableCostAwareAdmission' is set: a new entry which
+ * would cause an eviction is only admitted if the planning work it is expected to save per byte,
+ * given how often its key is looked up, is at least that of the entry it would evict. This keeps a
+ * high-cardinality workload of rarely repeated shapes from flushing the plans of hot shapes. Key
+ * lookups are only recorded in the sketch while the knob is set.
  */
 template <class KeyType,
           class CachedPlanType,
@@ -325,13 +366,19 @@ public:
     };
 
     /**
-     * Initialize plan cache with the total cache size in bytes and number of partitions.
+     * Initialize plan cache with the total cache size in bytes and number of partitions. A non-zero
+     * 'frequencySketchWidth' enables tracking of key frequencies for cost-aware admission.
      */
-    explicit PlanCacheBase(size_t cacheSize, size_t numPartitions = 1)
+    explicit PlanCacheBase(size_t cacheSize,
+                           size_t numPartitions = 1,
+                           size_t frequencySketchWidth = 0)
         : _numPartitions(numPartitions) {
         invariant(numPartitions > 0);
         Lru lru{cacheSize / numPartitions};
         _partitionedCache = std::make_unique<Partitioned<Lru, Partitioner>>(numPartitions, lru);
+        if (frequencySketchWidth > 0) {
+            _frequencySketch = std::make_unique<PlanCacheFrequencySketch>(frequencySketchWidth);
+        }
     }
 
     ~PlanCacheBase() = default;
@@ -374,6 +421,30 @@ public:
                                              details.candidatePlanStats[0].get());
                                      }},
             why.stats);
+        auto decisionResults = stdx::visit(
+            visit_helper::Overloaded{[](const plan_ranker::StatsDetails& details) {
+                                         return details.candidatePlanStats[0]->common.advanced;
+                                     },
+                                     [](const plan_ranker::SBEStatsDetails& details) {
+                                         return details.candidatePlanStats[0]->common.advances;
+                                     }},
+            why.stats);
+        auto planningCost = stdx::visit(
+            visit_helper::Overloaded{[](const plan_ranker::StatsDetails& details) {
+                                         size_t cost = 0;
+                                         for (auto&& stats : details.candidatePlanStats) {
+                                             cost += stats->common.works;
+                                         }
+                                         return cost;
+                                     },
+                                     [](const plan_ranker::SBEStatsDetails& details) {
+                                         size_t cost = 0;
+                                         for (auto&& stats : details.candidatePlanStats) {
+                                             cost += calculateNumberOfReads(stats.get());
+                                         }
+                                         return cost;
+                                     }},
+            why.stats);
 
         auto partition = _partitionedCache->lockOnePartition(key);
         auto [queryHash, planCacheKey, isNewEntryActive, shouldBeCreated, increasedWorks] = [&]() {
@@ -432,9 +503,16 @@ public:
                                                         now,
                                                         isNewEntryActive,
                                                         increasedWorks ? *increasedWorks : newWorks,
-                                                        callbacks->buildDebugInfo());
+                                                        callbacks->buildDebugInfo(),
+                                                        planningCost,
+                                                        decisionResults);
+
+        if (!shouldAdmit(*partition, key, newEntry)) {
+            planCacheAdmissionRejections.increment();
+            return Status::OK();
+        }
 
-        partition->add(key, std::move(newEntry));
+        planCacheEvictions.increment(partition->add(key, std::move(newEntry)));
         return Status::OK();
     }
 
@@ -455,9 +533,7 @@ public:
                                                            now,
                                                            std::move(debugInfo));
         auto partition = _partitionedCache->lockOnePartition(key);
-        // We're not interested in the number of evicted entries if the cache store exceeds the
-        // budget after add(), so we just ignore the return value.
-        partition->add(key, std::move(entry));
+        planCacheEvictions.increment(partition->add(key, std::move(entry)));
     }
 
     /**
@@ -496,6 +572,12 @@ public:
      * for the query (if there is one).
      */
     GetResult get(const KeyType& key) const {
+        // Lookups are only counted while cost-aware admission is on, so that the default
+        // configuration does not pay for the shared counters of the sketch on every query.
+        if (_frequencySketch && internalQueryCacheEnableCostAwareAdmission.load()) {
+            _frequencySketch->increment(KeyHasher{}(key));
+        }
+
         std::shared_ptr<const Entry> entryPtr;
         CacheEntryState state;
         {
@@ -563,6 +645,9 @@ public:
      */
     void clear() {
         _partitionedCache->clear();
+        if (_frequencySketch) {
+            _frequencySketch->clear();
+        }
     }
 
     /**
@@ -652,6 +737,17 @@ public:
         return results;
     }
 
+    /**
+     * Returns the estimated number of recent lookups of 'key', or boost::none if this cache does
+     * not track key frequencies. Lookups made while cost-aware admission is off are not counted.
+     */
+    boost::optional<uint32_t> estimateFrequency(const KeyType& key) const {
+        if (!_frequencySketch) {
+            return boost::none;
+        }
+        return _frequencySketch->estimate(KeyHasher{}(key));
+    }
+
 private:
     struct NewEntryState {
         bool shouldBeCreated = false;
@@ -736,8 +832,40 @@ private:
         return res;
     }
 
+    /**
+     * Implements the cost-aware admission policy. Entries replacing an existing entry for the same
+     * key, and entries which fit in the partition without evicting anything, are always admitted.
+     * Otherwise the candidate's benefit, its key frequency times the planning cost it saves per
+     * byte, is compared with that of the least recently used entry, which is the eviction victim.
+     */
+    bool shouldAdmit(const Lru& partition,
+                     const KeyType& key,
+                     const std::shared_ptr<const Entry>& candidate) const {
+        if (!_frequencySketch || !internalQueryCacheEnableCostAwareAdmission.load() ||
+            partition.hasKey(key) || !partition.wouldEvict(candidate)) {
+            return true;
+        }
+
+        auto victim = partition.leastRecentlyUsed();
+        if (!victim) {
+            return true;
+        }
+
+        auto benefit = [&](const KeyType& entryKey, const Entry& entry) {
+            // Add one to the cost so that entries chosen without any work still count their
+            // frequency.
+            return static_cast<double>(_frequencySketch->estimate(KeyHasher{}(entryKey))) *
+                (entry.planningCost + 1) / std::max<uint64_t>(entry.estimatedEntrySizeBytes, 1);
+        };
+        return benefit(key, *candidate) >= benefit(victim->first, *victim->second);
+    }
+
     std::size_t _numPartitions;
     std::unique_ptr<Partitioned<Lru, Partitioner>> _partitionedCache;
+
+    // Tracks how often each key is looked up. Only present if the cache was constructed with a
+    // non-zero sketch width.
+    std::unique_ptr<PlanCacheFrequencySketch> _frequencySketch;
 };
 
 }  // namespace mongo
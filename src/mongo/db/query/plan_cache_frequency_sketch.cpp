@@ -0,0 +1,133 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/db/query/plan_cache_frequency_sketch.h"
+
+#include <algorithm>
+
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+namespace {
+// Odd multipliers used to derive an independent hash for each row of the sketch.
+constexpr uint64_t kRowSeeds[PlanCacheFrequencySketch::kDepth] = {
+    0x97cb3127ab8d3c61ULL, 0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL, 0x9ae16a3b2f90404fULL};
+
+// Clears the top bit of every 4-bit counter in a word, so that shifting the word right by one
+// halves each counter without carrying a bit into its neighbour.
+constexpr uint64_t kHalvingMask = 0x7777777777777777ULL;
+
+size_t bitOffset(size_t index) {
+    return 4 * (index % PlanCacheFrequencySketch::kCountersPerWord);
+}
+
+size_t roundUpToPowerOfTwo(size_t n) {
+    size_t result = 1;
+    while (result < n) {
+        result <<= 1;
+    }
+    return result;
+}
+}  // namespace
+
+PlanCacheFrequencySketch::PlanCacheFrequencySketch(size_t width)
+    : _mask(roundUpToPowerOfTwo(std::max<size_t>(width, 1)) - 1),
+      _sampleSize(10 * (_mask + 1)),
+      _words(std::make_unique<AtomicWord<uint64_t>[]>(numWords())) {}
+
+size_t PlanCacheFrequencySketch::counterIndex(size_t hash, size_t row) const {
+    uint64_t h = static_cast<uint64_t>(hash) * kRowSeeds[row];
+    h ^= h >> 32;
+    return row * (_mask + 1) + (h & _mask);
+}
+
+uint32_t PlanCacheFrequencySketch::loadCounter(size_t index) const {
+    return (_words[index / kCountersPerWord].load() >> bitOffset(index)) & kMaxCount;
+}
+
+void PlanCacheFrequencySketch::incrementCounter(size_t index, uint32_t expected) {
+    auto& word = _words[index / kCountersPerWord];
+    const auto offset = bitOffset(index);
+    auto value = word.load();
+    // Retries when another counter of the same word changed concurrently.
+    while (((value >> offset) & kMaxCount) == expected) {
+        if (word.compareAndSwap(&value, value + (uint64_t{1} << offset))) {
+            return;
+        }
+    }
+}
+
+void PlanCacheFrequencySketch::increment(size_t hash) {
+    // Conservative update: only the counters equal to the current minimum are incremented, which
+    // reduces the overestimation caused by hash collisions.
+    size_t indexes[kDepth];
+    uint32_t min = kMaxCount;
+    for (size_t row = 0; row < kDepth; ++row) {
+        indexes[row] = counterIndex(hash, row);
+        min = std::min(min, loadCounter(indexes[row]));
+    }
+    if (min < kMaxCount) {
+        for (size_t row = 0; row < kDepth; ++row) {
+            incrementCounter(indexes[row], min);
+        }
+    }
+
+    if (_additions.addAndFetch(1) >= _sampleSize) {
+        age();
+    }
+}
+
+uint32_t PlanCacheFrequencySketch::estimate(size_t hash) const {
+    uint32_t min = kMaxCount;
+    for (size_t row = 0; row < kDepth; ++row) {
+        min = std::min(min, loadCounter(counterIndex(hash, row)));
+    }
+    return min;
+}
+
+void PlanCacheFrequencySketch::age() {
+    // Only the thread which observes the sample size being reached halves the counters.
+    auto additions = _additions.load();
+    if (additions < _sampleSize || !_additions.compareAndSwap(&additions, additions / 2)) {
+        return;
+    }
+    for (size_t i = 0; i < numWords(); ++i) {
+        _words[i].store((_words[i].load() >> 1) & kHalvingMask);
+    }
+}
+
+void PlanCacheFrequencySketch::clear() {
+    for (size_t i = 0; i < numWords(); ++i) {
+        _words[i].store(0);
+    }
+    _additions.store(0);
+}
+
+}  // namespace mongo
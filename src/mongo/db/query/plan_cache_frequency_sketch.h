@@ -0,0 +1,110 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "mongo/platform/atomic_word.h"
+
+namespace mongo {
+
+/**
+ * An approximate frequency counter for plan cache keys, in the style of the TinyLFU admission
+ * policy. It is a count-min sketch of 4-bit saturating counters, packed sixteen to a 64-bit word:
+ * each key hash is mapped to one counter in each of 'kDepth' rows and its estimated frequency is
+ * the minimum of those counters.
+ * Once the number of recorded accesses reaches ten times the width of the sketch, all counters are
+ * halved so that the estimates favour recent history.
+ *
+ * The sketch is safe to use concurrently without external synchronization. Concurrent updates may
+ * occasionally be lost, which only makes the estimates slightly less precise.
+ */
+class PlanCacheFrequencySketch {
+public:
+    static constexpr size_t kDepth = 4;
+    static constexpr uint32_t kMaxCount = 15;
+    static constexpr size_t kCountersPerWord = 16;
+
+    /**
+     * Creates a sketch with at least 'width' counters per row. The width is rounded up to a power
+     * of two.
+     */
+    explicit PlanCacheFrequencySketch(size_t width);
+
+    /**
+     * Records an access to the key with the given hash.
+     */
+    void increment(size_t hash);
+
+    /**
+     * Returns the estimated number of recent accesses to the key with the given hash, between 0 and
+     * 'kMaxCount'.
+     */
+    uint32_t estimate(size_t hash) const;
+
+    /**
+     * Resets all counters to zero.
+     */
+    void clear();
+
+    size_t width() const {
+        return _mask + 1;
+    }
+
+private:
+    size_t counterIndex(size_t hash, size_t row) const;
+
+    uint32_t loadCounter(size_t index) const;
+
+    // Increments the counter at 'index' if it still holds 'expected'.
+    void incrementCounter(size_t index, uint32_t expected);
+
+    size_t numWords() const {
+        return (kDepth * (_mask + 1) + kCountersPerWord - 1) / kCountersPerWord;
+    }
+
+    // Halves all counters.
+    void age();
+
+    const size_t _mask;
+    const size_t _sampleSize;
+
+    // 'kDepth' rows of counters, stored row after row. Counter 'i' is held in the four bits at
+    // offset 4 * (i % kCountersPerWord) of word i / kCountersPerWord.
+    std::unique_ptr<AtomicWord<uint64_t>[]> _words;
+
+    // The number of accesses recorded since the counters were last halved.
+    AtomicWord<size_t> _additions{0};
+};
+
+}  // namespace mongo
@@ -0,0 +1,90 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/db/query/plan_cache_frequency_sketch.h"
+
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+TEST(PlanCacheFrequencySketchTest, WidthIsRoundedUpToPowerOfTwo) {
+    ASSERT_EQ(PlanCacheFrequencySketch(1).width(), 1U);
+    ASSERT_EQ(PlanCacheFrequencySketch(100).width(), 128U);
+    ASSERT_EQ(PlanCacheFrequencySketch(1024).width(), 1024U);
+}
+
+TEST(PlanCacheFrequencySketchTest, EstimatesFrequencies) {
+    PlanCacheFrequencySketch sketch(1024);
+    ASSERT_EQ(sketch.estimate(1), 0U);
+
+    for (int i = 0; i < 5; ++i) {
+        sketch.increment(1);
+    }
+    sketch.increment(2);
+
+    ASSERT_EQ(sketch.estimate(1), 5U);
+    ASSERT_EQ(sketch.estimate(2), 1U);
+    ASSERT_EQ(sketch.estimate(3), 0U);
+}
+
+TEST(PlanCacheFrequencySketchTest, CountersSaturate) {
+    PlanCacheFrequencySketch sketch(1024);
+    for (int i = 0; i < 100; ++i) {
+        sketch.increment(42);
+    }
+    ASSERT_EQ(sketch.estimate(42), PlanCacheFrequencySketch::kMaxCount);
+}
+
+TEST(PlanCacheFrequencySketchTest, CountersAreHalvedAfterSampleSizeIsReached) {
+    // The sample size is ten times the width, so 160 additions trigger aging.
+    PlanCacheFrequencySketch sketch(16);
+    for (int i = 0; i < 8; ++i) {
+        sketch.increment(7);
+    }
+    ASSERT_EQ(sketch.estimate(7), 8U);
+
+    // Spread the remaining additions over many other keys.
+    for (size_t i = 0; i < 152; ++i) {
+        sketch.increment(1000 + i);
+    }
+    ASSERT_LTE(sketch.estimate(7), 7U);
+}
+
+TEST(PlanCacheFrequencySketchTest, ClearResetsCounters) {
+    PlanCacheFrequencySketch sketch(64);
+    sketch.increment(1);
+    sketch.increment(1);
+    sketch.clear();
+    ASSERT_EQ(sketch.estimate(1), 0U);
+}
+
+}  // namespace
+}  // namespace mongo
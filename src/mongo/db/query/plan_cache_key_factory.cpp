@@ -129,6 +129,58 @@ boost::optional<Timestamp> computeNewestVisibleIndexTimestamp(OperationContext*
 
     return currentNewestVisible.isNull() ? boost::optional<Timestamp>{} : currentNewestVisible;
 }
+
+/**
+ * Returns a binary encoding of everything about 'collection' that a compiled SBE plan depends on,
+ * other than the collection's identity: the specification and multikey state of every ready index
+ * visible to this operation, the default collation and the clustering options. Indexes are
+ * encoded in name order so that the result does not depend on the order they were built in.
+ */
+std::string computeIndexCatalogFingerprint(OperationContext* opCtx,
+                                           const CollectionPtr& collection) {
+    auto recoveryUnit = opCtx->recoveryUnit();
+    auto mySnapshot = recoveryUnit->getPointInTimeReadTimestamp(opCtx).get_value_or(
+        recoveryUnit->getCatalogConflictingTimestamp());
+
+    std::vector<const IndexCatalogEntry*> entries;
+    auto ii = collection->getIndexCatalog()->getIndexIterator(
+        opCtx, IndexCatalog::InclusionPolicy::kReady);
+    while (ii->more()) {
+        const IndexCatalogEntry* ice = ii->next();
+        auto minVisibleSnapshot = ice->getMinimumVisibleSnapshot();
+        if (!mySnapshot.isNull() && minVisibleSnapshot && mySnapshot < *minVisibleSnapshot) {
+            continue;
+        }
+        entries.push_back(ice);
+    }
+    std::sort(entries.begin(), entries.end(), [](auto&& lhs, auto&& rhs) {
+        return lhs->descriptor()->indexName() < rhs->descriptor()->indexName();
+    });
+
+    BSONObjBuilder bob;
+    {
+        BSONArrayBuilder indexes(bob.subarrayStart("indexes"));
+        for (auto&& ice : entries) {
+            BSONObjBuilder index(indexes.subobjStart());
+            index.append("spec", ice->descriptor()->infoObj());
+            index.append("multikey", ice->isMultikey(opCtx, collection));
+            BSONArrayBuilder paths(index.subarrayStart("multikeyPaths"));
+            for (auto&& components : ice->getMultikeyPaths(opCtx, collection)) {
+                BSONArrayBuilder pathComponents(paths.subarrayStart());
+                for (auto&& component : components) {
+                    pathComponents.append(static_cast<long long>(component));
+                }
+            }
+        }
+    }
+    bob.append("collation", collection->getCollectionOptions().collation);
+    if (auto clusteredInfo = collection->getClusteredInfo()) {
+        bob.append("clusteredIndex", clusteredInfo->toBSON());
+    }
+
+    auto fingerprint = bob.obj();
+    return {fingerprint.objdata(), static_cast<size_t>(fingerprint.objsize())};
+}
 }  // namespace
 
 sbe::PlanCacheKey make(const CanonicalQuery& query,
@@ -148,5 +200,12 @@ sbe::PlanCacheKey make(const CanonicalQuery& query,
             computeNewestVisibleIndexTimestamp(opCtx, collection),
             keyShardingEpoch};
 }
+
+sbe::PlanTemplateKey make(const CanonicalQuery& query,
+                          const CollectionPtr& collection,
+                          PlanCacheKeyTag<sbe::PlanTemplateKey>) {
+    return {makePlanCacheKeyInfo(query, collection),
+            computeIndexCatalogFingerprint(query.getOpCtx(), collection)};
+}
 }  // namespace plan_cache_detail
 }  // namespace mongo
@@ -64,6 +64,14 @@ PlanCacheKey make(const CanonicalQuery& query,
 sbe::PlanCacheKey make(const CanonicalQuery& query,
                        const CollectionPtr& collection,
                        PlanCacheKeyTag<sbe::PlanCacheKey> tag);
+
+/**
+ * Creates a key for the SBE plan template cache from the canonical query and collection instances.
+ * The key does not identify the collection, only the shape of its index catalog.
+ */
+sbe::PlanTemplateKey make(const CanonicalQuery& query,
+                          const CollectionPtr& collection,
+                          PlanCacheKeyTag<sbe::PlanTemplateKey> tag);
 }  // namespace plan_cache_detail
 
 namespace plan_cache_key_factory {
@@ -391,6 +391,67 @@ TEST(PlanCacheTest, PlanCacheLRUPolicyRemovesInactiveEntries) {
     ASSERT_EQ(planCache.get(keyC).state, PlanCache::CacheEntryState::kPresentInactive);
 }
 
+TEST(PlanCacheTest, PlanCacheCostAwareAdmissionRejectsColdEntries) {
+    internalQueryCacheEnableCostAwareAdmission.store(true);
+    ON_BLOCK_EXIT([] { internalQueryCacheEnableCostAwareAdmission.store(false); });
+
+    // Use a tiny cache size and track key frequencies.
+    const size_t kCacheSize = 2;
+    PlanCache planCache(kCacheSize, 1 /* numPartitions */, 64 /* frequencySketchWidth */);
+    QueryTestServiceContext serviceContext;
+
+    unique_ptr<CanonicalQuery> cqA(canonicalize("{a: 1}"));
+    unique_ptr<CanonicalQuery> cqB(canonicalize("{b: 1}"));
+    auto keyA = makeKey(*cqA);
+    auto keyB = makeKey(*cqB);
+    addCacheEntryForShape(*cqA.get(), &planCache);
+    addCacheEntryForShape(*cqB.get(), &planCache);
+
+    // Make both shapes hot.
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_EQ(planCache.get(keyA).state, PlanCache::CacheEntryState::kPresentInactive);
+        ASSERT_EQ(planCache.get(keyB).state, PlanCache::CacheEntryState::kPresentInactive);
+    }
+
+    // A shape which has been looked up only once is not admitted, as it would evict a hot entry.
+    const auto rejectionsBefore = planCacheAdmissionRejections.get();
+    unique_ptr<CanonicalQuery> cqC(canonicalize("{c: 1}"));
+    auto keyC = makeKey(*cqC);
+    ASSERT_EQ(planCache.get(keyC).state, PlanCache::CacheEntryState::kNotPresent);
+    addCacheEntryForShape(*cqC.get(), &planCache);
+    ASSERT_EQ(planCacheAdmissionRejections.get(), rejectionsBefore + 1);
+    ASSERT_EQ(planCache.get(keyC).state, PlanCache::CacheEntryState::kNotPresent);
+    ASSERT_EQ(planCache.get(keyA).state, PlanCache::CacheEntryState::kPresentInactive);
+    ASSERT_EQ(planCache.get(keyB).state, PlanCache::CacheEntryState::kPresentInactive);
+
+    // Once the shape becomes hotter than the least recently used entry, it is admitted.
+    for (int i = 0; i < 10; ++i) {
+        planCache.get(keyC);
+    }
+    addCacheEntryForShape(*cqC.get(), &planCache);
+    ASSERT_EQ(planCacheAdmissionRejections.get(), rejectionsBefore + 1);
+    ASSERT_EQ(planCache.get(keyC).state, PlanCache::CacheEntryState::kPresentInactive);
+    ASSERT_EQ(planCache.get(keyA).state, PlanCache::CacheEntryState::kNotPresent);
+    ASSERT_EQ(planCache.size(), kCacheSize);
+}
+
+TEST(PlanCacheTest, PlanCacheDoesNotCountLookupsWithoutCostAwareAdmission) {
+    PlanCache planCache(5000, 1 /* numPartitions */, 64 /* frequencySketchWidth */);
+    unique_ptr<CanonicalQuery> cq(canonicalize("{a: 1}"));
+    auto key = makeKey(*cq);
+
+    ASSERT_FALSE(internalQueryCacheEnableCostAwareAdmission.load());
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_EQ(planCache.get(key).state, PlanCache::CacheEntryState::kNotPresent);
+    }
+    ASSERT_EQ(*planCache.estimateFrequency(key), 0U);
+
+    internalQueryCacheEnableCostAwareAdmission.store(true);
+    ON_BLOCK_EXIT([] { internalQueryCacheEnableCostAwareAdmission.store(false); });
+    planCache.get(key);
+    ASSERT_EQ(*planCache.estimateFrequency(key), 1U);
+}
+
 TEST(PlanCacheTest, PlanCacheRemoveDeletesInactiveEntries) {
     PlanCache planCache(5000);
     unique_ptr<CanonicalQuery> cq(canonicalize("{a: 1}"));
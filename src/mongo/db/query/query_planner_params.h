@@ -156,8 +156,7 @@ struct QueryPlannerParams {
         RETURN_OWNED_DATA = 1 << 12,
 
         // When generating column scan queries, splits match expressions so that the filters can be
-        // applied per-column. This is off by default, since the execution side doesn't support it
-        // yet.
+        // applied per-column.
         GENERATE_PER_COLUMN_FILTERS = 1 << 13,
     };
 
@@ -32,11 +32,13 @@
 #include "mongo/db/query/sbe_cached_solution_planner.h"
 
 #include "mongo/db/exec/plan_cache_util.h"
+#include "mongo/db/exec/trial_period_utils.h"
 #include "mongo/db/exec/sbe/stages/plan_stats.h"
 #include "mongo/db/query/collection_query_info.h"
 #include "mongo/db/query/explain.h"
 #include "mongo/db/query/get_executor.h"
 #include "mongo/db/query/plan_cache_key_factory.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/query_planner.h"
 #include "mongo/db/query/sbe_multi_planner.h"
 #include "mongo/db/query/stage_builder_util.h"
@@ -72,10 +74,12 @@ CandidatePlans CachedSolutionPlanner::plan(
     // per trial run computed based on previous decision reads. If the trial run ends before
     // reaching EOF, it will use the 'checkNumReads' function to determine if it should continue
     // executing or immediately terminate execution.
+    bool cardinalityDiverged = false;
     auto candidate = collectExecutionStatsForCachedPlan(std::move(solutions[0]),
                                                         std::move(roots[0].first),
                                                         std::move(roots[0].second),
-                                                        maxReadsBeforeReplan);
+                                                        maxReadsBeforeReplan,
+                                                        &cardinalityDiverged);
     auto explainer = plan_explainer_factory::make(
         candidate.root.get(),
         &candidate.data,
@@ -110,6 +114,25 @@ CandidatePlans CachedSolutionPlanner::plan(
     auto visitor = PlanStatsNumReadsVisitor{};
     candidate.root->accumulate(kEmptyPlanNodeId, &visitor);
     const auto numReads = visitor.numReads;
+    if (cardinalityDiverged) {
+        LOGV2_DEBUG(7086771,
+                    1,
+                    "Evicting cache entry for a query and replanning it since the cached plan "
+                    "produced fewer results than expected",
+                    "numReads"_attr = numReads,
+                    "numResults"_attr = candidate.results.size(),
+                    "decisionReads"_attr = _decisionReads,
+                    "decisionResults"_attr = _decisionResults,
+                    "query"_attr = redact(_cq.toStringShort()),
+                    "planSummary"_attr = explainer->getPlanSummary());
+        return replan(true,
+                      str::stream()
+                          << "cached plan was less efficient than expected: expected trial "
+                          << "execution to produce " << _decisionResults << " results in "
+                          << _decisionReads << " reads but it produced "
+                          << candidate.results.size() << " results in " << numReads << " reads");
+    }
+
     LOGV2_DEBUG(
         2058001,
         1,
@@ -130,7 +153,8 @@ plan_ranker::CandidatePlan CachedSolutionPlanner::collectExecutionStatsForCached
     std::unique_ptr<QuerySolution> solution,
     std::unique_ptr<PlanStage> root,
     stage_builder::PlanStageData data,
-    size_t maxTrialPeriodNumReads) {
+    size_t maxTrialPeriodNumReads,
+    bool* cardinalityDiverged) {
     const auto maxNumResults{trial_period::getTrialPeriodNumToReturn(_cq)};
 
     plan_ranker::CandidatePlan candidate{std::move(solution),
@@ -149,10 +173,35 @@ plan_ranker::CandidatePlan CachedSolutionPlanner::collectExecutionStatsForCached
     // to replan, so we let the tracker terminate the trial. Otherwise, the plan is still good and
     // we promote it from a candidate to "normal" by detaching the tracker and letting
     // 'executeCandidateTrial()' reach 'maxNumResults'.
-    auto onMetricReached = [&candidate](TrialRunTracker::TrialRunMetric metric) {
+    //
+    // If adaptive replanning is enabled, the tracker first stops the trial once the plan has done
+    // as many reads as when it was cached, and then each time it has doubled its reads, in order to
+    // compare the number of results produced so far with the number expected from the cache entry.
+    // Unless the two diverge, the trial continues until 'maxTrialPeriodNumReads' is exceeded.
+    const bool checkCardinality =
+        internalQueryCacheEnableAdaptiveReplanning.load() && _decisionResults > 0;
+    TrialRunTracker* trackerPtr = nullptr;
+    auto onMetricReached = [&, maxTrialPeriodNumReads](TrialRunTracker::TrialRunMetric metric) {
         switch (metric) {
-            case TrialRunTracker::kNumReads:
-                return true;  // terminate the trial run
+            case TrialRunTracker::kNumReads: {
+                const auto numReads = trackerPtr->getMetric<TrialRunTracker::kNumReads>();
+                if (!checkCardinality || numReads > maxTrialPeriodNumReads) {
+                    return true;  // terminate the trial run
+                }
+
+                // Blocking stages count the results of their children as trial run results.
+                const auto numResults =
+                    std::max(candidate.results.size(),
+                             trackerPtr->getMetric<TrialRunTracker::kNumResults>());
+                if (trial_period::hasCardinalityDiverged(
+                        numReads, numResults, _decisionReads, _decisionResults)) {
+                    *cardinalityDiverged = true;
+                    return true;  // terminate the trial run
+                }
+                trackerPtr->setMaxMetric<TrialRunTracker::kNumReads>(
+                    std::min(2 * numReads, maxTrialPeriodNumReads));
+                return false;  // continue the trial run
+            }
             case TrialRunTracker::kNumResults:
                 candidate.root->detachFromTrialRunTracker();
                 return false;  // upgrade the trial run into a normal one
@@ -160,8 +209,12 @@ plan_ranker::CandidatePlan CachedSolutionPlanner::collectExecutionStatsForCached
                 MONGO_UNREACHABLE;
         }
     };
-    auto tracker = std::make_unique<TrialRunTracker>(
-        std::move(onMetricReached), maxNumResults, maxTrialPeriodNumReads);
+    const size_t maxNumReads = checkCardinality
+        ? std::min(std::max<size_t>(_decisionReads, 1), maxTrialPeriodNumReads)
+        : maxTrialPeriodNumReads;
+    auto tracker =
+        std::make_unique<TrialRunTracker>(std::move(onMetricReached), maxNumResults, maxNumReads);
+    trackerPtr = tracker.get();
     candidate.root->attachToTrialRunTracker(tracker.get());
     executeCandidateTrial(&candidate, maxNumResults, /*isCachedPlanTrial*/ true);
 
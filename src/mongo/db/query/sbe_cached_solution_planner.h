@@ -49,9 +49,11 @@ public:
                           const CanonicalQuery& cq,
                           const QueryPlannerParams& queryParams,
                           size_t decisionReads,
+                          size_t decisionResults,
                           PlanYieldPolicySBE* yieldPolicy)
         : BaseRuntimePlanner{opCtx, collections, cq, queryParams, yieldPolicy},
-          _decisionReads{decisionReads} {}
+          _decisionReads{decisionReads},
+          _decisionResults{decisionResults} {}
 
     CandidatePlans plan(
         std::vector<std::unique_ptr<QuerySolution>> solutions,
@@ -68,6 +70,10 @@ private:
      *
      * All documents returned by the plan are enqueued into the 'CandidatePlan->results' queue.
      *
+     * If adaptive replanning is enabled, the trial is also terminated early, and
+     * 'cardinalityDiverged' is set to true, as soon as the plan produces far fewer results than
+     * it did within '_decisionReads' when it was cached.
+     *
      * When the trial period ends, this function checks the stats to determine if the number of
      * reads during the trial meets the criteria for replanning, in which case it sets the
      * 'needsReplanning' flag of the resulting CandidatePlan to true.
@@ -80,7 +86,8 @@ private:
         std::unique_ptr<QuerySolution> solution,
         std::unique_ptr<PlanStage> root,
         stage_builder::PlanStageData data,
-        size_t maxTrialPeriodNumReads);
+        size_t maxTrialPeriodNumReads,
+        bool* cardinalityDiverged);
 
     /**
      * Uses the QueryPlanner and the MultiPlanner to re-generate candidate plans for this
@@ -98,5 +105,8 @@ private:
     // The number of physical reads taken to decide on a winning plan when the plan was first
     // cached.
     const size_t _decisionReads;
+
+    // The number of results the plan produced within '_decisionReads' when it was first cached.
+    const size_t _decisionResults;
 };
 }  // namespace mongo::sbe
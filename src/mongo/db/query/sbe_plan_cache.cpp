@@ -31,6 +31,7 @@
 #include "mongo/db/query/sbe_plan_cache.h"
 
 #include "mongo/db/query/plan_cache_size_parameter.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/server_options.h"
 #include "mongo/logv2/log.h"
 #include "mongo/util/processinfo.h"
@@ -44,6 +45,9 @@ namespace {
 const auto sbePlanCacheDecoration =
     ServiceContext::declareDecoration<std::unique_ptr<sbe::PlanCache>>();
 
+const auto sbePlanTemplateCacheDecoration =
+    ServiceContext::declareDecoration<std::unique_ptr<sbe::PlanTemplateCache>>();
+
 size_t convertToSizeInBytes(const plan_cache_util::PlanCacheSizeParameter& param) {
     constexpr size_t kBytesInMB = 1014 * 1024;
     constexpr size_t kMBytesInGB = 1014;
@@ -116,6 +120,7 @@ public:
         if (feature_flags::gFeatureFlagSbePlanCache.isEnabledAndIgnoreFCV()) {
             auto& globalPlanCache = sbePlanCacheDecoration(serviceCtx);
             globalPlanCache->clear();
+            sbePlanTemplateCacheDecoration(serviceCtx)->clear();
         }
     }
 };
@@ -131,7 +136,13 @@ ServiceContext::ConstructorActionRegisterer planCacheRegisterer{
 
             auto size = getPlanCacheSizeInBytes(status.getValue());
             auto& globalPlanCache = sbePlanCacheDecoration(serviceCtx);
-            globalPlanCache = std::make_unique<sbe::PlanCache>(size, ProcessInfo::getNumCores());
+            globalPlanCache = std::make_unique<sbe::PlanCache>(
+                size, ProcessInfo::getNumCores(), internalQueryCacheFrequencySketchWidth);
+
+            sbePlanTemplateCacheDecoration(serviceCtx) = std::make_unique<sbe::PlanTemplateCache>(
+                capPlanCacheSize(internalQueryPlanTemplateCacheSizeBytes),
+                ProcessInfo::getNumCores(),
+                internalQueryCacheFrequencySketchWidth);
         }
     }};
 
@@ -152,6 +163,23 @@ sbe::PlanCache& getPlanCache(OperationContext* opCtx) {
     return getPlanCache(opCtx->getServiceContext());
 }
 
+sbe::PlanTemplateCache& getPlanTemplateCache(ServiceContext* serviceCtx) {
+    uassert(7086764,
+            "Cannot getPlanTemplateCache() if gFeatureFlagSbePlanCache is disabled",
+            feature_flags::gFeatureFlagSbePlanCache.isEnabledAndIgnoreFCV());
+    return *sbePlanTemplateCacheDecoration(serviceCtx);
+}
+
+sbe::PlanTemplateCache& getPlanTemplateCache(OperationContext* opCtx) {
+    tassert(7086765, "Cannot get the global SBE plan template cache by a nullptr", opCtx);
+    return getPlanTemplateCache(opCtx->getServiceContext());
+}
+
+bool isPlanTemplateCacheEnabled() {
+    return feature_flags::gFeatureFlagSbePlanCache.isEnabledAndIgnoreFCV() &&
+        internalQueryEnablePlanTemplateCache.load();
+}
+
 void clearPlanCacheEntriesWith(ServiceContext* serviceCtx,
                                UUID collectionUuid,
                                size_t collectionVersion) {
@@ -164,6 +164,63 @@ struct PlanCachePartitioner {
     }
 };
 
+/**
+ * Represents the "key" used in the PlanTemplateCache, which maps a query shape to an SBE plan that
+ * may be executed against any collection with the same set of indexes. Unlike 'PlanCacheKey' it
+ * does not identify a collection. Instead, it carries a fingerprint of the index catalog so that a
+ * plan is only ever shared between collections whose indexes are identical in specification and
+ * multikey state.
+ */
+class PlanTemplateKey {
+public:
+    PlanTemplateKey(PlanCacheKeyInfo&& info, std::string indexCatalogFingerprint)
+        : _info{std::move(info)}, _indexCatalogFingerprint{std::move(indexCatalogFingerprint)} {}
+
+    bool operator==(const PlanTemplateKey& other) const {
+        return other._indexCatalogFingerprint == _indexCatalogFingerprint && other._info == _info;
+    }
+
+    bool operator!=(const PlanTemplateKey& other) const {
+        return !(*this == other);
+    }
+
+    uint32_t queryHash() const {
+        return _info.queryHash();
+    }
+
+    uint32_t planCacheKeyHash() const {
+        size_t hash = _info.planCacheKeyHash();
+        boost::hash_combine(hash, _indexCatalogFingerprint);
+        return hash;
+    }
+
+    const std::string& toString() const {
+        return _info.toString();
+    }
+
+private:
+    // Contains the actual encoding of the query shape as well as the index discriminators.
+    const PlanCacheKeyInfo _info;
+
+    // A binary encoding of the ready indexes visible to the reader, including their multikey
+    // state, and of the collection's clustering options. The cached plan embeds index bounds
+    // evaluation info which depends on all of these.
+    const std::string _indexCatalogFingerprint;
+};
+
+class PlanTemplateKeyHasher {
+public:
+    std::size_t operator()(const PlanTemplateKey& k) const {
+        return k.planCacheKeyHash();
+    }
+};
+
+struct PlanTemplatePartitioner {
+    std::size_t operator()(const PlanTemplateKey& k, const std::size_t nPartitions) const {
+        return PlanTemplateKeyHasher{}(k) % nPartitions;
+    }
+};
+
 /**
  * Represents the data cached in the SBE plan cache. This data holds an execution plan and necessary
  * auxiliary data for preparing and executing the PlanStage tree.
@@ -202,6 +259,18 @@ using PlanCache = PlanCacheBase<PlanCacheKey,
                                 PlanCachePartitioner,
                                 PlanCacheKeyHasher>;
 
+/**
+ * Shares compiled SBE plans between collections with identical indexes. Entries are looked up when
+ * the per-collection 'PlanCache' misses, and the plan is rebound to the queried collection using
+ * 'PlanStage::bindCollection()' before it is prepared.
+ */
+using PlanTemplateCache = PlanCacheBase<PlanTemplateKey,
+                                        CachedSbePlan,
+                                        BudgetEstimator,
+                                        plan_cache_debug_info::DebugInfoSBE,
+                                        PlanTemplatePartitioner,
+                                        PlanTemplateKeyHasher>;
+
 /**
  * A helper method to get the global SBE plan cache decorated in 'serviceCtx'.
  */
@@ -212,6 +281,21 @@ PlanCache& getPlanCache(ServiceContext* serviceCtx);
  */
 PlanCache& getPlanCache(OperationContext* opCtx);
 
+/**
+ * Returns the global SBE plan template cache decorated in 'serviceCtx'.
+ */
+PlanTemplateCache& getPlanTemplateCache(ServiceContext* serviceCtx);
+
+/**
+ * A wrapper for the helper above. 'opCtx' cannot be null.
+ */
+PlanTemplateCache& getPlanTemplateCache(OperationContext* opCtx);
+
+/**
+ * Returns true if plans may be stored in and recovered from the plan template cache.
+ */
+bool isPlanTemplateCacheEnabled();
+
 /**
  * Removes cached plan entries with the given collection UUID and collection version number.
  */
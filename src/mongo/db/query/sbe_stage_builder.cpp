@@ -38,6 +38,7 @@
 #include "mongo/db/exec/sbe/abt/abt_lower.h"
 #include "mongo/db/exec/sbe/stages/co_scan.h"
 #include "mongo/db/exec/sbe/stages/column_scan.h"
+#include "mongo/db/exec/sbe/stages/exchange.h"
 #include "mongo/db/exec/sbe/stages/filter.h"
 #include "mongo/db/exec/sbe/stages/hash_agg.h"
 #include "mongo/db/exec/sbe/stages/hash_join.h"
@@ -52,12 +53,15 @@
 #include "mongo/db/exec/sbe/stages/traverse.h"
 #include "mongo/db/exec/sbe/stages/union.h"
 #include "mongo/db/exec/sbe/stages/unique.h"
+#include "mongo/db/exec/sbe/values/bson.h"
 #include "mongo/db/exec/sbe/values/sort_spec.h"
 #include "mongo/db/exec/shard_filterer.h"
 #include "mongo/db/fts/fts_index_format.h"
 #include "mongo/db/fts/fts_query_impl.h"
 #include "mongo/db/fts/fts_spec.h"
 #include "mongo/db/index/fts_access_method.h"
+#include "mongo/db/matcher/expression_leaf.h"
+#include "mongo/db/matcher/expression_tree.h"
 #include "mongo/db/pipeline/abt/field_map_builder.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_visitor.h"
@@ -66,6 +70,7 @@
 #include "mongo/db/query/index_bounds_builder.h"
 #include "mongo/db/query/optimizer/rewrites/const_eval.h"
 #include "mongo/db/query/optimizer/rewrites/path_lower.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/sbe_stage_builder_accumulator.h"
 #include "mongo/db/query/sbe_stage_builder_coll_scan.h"
 #include "mongo/db/query/sbe_stage_builder_expression.h"
@@ -75,6 +80,7 @@
 #include "mongo/db/query/sbe_utils.h"
 #include "mongo/db/query/shard_filterer_factory_impl.h"
 #include "mongo/db/query/util/make_data_structure.h"
+#include "mongo/db/repl/read_concern_args.h"
 #include "mongo/db/s/collection_sharding_state.h"
 #include "mongo/db/storage/execution_context.h"
 #include "mongo/logv2/log.h"
@@ -530,11 +536,13 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> SlotBasedStageBuilder
     invariant(!reqs.getIndexKeyBitset());
 
     auto csn = static_cast<const CollectionScanNode*>(root);
-    auto [stage, outputs] = generateCollScan(_state,
-                                             getCurrentCollection(reqs),
-                                             csn,
-                                             _yieldPolicy,
-                                             reqs.getIsTailableCollScanResumeBranch());
+    auto [stage, outputs] = reqs.getIsParallelCollScan()
+        ? generateParallelCollScan(_state, getCurrentCollection(reqs), csn)
+        : generateCollScan(_state,
+                           getCurrentCollection(reqs),
+                           csn,
+                           _yieldPolicy,
+                           reqs.getIsTailableCollScanResumeBranch());
 
     if (reqs.has(kReturnKey)) {
         // Assign the 'returnKeySlot' to be the empty object.
@@ -715,7 +723,57 @@ std::unique_ptr<sbe::EExpression> abtToExpr(optimizer::ABT& abt, optimizer::Slot
     optimizer::SBEExpressionLowering exprLower{env, slotMap};
     return exprLower.optimize(abt);
 }
+
+/**
+ * Appends to 'pathFilters' the comparisons in the per-path 'filter' which the column scan can
+ * evaluate directly on the cells of the path with index 'pathIdx'. The children of a conjunction,
+ * such as the two bounds of a range, are appended as separate path filters, because the column
+ * scan only returns the records which pass all of them.
+ */
+void appendColumnScanPathFilters(StageBuilderState& state,
+                                 size_t pathIdx,
+                                 const MatchExpression* filter,
+                                 std::vector<sbe::ColumnScanStage::PathFilter>* pathFilters) {
+    using Op = sbe::ColumnScanStage::PathFilter::Op;
+
+    boost::optional<Op> op;
+    switch (filter->matchType()) {
+        case MatchExpression::AND:
+            for (size_t i = 0; i < filter->numChildren(); ++i) {
+                appendColumnScanPathFilters(state, pathIdx, filter->getChild(i), pathFilters);
+            }
+            return;
+        case MatchExpression::EQ:
+            op = Op::kEq;
+            break;
+        case MatchExpression::LT:
+            op = Op::kLt;
+            break;
+        case MatchExpression::LTE:
+            op = Op::kLte;
+            break;
+        case MatchExpression::GT:
+            op = Op::kGt;
+            break;
+        case MatchExpression::GTE:
+            op = Op::kGte;
+            break;
+        default:
+            return;
+    }
+
+    auto cmp = static_cast<const ComparisonMatchExpressionBase*>(filter);
+    std::unique_ptr<sbe::EExpression> value;
+    if (auto inputParam = cmp->getInputParamId()) {
+        value = makeVariable(state.registerInputParamSlot(*inputParam));
+    } else {
+        auto [tag, val] = sbe::bson::convertFrom<false>(cmp->getData());
+        value = sbe::makeE<sbe::EConstant>(tag, val);
+    }
+    pathFilters->emplace_back(pathIdx, *op, std::move(value));
+}
 }  // namespace
+
 std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> SlotBasedStageBuilder::buildColumnScan(
     const QuerySolutionNode* root, const PlanStageReqs& reqs) {
     tassert(6312404,
@@ -728,8 +786,6 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> SlotBasedStageBuilder
             "'postAssemblyFilter' to be used instead.",
             !csn->filter);
 
-    tassert(6610251, "Expected no filters by path", csn->filtersByPath.empty());
-
     PlanStageSlots outputs;
 
     auto recordSlot = _slotIdGenerator.generate();
@@ -766,21 +822,50 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> SlotBasedStageBuilder
     slotMap[rootStr] = rowStoreSlot;
     auto abt = builder.generateABT();
     auto exprOut = abt ? abtToExpr(*abt, slotMap) : emptyExpr->clone();
+
+    // Push the simple comparisons among the per-path filters down into the column scan, so that it
+    // can skip the records which cannot match before assembling them. These filters are evaluated
+    // on the raw cell values without a collator, so they are only pushed down when the query has
+    // none. The pushed filters are only a necessary condition for a match, so all of the per-path
+    // filters are still applied together with the post assembly filter.
+    std::vector<sbe::ColumnScanStage::PathFilter> pathFilters;
+    const MatchExpression* postAssemblyFilter = csn->postAssemblyFilter.get();
+    std::unique_ptr<AndMatchExpression> combinedFilter;
+    if (!csn->filtersByPath.empty()) {
+        combinedFilter = std::make_unique<AndMatchExpression>();
+        if (csn->postAssemblyFilter) {
+            combinedFilter->add(csn->postAssemblyFilter->shallowClone());
+        }
+        postAssemblyFilter = combinedFilter.get();
+    }
+    const std::vector<std::string> paths{csn->allFields.begin(), csn->allFields.end()};
+    for (auto&& [path, filter] : csn->filtersByPath) {
+        combinedFilter->add(filter->shallowClone());
+
+        auto pathIt = std::find(paths.begin(), paths.end(), path);
+        if (_cq.getCollator() || pathIt == paths.end()) {
+            continue;
+        }
+
+        appendColumnScanPathFilters(_state, pathIt - paths.begin(), filter.get(), &pathFilters);
+    }
+
     std::unique_ptr<sbe::PlanStage> stage = std::make_unique<sbe::ColumnScanStage>(
         getCurrentCollection(reqs)->uuid(),
         csn->indexEntry.catalogName,
         fieldSlotIds,
-        std::vector<std::string>{csn->allFields.begin(), csn->allFields.end()},
+        paths,
         recordSlot,
         ridSlot,
         std::move(exprOut),
         std::move(pathExprs),
         rowStoreSlot,
         _yieldPolicy,
-        csn->nodeId());
+        csn->nodeId(),
+        std::move(pathFilters));
 
     // Generate post assembly filter.
-    if (csn->postAssemblyFilter) {
+    if (postAssemblyFilter) {
         auto relevantSlots = sbe::makeSV(recordSlot);
         if (ridSlot) {
             relevantSlots.push_back(*ridSlot);
@@ -788,7 +873,7 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> SlotBasedStageBuilder
         relevantSlots.insert(relevantSlots.end(), fieldSlotIds.begin(), fieldSlotIds.end());
 
         auto [_, outputStage] = generateFilter(_state,
-                                               csn->postAssemblyFilter.get(),
+                                               postAssemblyFilter,
                                                {std::move(stage), std::move(relevantSlots)},
                                                recordSlot,
                                                csn->nodeId());
@@ -816,7 +901,6 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> SlotBasedStageBuilder
 
     auto [stage, outputs] = build(fn->children[0].get(), childReqs);
 
-    auto iamMap = _data.iamMap;
     uassert(4822880, "RecordId slot is not defined", outputs.has(kRecordId));
     uassert(
         4953600, "ReturnKey slot is not defined", !reqs.has(kReturnKey) || outputs.has(kReturnKey));
@@ -844,7 +928,6 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> SlotBasedStageBuilder
                              outputs.get(kIndexKey),
                              outputs.get(kIndexKeyPattern),
                              getCurrentCollection(reqs),
-                             std::move(iamMap),
                              root->nodeId(),
                              std::move(relevantSlots),
                              _slotIdGenerator);
@@ -1089,12 +1172,15 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> SlotBasedStageBuilder
     auto child = sn->children[0].get();
 
     const auto isCoveredQuery = reqs.getIndexKeyBitset().has_value();
+    auto indexScan = static_cast<const IndexScanNode*>(getLoneNodeByType(child, STAGE_IXSCAN));
+    tassert(5601701,
+            "Expected index scan below sort for covered query",
+            indexScan || !isCoveredQuery);
+
     BSONObj indexKeyPattern;
     sbe::IndexKeysInclusionSet sortPatternKeyBitSet;
-    if (isCoveredQuery) {
-        // If query is covered, we need to request index key for each part of the sort pattern.
-        auto indexScan = static_cast<const IndexScanNode*>(getLoneNodeByType(child, STAGE_IXSCAN));
-        tassert(5601701, "Expected index scan below sort for covered query", indexScan);
+    bool sortPatternInIndexKeys = false;
+    if (indexScan && !child->fetched()) {
         indexKeyPattern = indexScan->index.keyPattern;
 
         StringDataSet sortPaths;
@@ -1105,9 +1191,23 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> SlotBasedStageBuilder
         std::vector<std::string> foundPaths;
         std::tie(sortPatternKeyBitSet, foundPaths) =
             makeIndexKeyInclusionSet(indexKeyPattern, sortPaths);
+        sortPatternInIndexKeys = foundPaths.size() == sortPaths.size();
+    }
+
+    // If the parent does not need the document itself, e.g. because it is a FetchNode, and the
+    // index scan below provides every field of the sort pattern, then sort on the index key slots
+    // directly. The parent then materializes only the documents that survive the sort's limit,
+    // and no object is inflated from the index key of each scanned entry.
+    const bool sortOnIndexKeys =
+        isCoveredQuery || (!reqs.has(kResult) && sortPatternInIndexKeys);
+    if (sortOnIndexKeys) {
+        // Request the index key for each part of the sort pattern.
+        if (!childReqs.getIndexKeyBitset()) {
+            childReqs.getIndexKeyBitset() = sbe::IndexKeysInclusionSet{};
+        }
         *childReqs.getIndexKeyBitset() |= sortPatternKeyBitSet;
     } else {
-        // If query is not covered, child is required to produce whole document for sorting.
+        // Otherwise the child is required to produce whole document for sorting.
         childReqs.set(kResult);
     }
 
@@ -1142,9 +1242,9 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> SlotBasedStageBuilder
     auto forwardedSlots = sbe::makeSV();
 
     // We do not support covered queries on array fields for multikey indexes. This means that if
-    // the query is covered, index keys cannot contain arrays. Since traversal logic and
-    // 'generateSortKey' call below is needed only for arrays, we can omit it for covered queries.
-    if (isCoveredQuery) {
+    // the sort is on index keys, they cannot contain arrays. Since traversal logic and
+    // 'generateSortKey' call below is needed only for arrays, we can omit it in this case.
+    if (sortOnIndexKeys) {
         auto indexKeySlots = *outputs.extractIndexKeySlots();
 
         // Currently, 'indexKeySlots' contains slots for two kinds of index keys:
@@ -1152,23 +1252,25 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> SlotBasedStageBuilder
         //  2. Keys requested by parent
         // We need to filter first category of slots into 'orderBy' vector, since sort stage will
         // use them for sorting. Second category of slots goes into 'outputs' to be used by parent.
-        auto& parentIndexKeyBitset = *reqs.getIndexKeyBitset();
+        // If the query is not covered, the parent does not request any index keys.
         auto& childIndexKeyBitset = *childReqs.getIndexKeyBitset();
-
         orderBy = makeIndexKeyOutputSlotsMatchingParentReqs(
             indexKeyPattern, sortPatternKeyBitSet, childIndexKeyBitset, indexKeySlots);
 
-        auto indexKeySlotsForParent = makeIndexKeyOutputSlotsMatchingParentReqs(
-            indexKeyPattern, parentIndexKeyBitset, childIndexKeyBitset, indexKeySlots);
-        outputs.setIndexKeySlots(std::move(indexKeySlotsForParent));
-
-        // In forwarded slots we need to include all slots requested by parent excluding slots from
-        // 'orderBy' vector.
-        auto forwardedIndexKeyBitset = parentIndexKeyBitset & (~sortPatternKeyBitSet);
-        forwardedSlots = makeIndexKeyOutputSlotsMatchingParentReqs(indexKeyPattern,
-                                                                   forwardedIndexKeyBitset,
-                                                                   childIndexKeyBitset,
-                                                                   std::move(indexKeySlots));
+        if (isCoveredQuery) {
+            auto& parentIndexKeyBitset = *reqs.getIndexKeyBitset();
+            auto indexKeySlotsForParent = makeIndexKeyOutputSlotsMatchingParentReqs(
+                indexKeyPattern, parentIndexKeyBitset, childIndexKeyBitset, indexKeySlots);
+            outputs.setIndexKeySlots(std::move(indexKeySlotsForParent));
+
+            // In forwarded slots we need to include all slots requested by parent excluding slots
+            // from 'orderBy' vector.
+            auto forwardedIndexKeyBitset = parentIndexKeyBitset & (~sortPatternKeyBitSet);
+            forwardedSlots = makeIndexKeyOutputSlotsMatchingParentReqs(indexKeyPattern,
+                                                                       forwardedIndexKeyBitset,
+                                                                       childIndexKeyBitset,
+                                                                       std::move(indexKeySlots));
+        }
     } else if (!hasPartsWithCommonPrefix) {
         sbe::value::SlotMap<std::unique_ptr<sbe::EExpression>> projectMap;
 
@@ -2332,6 +2434,65 @@ sbe::value::SlotVector dedupGroupBySlots(const sbe::value::SlotVector& groupBySl
 
     return dedupedGroupBySlots;
 }
+
+/**
+ * Returns the number of workers which should compute the partial aggregates of the given group in
+ * parallel, or 1 if the group must be computed serially. A group can be parallelized only when its
+ * input is a plain forward collection scan, possibly under projections, which can be split into
+ * RecordId ranges, and when all of its accumulators can be computed from partial aggregates.
+ */
+size_t getGroupDegreeOfParallelism(OperationContext* opCtx,
+                                   const CanonicalQuery& cq,
+                                   const CollectionPtr& collection,
+                                   const GroupNode* groupNode) {
+    auto dop = internalQuerySBEMaxDegreeOfParallelism.load();
+    if (auto queryDop = cq.getExpCtx()->maxDegreeOfParallelism; queryDop) {
+        dop = std::min(dop, *queryDop);
+    }
+    if (dop <= 1 || !collection) {
+        return 1;
+    }
+
+    // Every worker reads from its own storage snapshot, which is only acceptable when the query
+    // does not need to read at a particular point in time.
+    if (opCtx->inMultiDocumentTransaction()) {
+        return 1;
+    }
+    const auto& readConcernArgs = repl::ReadConcernArgs::get(opCtx);
+    if ((readConcernArgs.getLevel() != repl::ReadConcernLevel::kLocalReadConcern &&
+         readConcernArgs.getLevel() != repl::ReadConcernLevel::kAvailableReadConcern) ||
+        readConcernArgs.getArgsAfterClusterTime() || readConcernArgs.getArgsAtClusterTime()) {
+        return 1;
+    }
+
+    if (!std::all_of(groupNode->accumulators.begin(),
+                     groupNode->accumulators.end(),
+                     [](auto&& accStmt) { return canCombinePartialAggregates(accStmt); })) {
+        return 1;
+    }
+
+    const QuerySolutionNode* node = groupNode->children[0].get();
+    while (node->getType() == STAGE_PROJECTION_SIMPLE ||
+           node->getType() == STAGE_PROJECTION_DEFAULT) {
+        node = node->children[0].get();
+    }
+    if (node->getType() != STAGE_COLLSCAN) {
+        return 1;
+    }
+    auto csn = static_cast<const CollectionScanNode*>(node);
+    if (csn->direction != CollectionScanParams::FORWARD || csn->minRecord || csn->maxRecord ||
+        csn->resumeAfterRecordId || csn->tailable || csn->requestResumeToken ||
+        csn->shouldTrackLatestOplogTimestamp || csn->assertTsHasNotFallenOff ||
+        collection->ns().isOplog()) {
+        return 1;
+    }
+
+    if (collection->numRecords(opCtx) < internalQuerySBEParallelScanMinRecords.load()) {
+        return 1;
+    }
+
+    return dop;
+}
 }  // namespace
 
 /**
@@ -2383,6 +2544,9 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> SlotBasedStageBuilder
         childReqs.clear(kResult);
     }
 
+    auto dop = getGroupDegreeOfParallelism(_opCtx, _cq, getCurrentCollection(reqs), groupNode);
+    childReqs.setIsParallelCollScan(dop > 1);
+
     // Builds the child and gets the child result slot.
     auto [childStage, childOutputs] = build(childNode, childReqs);
     _shouldProduceRecordIdSlot = false;
@@ -2440,6 +2604,43 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> SlotBasedStageBuilder
                        dedupedGroupBySlots.end(),
                        groupEvalStage.outSlots.begin()));
 
+    if (dop > 1) {
+        // The group stage built above computes partial aggregates over the part of the collection
+        // scanned by a single worker. The exchange runs a clone of it on each of the 'dop' workers
+        // and gathers their output into a final group stage which combines the partial aggregates
+        // of each group.
+        auto exchangeSlots = groupEvalStage.outSlots;
+        auto exchangeStage = sbe::makeS<sbe::ExchangeConsumer>(std::move(groupEvalStage.stage),
+                                                               dop,
+                                                               exchangeSlots,
+                                                               sbe::ExchangePolicy::roundrobin,
+                                                               nullptr /* partition */,
+                                                               nullptr /* orderLess */,
+                                                               nodeId);
+
+        sbe::value::SlotMap<std::unique_ptr<sbe::EExpression>> combineSlotToExprMap;
+        for (size_t idxAcc = 0; idxAcc < accStmts.size(); ++idxAcc) {
+            auto combineExprs =
+                buildCombinePartialAggregates(_state, accStmts[idxAcc], aggSlotsVec[idxAcc]);
+
+            sbe::value::SlotVector combineSlots;
+            for (auto& combineExpr : combineExprs) {
+                auto slot = _slotIdGenerator.generate();
+                combineSlots.push_back(slot);
+                combineSlotToExprMap.emplace(slot, std::move(combineExpr));
+            }
+            aggSlotsVec[idxAcc] = std::move(combineSlots);
+        }
+
+        groupEvalStage =
+            makeHashAgg(EvalStage{std::move(exchangeStage), std::move(exchangeSlots)},
+                        dedupedGroupBySlots,
+                        std::move(combineSlotToExprMap),
+                        _state.data->env->getSlotIfExists("collator"_sd),
+                        _cq.getExpCtx()->allowDiskUse,
+                        nodeId);
+    }
+
     // Builds the final stage(s) over the collected accumulators.
     auto [fieldNames, finalSlots, groupFinalEvalStage] =
         generateGroupFinalStage(_state,
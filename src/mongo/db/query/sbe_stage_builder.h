@@ -234,6 +234,14 @@ public:
         _isTailableCollScanResumeBranch = b;
     }
 
+    bool getIsParallelCollScan() const {
+        return _isParallelCollScan;
+    }
+
+    void setIsParallelCollScan(bool b) {
+        _isParallelCollScan = b;
+    }
+
     void setTargetNamespace(const NamespaceString& nss) {
         _targetNamespace = nss;
     }
@@ -264,6 +272,10 @@ private:
     // branch. At all other times, this flag will be false.
     bool _isTailableCollScanResumeBranch{false};
 
+    // When we're building the per-worker sub-tree of a parallel plan, this flag will be set to true
+    // so that the collection scan at its leaf is split into RecordId ranges shared by all workers.
+    bool _isParallelCollScan{false};
+
     // Tracks the current namespace that we're building a plan over. Given that the stage builder
     // can build plans for multiple namespaces, a node in the tree that targets a namespace
     // different from its parent node can set this value to notify any child nodes of the correct
@@ -464,6 +464,80 @@ std::pair<std::vector<std::unique_ptr<sbe::EExpression>>, EvalStage> buildAccumu
     aggs.push_back(makeFunction("mergeObjects", std::move(arg)));
     return {std::move(aggs), std::move(inputStage)};
 }
+
+std::vector<std::unique_ptr<sbe::EExpression>> buildCombinePartialAggsMin(
+    StageBuilderState& state,
+    const AccumulationExpression& expr,
+    const sbe::value::SlotVector& inputSlots) {
+    tassert(7086741,
+            str::stream() << "Expected one input slot for merging $min, got: " << inputSlots.size(),
+            inputSlots.size() == 1);
+
+    std::vector<std::unique_ptr<sbe::EExpression>> aggs;
+    auto collatorSlot = state.data->env->getSlotIfExists("collator"_sd);
+    if (collatorSlot) {
+        aggs.push_back(makeFunction("collMin"_sd,
+                                    sbe::makeE<sbe::EVariable>(*collatorSlot),
+                                    makeVariable(inputSlots[0])));
+    } else {
+        aggs.push_back(makeFunction("min"_sd, makeVariable(inputSlots[0])));
+    }
+    return aggs;
+}
+
+std::vector<std::unique_ptr<sbe::EExpression>> buildCombinePartialAggsMax(
+    StageBuilderState& state,
+    const AccumulationExpression& expr,
+    const sbe::value::SlotVector& inputSlots) {
+    tassert(7086742,
+            str::stream() << "Expected one input slot for merging $max, got: " << inputSlots.size(),
+            inputSlots.size() == 1);
+
+    std::vector<std::unique_ptr<sbe::EExpression>> aggs;
+    auto collatorSlot = state.data->env->getSlotIfExists("collator"_sd);
+    if (collatorSlot) {
+        aggs.push_back(makeFunction("collMax"_sd,
+                                    sbe::makeE<sbe::EVariable>(*collatorSlot),
+                                    makeVariable(inputSlots[0])));
+    } else {
+        aggs.push_back(makeFunction("max"_sd, makeVariable(inputSlots[0])));
+    }
+    return aggs;
+}
+
+std::vector<std::unique_ptr<sbe::EExpression>> buildCombinePartialAggsAvg(
+    StageBuilderState& state,
+    const AccumulationExpression& expr,
+    const sbe::value::SlotVector& inputSlots) {
+    // Slot 0 contains the partial sum, and slot 1 contains the partial count of summed items.
+    tassert(7086743,
+            str::stream() << "Expected two input slots for merging $avg, got: "
+                          << inputSlots.size(),
+            inputSlots.size() == 2);
+
+    std::vector<std::unique_ptr<sbe::EExpression>> aggs;
+    aggs.push_back(makeFunction("aggMergeDoubleDoubleSums", makeVariable(inputSlots[0])));
+    aggs.push_back(makeFunction("sum", makeVariable(inputSlots[1])));
+    return aggs;
+}
+
+std::vector<std::unique_ptr<sbe::EExpression>> buildCombinePartialAggsSum(
+    StageBuilderState& state,
+    const AccumulationExpression& expr,
+    const sbe::value::SlotVector& inputSlots) {
+    tassert(7086744,
+            str::stream() << "Expected one input slot for merging $sum, got: " << inputSlots.size(),
+            inputSlots.size() == 1);
+
+    std::vector<std::unique_ptr<sbe::EExpression>> aggs;
+    // A count-like accumulator like {$sum: 1} produces a scalar partial count for each group.
+    if (auto [isCount, addendTag, addendVal] = getCountAddend(expr); isCount) {
+        aggs.push_back(makeFunction("sum", makeVariable(inputSlots[0])));
+    } else {
+        aggs.push_back(makeFunction("aggMergeDoubleDoubleSums", makeVariable(inputSlots[0])));
+    }
+    return aggs;
+}
 };  // namespace
 
 std::pair<std::unique_ptr<sbe::EExpression>, EvalStage> buildArgument(
@@ -557,4 +631,35 @@ std::pair<std::unique_ptr<sbe::EExpression>, EvalStage> buildFinalize(
         return {nullptr, std::move(inputStage)};
     }
 }
+
+namespace {
+using BuildCombinePartialAggsFn = std::function<std::vector<std::unique_ptr<sbe::EExpression>>(
+    StageBuilderState&, const AccumulationExpression&, const sbe::value::SlotVector&)>;
+
+// Accumulators which are missing from this map cannot be computed by combining partial aggregates.
+const StringDataMap<BuildCombinePartialAggsFn> kCombinePartialAggsBuilders = {
+    {AccumulatorMin::kName, &buildCombinePartialAggsMin},
+    {AccumulatorMax::kName, &buildCombinePartialAggsMax},
+    {AccumulatorAvg::kName, &buildCombinePartialAggsAvg},
+    {AccumulatorSum::kName, &buildCombinePartialAggsSum},
+};
+}  // namespace
+
+bool canCombinePartialAggregates(const AccumulationStatement& acc) {
+    return kCombinePartialAggsBuilders.find(acc.expr.name) != kCombinePartialAggsBuilders.end();
+}
+
+std::vector<std::unique_ptr<sbe::EExpression>> buildCombinePartialAggregates(
+    StageBuilderState& state,
+    const AccumulationStatement& acc,
+    const sbe::value::SlotVector& inputSlots) {
+    auto accExprName = acc.expr.name;
+    auto it = kCombinePartialAggsBuilders.find(accExprName);
+    uassert(7086745,
+            str::stream() << "Unsupported Accumulator for combining partial aggregates in SBE: "
+                          << accExprName,
+            it != kCombinePartialAggsBuilders.end());
+
+    return std::invoke(it->second, state, acc.expr, inputSlots);
+}
 }  // namespace mongo::stage_builder
@@ -71,4 +71,21 @@ std::pair<std::unique_ptr<sbe::EExpression>, EvalStage> buildFinalize(
     const sbe::value::SlotVector& aggSlots,
     EvalStage stage,
     PlanNodeId planNodeId);
+
+/**
+ * Returns true if the results of an AccumulationStatement can be computed by combining partial
+ * aggregates, each of which was produced by 'buildAccumulator()' over a disjoint subset of a group.
+ */
+bool canCombinePartialAggregates(const AccumulationStatement& acc);
+
+/**
+ * Translates an input AccumulationStatement into SBE EExpressions that combine the partial
+ * aggregates held in 'inputSlots' into the aggregates which 'buildAccumulator()' would have
+ * produced over the whole group. The returned expressions are in the same order as the ones
+ * returned by 'buildAccumulator()', so the result can be fed to 'buildFinalize()'.
+ */
+std::vector<std::unique_ptr<sbe::EExpression>> buildCombinePartialAggregates(
+    StageBuilderState& state,
+    const AccumulationStatement& acc,
+    const sbe::value::SlotVector& inputSlots);
 }  // namespace mongo::stage_builder
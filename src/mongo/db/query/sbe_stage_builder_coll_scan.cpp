@@ -632,4 +632,50 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> generateCollScan(
         return generateGenericCollScan(state, collection, csn, yieldPolicy, isTailableResumeBranch);
     }
 }
+
+std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> generateParallelCollScan(
+    StageBuilderState& state, const CollectionPtr& collection, const CollectionScanNode* csn) {
+    tassert(7086740,
+            "Parallel collection scan must be a plain forward scan",
+            csn->direction == CollectionScanParams::FORWARD && !csn->minRecord &&
+                !csn->maxRecord && !csn->resumeAfterRecordId && !csn->tailable &&
+                !csn->requestResumeToken && !csn->shouldTrackLatestOplogTimestamp &&
+                !csn->assertTsHasNotFallenOff);
+
+    auto resultSlot = state.slotId();
+    auto recordIdSlot = state.slotId();
+
+    // The scan is cloned and run by the exchange producers on their own threads and operation
+    // contexts, so it must not use the yield policy of the plan executor.
+    std::unique_ptr<sbe::PlanStage> stage =
+        sbe::makeS<sbe::ParallelScanStage>(collection->uuid(),
+                                           resultSlot,
+                                           recordIdSlot,
+                                           boost::none /* snapshotIdSlot */,
+                                           boost::none /* indexIdSlot */,
+                                           boost::none /* indexKeySlot */,
+                                           boost::none /* keyPatternSlot */,
+                                           std::vector<std::string>{},
+                                           sbe::makeSV(),
+                                           nullptr /* yieldPolicy */,
+                                           csn->nodeId(),
+                                           sbe::ScanCallbacks{});
+
+    if (csn->filter) {
+        auto relevantSlots = sbe::makeSV(resultSlot, recordIdSlot);
+
+        auto [_, outputStage] = generateFilter(state,
+                                               csn->filter.get(),
+                                               {std::move(stage), std::move(relevantSlots)},
+                                               resultSlot,
+                                               csn->nodeId());
+        stage = std::move(outputStage.stage);
+    }
+
+    PlanStageSlots outputs;
+    outputs.set(PlanStageSlots::kResult, resultSlot);
+    outputs.set(PlanStageSlots::kRecordId, recordIdSlot);
+
+    return {std::move(stage), std::move(outputs)};
+}
 }  // namespace mongo::stage_builder
@@ -59,4 +59,15 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> generateCollScan(
     PlanYieldPolicy* yieldPolicy,
     bool isTailableResumeBranch);
 
+/**
+ * Generates an SBE plan stage sub-tree implementing a collection scan which is split into RecordId
+ * ranges, so that each clone of the sub-tree made for a parallel worker scans a disjoint part of
+ * the collection. The scan does not yield and does not support any of the resume, tailable or
+ * bounded collection scan options.
+ *
+ * Returns the same output slots as 'generateCollScan()'.
+ */
+std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> generateParallelCollScan(
+    StageBuilderState& state, const CollectionPtr& collection, const CollectionScanNode* csn);
+
 }  // namespace mongo::stage_builder
@@ -35,6 +35,7 @@
 #include <iterator>
 #include <numeric>
 
+#include "mongo/db/catalog/index_catalog.h"
 #include "mongo/db/exec/sbe/expressions/expression.h"
 #include "mongo/db/exec/sbe/stages/branch.h"
 #include "mongo/db/exec/sbe/stages/co_scan.h"
@@ -868,9 +869,12 @@ void indexKeyCorruptionCheckCallback(OperationContext* opCtx,
  * Callback function that returns true if a given index key is valid, false otherwise. An index key
  * is valid if either the snapshot id of the underlying index scan matches the current snapshot id,
  * or that the index keys are still part of the underlying index.
+ *
+ * The index access method is resolved by name from the collection being fetched from rather than
+ * captured at stage building time, so the plan holds no pointers into a particular collection's
+ * index catalog and may be bound to a different collection with the same indexes.
  */
 bool indexKeyConsistencyCheckCallback(OperationContext* opCtx,
-                                      StringMap<const IndexAccessMethod*> iamTable,
                                       sbe::value::SlotAccessor* snapshotIdAccessor,
                                       sbe::value::SlotAccessor* indexIdAccessor,
                                       sbe::value::SlotAccessor* indexKeyAccessor,
@@ -906,12 +910,13 @@ bool indexKeyConsistencyCheckCallback(OperationContext* opCtx,
             auto indexId = sbe::value::getStringView(indexIdTag, indexIdVal);
             tassert(5290712, "KeyString does not exist", keyString);
 
-            auto it = iamTable.find(indexId);
+            auto indexCatalog = collection->getIndexCatalog();
+            auto desc = indexCatalog->findIndexByName(opCtx, indexId);
             tassert(5290713,
                     str::stream() << "IndexAccessMethod not found for index " << indexId,
-                    it != iamTable.end());
+                    desc);
 
-            auto iam = it->second->asSortedData();
+            auto iam = indexCatalog->getEntry(desc)->accessMethod()->asSortedData();
             tassert(5290709,
                     str::stream() << "Expected to find SortedDataIndexAccessMethod for index "
                                   << indexId,
@@ -952,7 +957,6 @@ makeLoopJoinForFetch(std::unique_ptr<sbe::PlanStage> inputStage,
                      sbe::value::SlotId indexKeySlot,
                      sbe::value::SlotId indexKeyPatternSlot,
                      const CollectionPtr& collToFetch,
-                     StringMap<const IndexAccessMethod*> iamMap,
                      PlanNodeId planNodeId,
                      sbe::value::SlotVector slotsToForward,
                      sbe::value::SlotIdGenerator& slotIdGenerator) {
@@ -967,7 +971,7 @@ makeLoopJoinForFetch(std::unique_ptr<sbe::PlanStage> inputStage,
     using namespace std::placeholders;
     sbe::ScanCallbacks callbacks(
         indexKeyCorruptionCheckCallback,
-        std::bind(indexKeyConsistencyCheckCallback, _1, std::move(iamMap), _2, _3, _4, _5, _6));
+        std::bind(indexKeyConsistencyCheckCallback, _1, _2, _3, _4, _5, _6));
 
     // Scan the collection in the range [seekKeySlot, Inf).
     auto scanStage = sbe::makeS<sbe::ScanStage>(collToFetch->uuid(),
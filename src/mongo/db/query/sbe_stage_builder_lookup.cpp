@@ -843,7 +843,6 @@ std::pair<SlotId, std::unique_ptr<sbe::PlanStage>> buildIndexJoinLookupStage(
                                                                       indexKeySlot,
                                                                       indexKeyPatternSlot,
                                                                       foreignColl,
-                                                                      iamMap,
                                                                       nodeId,
                                                                       makeSV() /* slotsToForward */,
                                                                       slotIdGenerator);
@@ -84,7 +84,7 @@ Status CollectionBulkLoaderImpl::init(const std::vector<BSONObj>& secondaryIndex
         // locks as yielding a MODE_X/MODE_S lock isn't allowed.
         _secondaryIndexesBlock->setIndexBuildMethod(IndexBuildMethod::kForeground);
         _idIndexBlock->setIndexBuildMethod(IndexBuildMethod::kForeground);
-        return writeConflictRetry(
+        auto status = writeConflictRetry(
             _opCtx.get(),
             "CollectionBulkLoader::init",
             _collection->getNss().ns(),
@@ -128,6 +128,17 @@ Status CollectionBulkLoaderImpl::init(const std::vector<BSONObj>& secondaryIndex
                 wuow.commit();
                 return Status::OK();
             });
+        if (!status.isOK()) {
+            return status;
+        }
+
+        // Capped collections maintain their indexes on every insert, so only collections whose
+        // indexes are built by the index blocks can be bulk loaded.
+        if (collectionBulkLoaderUseStorageBulkLoad && (_idIndexBlock || _secondaryIndexesBlock)) {
+            _recordStoreBulkLoader =
+                (*_collection)->getRecordStore()->makeBulkLoader(_opCtx.get());
+        }
+        return Status::OK();
     });
 }
 
@@ -140,9 +151,13 @@ Status CollectionBulkLoaderImpl::_insertDocumentsForUncappedCollection(
         Status status = writeConflictRetry(
             _opCtx.get(), "CollectionBulkLoaderImpl/insertDocumentsUncapped", _nss.ns(), [&] {
                 WriteUnitOfWork wunit(_opCtx.get());
-                auto insertIter = iter;
+                // Documents appended through the RecordStore bulk loader are not rolled back with
+                // the WriteUnitOfWork, so a retry resumes after the last of them.
+                if (!_recordStoreBulkLoader) {
+                    locs.clear();
+                }
+                auto insertIter = iter + locs.size();
                 int bytesInBlock = 0;
-                locs.clear();
 
                 auto onRecordInserted = [&](const RecordId& location) {
                     locs.emplace_back(location);
@@ -155,7 +170,10 @@ Status CollectionBulkLoaderImpl::_insertDocumentsForUncappedCollection(
                     // This version of insert will not update any indexes.
                     const auto status =
                         (*_collection)
-                            ->insertDocumentForBulkLoader(_opCtx.get(), doc, onRecordInserted);
+                            ->insertDocumentForBulkLoader(_opCtx.get(),
+                                                          doc,
+                                                          onRecordInserted,
+                                                          _recordStoreBulkLoader.get());
                     if (!status.isOK()) {
                         return status;
                     }
@@ -238,6 +256,9 @@ Status CollectionBulkLoaderImpl::commit() {
                     "namespace"_attr = _nss.ns());
         UnreplicatedWritesBlock uwb(_opCtx.get());
 
+        // Finish the bulk load so that the documents can be read and deleted as duplicates below.
+        _recordStoreBulkLoader.reset();
+
         // Commit before deleting dups, so the dups will be removed from secondary indexes when
         // deleted.
         if (_secondaryIndexesBlock) {
@@ -339,6 +360,8 @@ Status CollectionBulkLoaderImpl::commit() {
 
 void CollectionBulkLoaderImpl::_releaseResources() {
     invariant(&cc() == _opCtx->getClient());
+    _recordStoreBulkLoader.reset();
+
     if (_secondaryIndexesBlock) {
         CollectionWriter collWriter(_opCtx.get(), *_collection);
         _secondaryIndexesBlock->abortIndexBuild(
@@ -38,6 +38,7 @@
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/repl/collection_bulk_loader.h"
 #include "mongo/db/repl/storage_interface.h"
+#include "mongo/db/storage/record_store.h"
 
 namespace mongo {
 namespace repl {
@@ -108,6 +109,9 @@ private:
     NamespaceString _nss;
     std::unique_ptr<MultiIndexBlock> _idIndexBlock;
     std::unique_ptr<MultiIndexBlock> _secondaryIndexesBlock;
+    // Appends documents to the RecordStore outside of storage transactions, if it supports that.
+    // Must be destroyed before anything else reads or writes the RecordStore.
+    std::unique_ptr<RecordStore::BulkLoader> _recordStoreBulkLoader;
     BSONObj _idIndexSpec;
     Stats _stats;
 };
@@ -31,20 +31,25 @@
 #include "mongo/platform/basic.h"
 
 #include "mongo/base/string_data.h"
+#include "mongo/bson/simple_bsonobj_comparator.h"
 #include "mongo/db/catalog/clustered_collection_options_gen.h"
 #include "mongo/db/catalog/clustered_collection_util.h"
 #include "mongo/db/commands/list_collections_filter.h"
 #include "mongo/db/index_build_entry_helpers.h"
 #include "mongo/db/index_builds_coordinator.h"
+#include "mongo/db/query/cursor_response.h"
 #include "mongo/db/repl/collection_bulk_loader.h"
 #include "mongo/db/repl/collection_cloner.h"
 #include "mongo/db/repl/database_cloner_gen.h"
 #include "mongo/db/repl/repl_server_parameters_gen.h"
+#include "mongo/db/repl/replication_auth.h"
 #include "mongo/db/wire_version.h"
 #include "mongo/logv2/log.h"
 #include "mongo/rpc/get_status_from_command_result.h"
 
 #include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_pool.h"
+#include "mongo/util/scopeguard.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kReplicationInitialSync
 
@@ -60,6 +65,18 @@ MONGO_FAIL_POINT_DEFINE(initialSyncHangDuringCollectionClone);
 // DBClientConnection, optionally limited to a specific collection.
 MONGO_FAIL_POINT_DEFINE(initialSyncHangCollectionClonerAfterHandlingBatchResponse);
 
+// Failpoint which causes each partition of a partitioned collection clone to hang after it
+// connected to the source, before it runs its query.
+MONGO_FAIL_POINT_DEFINE(initialSyncHangCollectionClonerBeforePartitionQuery);
+
+namespace {
+
+// The number of _id values sampled for each partition of a partitioned collection clone. The more
+// samples, the more evenly the split points divide the collection.
+constexpr int kSamplesPerPartition = 16;
+
+}  // namespace
+
 CollectionCloner::CollectionCloner(const NamespaceString& sourceNss,
                                    const CollectionOptions& collectionOptions,
                                    InitialSyncSharedData* sharedData,
@@ -251,7 +268,17 @@ BaseCloner::AfterStageBehavior CollectionCloner::createCollectionStage() {
 }
 
 BaseCloner::AfterStageBehavior CollectionCloner::queryStage() {
-    runQuery();
+    // A retried or resumed query must continue the way it started, which is with a single query.
+    std::vector<BSONObj> splitPoints;
+    if (!_resumeToken && getStats().documentsCopied == 0) {
+        splitPoints = getPartitionSplitPoints();
+    }
+
+    if (splitPoints.empty()) {
+        runQuery();
+    } else {
+        runPartitionedQuery(splitPoints);
+    }
     waitForDatabaseWorkToComplete();
     // We want to free the _collLoader regardless of whether the commit succeeds.
     std::unique_ptr<CollectionBulkLoader> loader = std::move(_collLoader);
@@ -348,6 +375,178 @@ void CollectionCloner::runQuery() {
         ReadConcernArgs::kLocal);
 }
 
+std::vector<BSONObj> CollectionCloner::getPartitionSplitPoints() {
+    const int numPartitions = collectionClonerPartitions;
+    if (numPartitions <= 1 || getStats().bytesToCopy < collectionClonerPartitionMinBytes) {
+        return {};
+    }
+
+    // The ranges are scanned on the _id index with 'min' and 'max' bounds, which are index keys.
+    // These are only comparable to _id values if the index uses the simple collation.
+    if (_collectionOptions.capped || _collectionOptions.clusteredIndex ||
+        !_collectionOptions.collation.isEmpty() || _idIndexSpec.isEmpty()) {
+        return {};
+    }
+
+    // The aggregate command does not take a UUID. Should the collection have been renamed, the
+    // split points only divide the collection less evenly, since the ranges between them always
+    // cover all _id values.
+    const int sampleSize = numPartitions * kSamplesPerPartition;
+    BSONObj res;
+    getClient()->runCommand(
+        _sourceNss.db().toString(),
+        BSON("aggregate" << _sourceNss.coll() << "pipeline"
+                         << BSON_ARRAY(BSON("$sample" << BSON("size" << sampleSize))
+                                       << BSON("$project" << BSON("_id" << 1)))
+                         << "cursor" << BSON("batchSize" << sampleSize) << "readConcern"
+                         << ReadConcernArgs::kLocal),
+        res,
+        QueryOption_SecondaryOk);
+    auto swCursorResponse = CursorResponse::parseFromBSON(res);
+    if (!swCursorResponse.isOK()) {
+        LOGV2_DEBUG(7086797,
+                    1,
+                    "Failed to sample the collection for a partitioned clone, cloning it with a "
+                    "single query",
+                    logAttrs(_sourceNss),
+                    "error"_attr = swCursorResponse.getStatus());
+        return {};
+    }
+
+    auto samples = swCursorResponse.getValue().releaseBatch();
+    if (samples.size() < static_cast<size_t>(numPartitions)) {
+        return {};
+    }
+    std::sort(samples.begin(), samples.end(), SimpleBSONObjComparator::kInstance.makeLessThan());
+
+    std::vector<BSONObj> splitPoints;
+    for (int i = 1; i < numPartitions; ++i) {
+        const auto& sample = samples[i * samples.size() / numPartitions];
+        if (sample.isEmpty() ||
+            (!splitPoints.empty() &&
+             SimpleBSONObjComparator::kInstance.evaluate(splitPoints.back() == sample))) {
+            continue;
+        }
+        splitPoints.push_back(sample.getOwned());
+    }
+    return splitPoints;
+}
+
+void CollectionCloner::runPartitionedQuery(const std::vector<BSONObj>& splitPoints) {
+    LOGV2(7086796,
+          "Collection cloner will clone the collection in partitions",
+          logAttrs(_sourceNss),
+          "numPartitions"_attr = splitPoints.size() + 1);
+
+    AtomicWord<bool> cancelled{false};
+    std::vector<Status> statuses(splitPoints.size() + 1, Status::OK());
+
+    ThreadPool::Options options;
+    options.poolName = "CollectionClonerPartitions";
+    options.threadNamePrefix = "CollectionClonerPartition-";
+    options.minThreads = 0;
+    options.maxThreads = statuses.size();
+    options.onCreateThread = [](const std::string& threadName) {
+        Client::initThread(threadName);
+    };
+    ThreadPool pool(options);
+    pool.startup();
+    for (size_t i = 0; i < statuses.size(); ++i) {
+        pool.schedule([this, i, &splitPoints, &cancelled, &status = statuses[i]](
+                          Status schedulingStatus) {
+            try {
+                uassertStatusOK(schedulingStatus);
+                clonePartition(i == 0 ? BSONObj() : splitPoints[i - 1],
+                               i == splitPoints.size() ? BSONObj() : splitPoints[i],
+                               cancelled);
+            } catch (const DBException& e) {
+                status = e.toStatus();
+                cancelled.store(true);
+            }
+        });
+    }
+    pool.shutdown();
+    pool.join();
+
+    // The stage exits normally if the collection was dropped on the source.
+    for (const auto& status : statuses) {
+        if (status == ErrorCodes::NamespaceNotFound) {
+            uassertStatusOK(status);
+        }
+    }
+
+    // The documents of the ranges which were cloned are already in the collection, so the stage
+    // must not be retried.
+    for (const auto& status : statuses) {
+        if (!status.isOK()) {
+            uasserted(ErrorCodes::InitialSyncFailure,
+                      str::stream() << "Failed to clone a partition of collection '"
+                                    << _sourceNss.ns() << "' :: caused by :: " << status);
+        }
+    }
+}
+
+void CollectionCloner::clonePartition(const BSONObj& min,
+                                      const BSONObj& max,
+                                      const AtomicWord<bool>& cancelled) {
+    // The connection is registered with the shared data, so that the initial syncer can interrupt
+    // it on shutdown or when the attempt is aborted.
+    std::unique_ptr<DBClientConnection> conn;
+    {
+        stdx::lock_guard<InitialSyncSharedData> lk(*getSharedData());
+        conn = getSharedData()->makeAdditionalClient(lk);
+    }
+    ON_BLOCK_EXIT([&] {
+        stdx::lock_guard<InitialSyncSharedData> lk(*getSharedData());
+        getSharedData()->releaseAdditionalClient(lk, conn.get());
+    });
+    uassertStatusOK(conn->connect(getSource(), StringData(), boost::none));
+    uassertStatusOK(replAuthenticate(conn.get())
+                        .withContext(str::stream() << "Failed to authenticate to " << getSource()));
+    initialSyncHangCollectionClonerBeforePartitionQuery.pauseWhileSet();
+
+    FindCommandRequest findRequest{_sourceDbAndUuid};
+    findRequest.setHint(BSON("_id" << 1));
+    if (!min.isEmpty()) {
+        findRequest.setMin(min);
+    }
+    if (!max.isEmpty()) {
+        findRequest.setMax(max);
+    }
+    if (_collectionClonerBatchSize) {
+        findRequest.setBatchSize(_collectionClonerBatchSize);
+    }
+    findRequest.setNoCursorTimeout(true);
+    findRequest.setReadConcern(ReadConcernArgs::kLocal);
+
+    auto cursor = conn->find(std::move(findRequest),
+                             ReadPreferenceSetting{ReadPreference::SecondaryPreferred},
+                             collectionClonerUsesExhaust ? ExhaustMode::kOn : ExhaustMode::kOff);
+    uassert(ErrorCodes::InitialSyncFailure,
+            str::stream() << "Failed to query a partition of collection '" << _sourceNss.ns()
+                          << "'",
+            cursor);
+
+    std::vector<BSONObj> docs;
+    while (!cancelled.load() && cursor->more()) {
+        {
+            stdx::lock_guard<InitialSyncSharedData> lk(*getSharedData());
+            uassertStatusOK(getSharedData()->getStatus(lk).withContext(
+                "Collection cloning cancelled due to initial sync failure"));
+        }
+
+        docs.clear();
+        while (cursor->moreInCurrentBatch()) {
+            docs.emplace_back(cursor->nextSafe());
+        }
+
+        stdx::lock_guard<Latch> lk(_mutex);
+        ++_stats.receivedBatches;
+        ++_stats.fetchedBatches;
+        insertDocuments(lk, docs);
+    }
+}
+
 void CollectionCloner::handleNextBatch(DBClientCursorBatchIterator& iter) {
     {
         stdx::lock_guard<InitialSyncSharedData> lk(*getSharedData());
@@ -434,14 +633,7 @@ void CollectionCloner::insertDocumentsCallback(const executor::TaskExecutor::Cal
             return;
         }
         _documentsToInsert.swap(docs);
-        _stats.documentsCopied += docs.size();
-        _stats.approxBytesCopied = ((long)_stats.documentsCopied) * _stats.avgObjSize;
-        _progressMeter.hit(int(docs.size()));
-        invariant(_collLoader);
-
-        // The insert must be done within the lock, because CollectionBulkLoader is not
-        // thread safe.
-        uassertStatusOK(_collLoader->insertDocuments(docs.cbegin(), docs.cend()));
+        insertDocuments(lk, docs);
     }
 
     initialSyncHangDuringCollectionClone.executeIf(
@@ -460,6 +652,17 @@ void CollectionCloner::insertDocumentsCallback(const executor::TaskExecutor::Cal
         });
 }
 
+void CollectionCloner::insertDocuments(WithLock, const std::vector<BSONObj>& docs) {
+    _stats.documentsCopied += docs.size();
+    _stats.approxBytesCopied = ((long)_stats.documentsCopied) * _stats.avgObjSize;
+    _progressMeter.hit(int(docs.size()));
+    invariant(_collLoader);
+
+    // The insert must be done within the lock, because CollectionBulkLoader is not
+    // thread safe.
+    uassertStatusOK(_collLoader->insertDocuments(docs.cbegin(), docs.cend()));
+}
+
 bool CollectionCloner::isMyFailPoint(const BSONObj& data) const {
     auto nss = data["nss"].str();
     return (nss.empty() || nss == _sourceNss.toString()) && BaseCloner::isMyFailPoint(data);
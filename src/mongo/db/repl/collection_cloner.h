@@ -36,6 +36,8 @@
 #include "mongo/db/repl/initial_sync_base_cloner.h"
 #include "mongo/db/repl/initial_sync_shared_data.h"
 #include "mongo/db/repl/task_runner.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/util/concurrency/with_lock.h"
 #include "mongo/util/progress_meter.h"
 
 namespace mongo {
@@ -220,12 +222,42 @@ private:
      */
     void insertDocumentsCallback(const executor::TaskExecutor::CallbackArgs& cbd);
 
+    /**
+     * Inserts a batch of documents read from the source and accounts for them in the stats.
+     * CollectionBulkLoader is not thread safe, so this must be called with '_mutex' held.
+     */
+    void insertDocuments(WithLock, const std::vector<BSONObj>& docs);
+
     /**
      * Sends a query command to the source. That query command with be parameterized based on
      * wire version and clone progress.
      */
     void runQuery();
 
+    /**
+     * Returns the boundaries of the _id ranges into which the collection is split, as {_id: value}
+     * objects in ascending order. The boundaries are picked from a $sample of the collection on
+     * the source. Returns an empty vector if the collection is to be cloned with a single query,
+     * such as when partitioning is disabled, or the collection is small, capped, clustered or has
+     * a non-simple default collation.
+     */
+    std::vector<BSONObj> getPartitionSplitPoints();
+
+    /**
+     * Clones the ranges between consecutive 'splitPoints' concurrently, each on a thread of a
+     * dedicated pool and over a connection of its own. Throws the first error of any range once
+     * all of them stopped.
+     */
+    void runPartitionedQuery(const std::vector<BSONObj>& splitPoints);
+
+    /**
+     * Fetches the documents in the _id range ['min', 'max') over a new connection to the source
+     * and inserts them. An empty bound leaves that side of the range open. Stops early once
+     * 'cancelled' is set. The connection is made by the shared data, which shuts it down when the
+     * initial sync attempt is canceled.
+     */
+    void clonePartition(const BSONObj& min, const BSONObj& max, const AtomicWord<bool>& cancelled);
+
     // All member variables are labeled with one of the following codes indicating the
     // synchronization rules for accessing them.
     //
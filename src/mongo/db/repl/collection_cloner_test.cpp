@@ -1007,5 +1007,89 @@ TEST_F(CollectionClonerTestResumable, ResumableQueryTwoResumes) {
 }
 
 
+class CollectionClonerTestPartitioned : public CollectionClonerTestResumable {
+protected:
+    // Sets up a collection of 'numDocs' documents which is cloned in two partitions split at
+    // {_id: numDocs / 2}.
+    void setUpPartitionedCollection(int numDocs) {
+        collectionClonerPartitions = 2;
+        collectionClonerPartitionMinBytes = 0;
+        setMockServerReplies(BSON("size" << 10),
+                             createCountResponse(numDocs),
+                             createCursorResponse(_nss.ns(), BSON_ARRAY(_idIndexSpec)));
+        BSONArrayBuilder samples;
+        for (int i = 0; i < numDocs; ++i) {
+            _mockServer->insert(_nss.ns(), BSON("_id" << i));
+            samples.append(BSON("_id" << i));
+        }
+        _mockServer->setCommandReply("aggregate", createCursorResponse(_nss.ns(), samples.arr()));
+    }
+
+    void tearDown() override {
+        collectionClonerPartitions = _partitionsDefault;
+        collectionClonerPartitionMinBytes = _partitionMinBytesDefault;
+        CollectionClonerTestResumable::tearDown();
+    }
+
+private:
+    const int _partitionsDefault = collectionClonerPartitions;
+    const long long _partitionMinBytesDefault = collectionClonerPartitionMinBytes;
+};
+
+TEST_F(CollectionClonerTestPartitioned, ClonesEveryPartition) {
+    setUpPartitionedCollection(10);
+
+    auto cloner = makeCollectionCloner();
+    ASSERT_OK(cloner->run());
+
+    ASSERT_EQUALS(10, _collectionStats->insertCount);
+    ASSERT_TRUE(_collectionStats->commitCalled);
+    auto stats = cloner->getStats();
+    ASSERT_EQUALS(10u, stats.documentsCopied);
+    // Each of the two partitions fetched its range in a single batch.
+    ASSERT_EQUALS(2u, stats.receivedBatches);
+}
+
+TEST_F(CollectionClonerTestPartitioned, FailsOnceAdditionalClientsAreShutDown) {
+    setUpPartitionedCollection(10);
+    {
+        stdx::lock_guard<InitialSyncSharedData> lk(*getSharedData());
+        getSharedData()->shutdownAdditionalClients(lk);
+    }
+
+    auto cloner = makeCollectionCloner();
+    ASSERT_EQUALS(ErrorCodes::InitialSyncFailure, cloner->run());
+    ASSERT_EQUALS(0, _collectionStats->insertCount);
+}
+
+TEST_F(CollectionClonerTestPartitioned, ShutdownInterruptsRunningPartitions) {
+    setUpPartitionedCollection(10);
+
+    auto cloner = makeCollectionCloner();
+    auto partitionFailPoint =
+        globalFailPointRegistry().find("initialSyncHangCollectionClonerBeforePartitionQuery");
+    auto timesEntered = partitionFailPoint->setMode(FailPoint::alwaysOn);
+
+    // Run the cloner in a separate thread.
+    stdx::thread clonerThread([&] {
+        Client::initThread("ClonerRunner");
+        ASSERT_EQUALS(ErrorCodes::InitialSyncFailure, cloner->run());
+    });
+    // Wait for both partitions to have connected to the source.
+    partitionFailPoint->waitForTimesEntered(timesEntered + 2);
+
+    // This is what the initial syncer does when the attempt is canceled.
+    {
+        stdx::lock_guard<InitialSyncSharedData> lk(*getSharedData());
+        getSharedData()->shutdownAdditionalClients(lk);
+    }
+
+    // Continue and finish. Final status is checked in the thread.
+    partitionFailPoint->setMode(FailPoint::off);
+    clonerThread.join();
+    ASSERT_EQUALS(0, _collectionStats->insertCount);
+}
+
+
 }  // namespace repl
 }  // namespace mongo
@@ -32,6 +32,7 @@
 #include "mongo/base/checked_cast.h"
 #include "mongo/db/repl/initial_sync_cloner_test_fixture.h"
 #include "mongo/db/repl/replication_consistency_markers_impl.h"
+#include "mongo/dbtests/mock/mock_dbclient_connection.h"
 
 namespace mongo {
 namespace repl {
@@ -40,6 +41,13 @@ void InitialSyncClonerTestFixture::setUp() {
     ClonerTestFixture::setUp();
 
     _sharedData = std::make_unique<InitialSyncSharedData>(kInitialRollbackId, Days(1), &_clock);
+    {
+        // Connections besides the shared one, such as those of the partitions of a collection
+        // clone, go to the same mock server.
+        stdx::lock_guard<InitialSyncSharedData> lk(*getSharedData());
+        getSharedData()->setCreateClientFn(
+            lk, [this] { return std::make_unique<MockDBClientConnection>(_mockServer.get()); });
+    }
 
     // Set the initial sync ID on the mock server.
     _mockServer->insert(
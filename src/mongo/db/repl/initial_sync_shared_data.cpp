@@ -30,6 +30,7 @@
 #include "mongo/platform/basic.h"
 
 #include "mongo/db/repl/initial_sync_shared_data.h"
+#include "mongo/util/assert_util.h"
 
 namespace mongo {
 namespace repl {
@@ -76,5 +77,26 @@ Milliseconds InitialSyncSharedData::getCurrentOutageDuration(WithLock lk) {
                                            : Milliseconds::min());
 }
 
+std::unique_ptr<DBClientConnection> InitialSyncSharedData::makeAdditionalClient(WithLock) {
+    uassert(ErrorCodes::CallbackCanceled,
+            "Initial sync attempt canceled",
+            !_additionalClientsShutDown);
+    invariant(_createClientFn);
+    auto client = _createClientFn();
+    _additionalClients.insert(client.get());
+    return client;
+}
+
+void InitialSyncSharedData::releaseAdditionalClient(WithLock, DBClientConnection* client) {
+    invariant(_additionalClients.erase(client) == 1);
+}
+
+void InitialSyncSharedData::shutdownAdditionalClients(WithLock) {
+    _additionalClientsShutDown = true;
+    for (auto client : _additionalClients) {
+        client->shutdownAndDisallowReconnect();
+    }
+}
+
 }  // namespace repl
 }  // namespace mongo
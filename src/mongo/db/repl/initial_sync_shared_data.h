@@ -29,10 +29,14 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <mutex>
 
+#include "mongo/client/dbclient_connection.h"
 #include "mongo/db/repl/repl_sync_shared_data.h"
 #include "mongo/db/server_options.h"
+#include "mongo/stdx/unordered_set.h"
 
 namespace mongo {
 namespace repl {
@@ -43,6 +47,8 @@ private:
 public:
     typedef boost::optional<RetryingOperation> RetryableOperation;
 
+    using CreateClientFn = std::function<std::unique_ptr<DBClientConnection>()>;
+
     InitialSyncSharedData(int rollBackId, Milliseconds allowedOutageDuration, ClockSource* clock)
         : ReplSyncSharedData(clock),
           _rollBackId(rollBackId),
@@ -114,6 +120,32 @@ public:
         _allowedOutageDuration = allowedOutageDuration;
     }
 
+    /**
+     * Sets the function with which makeAdditionalClient() creates connections to the sync source.
+     */
+    void setCreateClientFn(WithLock, CreateClientFn createClientFn) {
+        _createClientFn = std::move(createClientFn);
+    }
+
+    /**
+     * Creates a connection to the sync source besides the one shared by the cloners, such as one
+     * per partition of a collection clone, and registers it so that shutdownAdditionalClients()
+     * interrupts it. The connection must be passed to releaseAdditionalClient() before it is
+     * destroyed. Throws CallbackCanceled once the additional clients have been shut down.
+     */
+    std::unique_ptr<DBClientConnection> makeAdditionalClient(WithLock);
+
+    /**
+     * Unregisters a connection created by makeAdditionalClient().
+     */
+    void releaseAdditionalClient(WithLock, DBClientConnection* client);
+
+    /**
+     * Shuts down the registered additional connections, which interrupts any operation they are
+     * running, and makes makeAdditionalClient() fail from now on.
+     */
+    void shutdownAdditionalClients(WithLock);
+
 private:
     class RetryingOperation {
     public:
@@ -197,6 +229,15 @@ private:
 
     // The initial sync ID on the source at the start of data cloning.
     boost::optional<UUID> _initialSyncSourceId;
+
+    // Creates the additional connections to the sync source.
+    CreateClientFn _createClientFn;
+
+    // The additional connections which have not been released yet.
+    stdx::unordered_set<DBClientConnection*> _additionalClients;
+
+    // Set once the additional connections have been shut down.
+    bool _additionalClientsShutDown = false;
 };
 }  // namespace repl
 }  // namespace mongo
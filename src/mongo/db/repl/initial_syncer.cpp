@@ -348,6 +348,7 @@ void InitialSyncer::_cancelRemainingWork_inlock() {
         stdx::lock_guard<InitialSyncSharedData> lock(*_sharedData);
         _sharedData->setStatusIfOK(
             lock, Status{ErrorCodes::CallbackCanceled, "Initial sync attempt canceled"});
+        _sharedData->shutdownAdditionalClients(lock);
     }
     if (_client) {
         _client->shutdownAndDisallowReconnect();
@@ -1162,6 +1163,10 @@ void InitialSyncer::_fcvFetcherCallback(const StatusWith<Fetcher::QueryResponse>
         std::make_unique<InitialSyncSharedData>(_rollbackChecker->getBaseRBID(),
                                                 _allowedOutageDuration,
                                                 getGlobalServiceContext()->getFastClockSource());
+    {
+        stdx::lock_guard<InitialSyncSharedData> sharedDataLock(*_sharedData);
+        _sharedData->setCreateClientFn(sharedDataLock, _createClientFn);
+    }
     _client = _createClientFn();
     _initialSyncState = std::make_unique<InitialSyncState>(std::make_unique<AllDatabaseCloner>(
         _sharedData.get(), _syncSource, _client.get(), _storage, _writerPool));
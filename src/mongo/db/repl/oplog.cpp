@@ -58,6 +58,8 @@
 #include "mongo/db/catalog/local_oplog_info.h"
 #include "mongo/db/catalog/multi_index_block.h"
 #include "mongo/db/catalog/rename_collection.h"
+#include "mongo/db/catalog/truncate_range.h"
+#include "mongo/db/catalog/truncate_range_oplog_entry_gen.h"
 #include "mongo/db/change_stream_change_collection_manager.h"
 #include "mongo/db/client.h"
 #include "mongo/db/coll_mod_gen.h"
@@ -1091,6 +1093,31 @@ const StringMap<ApplyOpMetadata> kOpsMap = {
               extractNsFromUUIDorNs(opCtx, entry.getNss(), entry.getUuid(), entry.getObject()));
       },
       {ErrorCodes::NamespaceNotFound}}},
+    {"truncateRange",
+     {[](OperationContext* opCtx, const OplogEntry& entry, OplogApplication::Mode mode) -> Status {
+          const auto truncateRangeEntry = TruncateRangeOplogEntry::parse(
+              IDLParserErrorContext("truncateRangeOplogEntry"), entry.getObject());
+          const auto nss =
+              extractNsFromUUIDorNs(opCtx, entry.getNss(), entry.getUuid(), entry.getObject());
+
+          AutoGetCollection coll(opCtx, nss, MODE_IX);
+          if (!coll) {
+              return Status(ErrorCodes::NamespaceNotFound,
+                            str::stream() << "Cannot truncate a range of " << nss
+                                          << ": collection does not exist");
+          }
+
+          // The documents in the range are counted again rather than trusting 'docsDeleted',
+          // since some of them may already be gone when the entry is applied during initial sync.
+          WriteUnitOfWork wuow(opCtx);
+          truncateRange(opCtx,
+                        coll.getCollection(),
+                        truncateRangeEntry.getMinRecordId(),
+                        truncateRangeEntry.getMaxRecordId());
+          wuow.commit();
+          return Status::OK();
+      },
+      {ErrorCodes::NamespaceNotFound}}},
     {"commitTransaction",
      {[](OperationContext* opCtx, const OplogEntry& entry, OplogApplication::Mode mode) -> Status {
          return applyCommitTransaction(opCtx, entry, mode);
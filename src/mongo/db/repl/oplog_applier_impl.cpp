@@ -116,7 +116,8 @@ void _addOplogChainOpsToWriterVectors(OperationContext* opCtx,
                                       std::vector<std::vector<OplogEntry>>* derivedOps,
                                       OplogEntry* op,
                                       CachedCollectionProperties* collPropertiesCache,
-                                      std::vector<std::vector<const OplogEntry*>>* writerVectors) {
+                                      std::vector<std::vector<const OplogEntry*>>* writerVectors,
+                                      WriterAssignmentTracker* writerAssignments) {
     std::vector<OplogEntry> txnOps;
     bool shouldSerialize = false;
     std::tie(txnOps, shouldSerialize) =
@@ -125,8 +126,12 @@ void _addOplogChainOpsToWriterVectors(OperationContext* opCtx,
     partialTxnList->clear();
 
     // Transaction entries cannot have different session updates.
-    OplogApplierUtils::addDerivedOps(
-        opCtx, &derivedOps->back(), writerVectors, collPropertiesCache, shouldSerialize);
+    OplogApplierUtils::addDerivedOps(opCtx,
+                                     &derivedOps->back(),
+                                     writerVectors,
+                                     collPropertiesCache,
+                                     shouldSerialize,
+                                     writerAssignments);
 }
 
 }  // namespace
@@ -612,13 +617,15 @@ StatusWith<OpTime> OplogApplierImpl::_applyOplogBatch(OperationContext* opCtx,
  *      and instructions for updating the transactions table.  Required if processing oplogs
  *      with transactions.
  * sessionUpdateTracker - if provided, keeps track of session info from ops.
+ * writerAssignments - if provided, chooses the writers of the ops instead of their hashes.
  */
 void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
     OperationContext* opCtx,
     std::vector<OplogEntry>* ops,
     std::vector<std::vector<const OplogEntry*>>* writerVectors,
     std::vector<std::vector<OplogEntry>>* derivedOps,
-    SessionUpdateTracker* sessionUpdateTracker) noexcept {
+    SessionUpdateTracker* sessionUpdateTracker,
+    WriterAssignmentTracker* writerAssignments) noexcept {
 
     LogicalSessionIdMap<std::vector<OplogEntry*>> partialTxnOps;
     CachedCollectionProperties collPropertiesCache;
@@ -641,7 +648,8 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
                                                  &derivedOps->back(),
                                                  writerVectors,
                                                  &collPropertiesCache,
-                                                 false /*serial*/);
+                                                 false /*serial*/,
+                                                 writerAssignments);
             }
         }
 
@@ -677,8 +685,13 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
                 // oplog and fill writers with those operations.
                 // Flush partialTxnList operations for current transaction.
                 auto& partialTxnList = partialTxnOps[*logicalSessionId];
-                _addOplogChainOpsToWriterVectors(
-                    opCtx, &partialTxnList, derivedOps, &op, &collPropertiesCache, writerVectors);
+                _addOplogChainOpsToWriterVectors(opCtx,
+                                                 &partialTxnList,
+                                                 derivedOps,
+                                                 &op,
+                                                 &collPropertiesCache,
+                                                 writerVectors,
+                                                 writerAssignments);
             } else {
                 // The applyOps entry was not generated as part of a transaction.
                 invariant(!op.getPrevWriteOpTimeInTransaction());
@@ -690,7 +703,8 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
                                                  &derivedOps->back(),
                                                  writerVectors,
                                                  &collPropertiesCache,
-                                                 false /*serial*/);
+                                                 false /*serial*/,
+                                                 writerAssignments);
             }
             continue;
         }
@@ -701,8 +715,13 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
         if (op.isPreparedCommit() && (getOptions().mode == OplogApplication::Mode::kInitialSync)) {
             auto logicalSessionId = op.getSessionId();
             auto& partialTxnList = partialTxnOps[*logicalSessionId];
-            _addOplogChainOpsToWriterVectors(
-                opCtx, &partialTxnList, derivedOps, &op, &collPropertiesCache, writerVectors);
+            _addOplogChainOpsToWriterVectors(opCtx,
+                                             &partialTxnList,
+                                             derivedOps,
+                                             &op,
+                                             &collPropertiesCache,
+                                             writerVectors,
+                                             writerAssignments);
             continue;
         }
 
@@ -710,8 +729,12 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
         // migration and access blocker states.
         if (op.getNss() == NamespaceString::kTenantMigrationDonorsNamespace ||
             op.getNss() == NamespaceString::kTenantMigrationRecipientsNamespace) {
-            auto writerId = OplogApplierUtils::addToWriterVector(
-                opCtx, &op, writerVectors, &collPropertiesCache, tenantMigrationsWriterId);
+            auto writerId = OplogApplierUtils::addToWriterVector(opCtx,
+                                                                 &op,
+                                                                 writerVectors,
+                                                                 &collPropertiesCache,
+                                                                 tenantMigrationsWriterId,
+                                                                 writerAssignments);
             if (!tenantMigrationsWriterId) {
                 tenantMigrationsWriterId.emplace(writerId);
             } else {
@@ -719,7 +742,8 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
             }
             continue;
         }
-        OplogApplierUtils::addToWriterVector(opCtx, &op, writerVectors, &collPropertiesCache);
+        OplogApplierUtils::addToWriterVector(
+            opCtx, &op, writerVectors, &collPropertiesCache, boost::none, writerAssignments);
     }
 }
 
@@ -730,13 +754,27 @@ void OplogApplierImpl::fillWriterVectors(
     std::vector<std::vector<OplogEntry>>* derivedOps) noexcept {
 
     SessionUpdateTracker sessionUpdateTracker;
-    _deriveOpsAndFillWriterVectors(opCtx, ops, writerVectors, derivedOps, &sessionUpdateTracker);
+
+    // The same tracker is used for both passes, since the session updates flushed at the end may
+    // write the same config.transactions documents as those derived during the first pass.
+    boost::optional<WriterAssignmentTracker> writerAssignments;
+    if (oplogApplierBalanceWriterLoad.load()) {
+        writerAssignments.emplace();
+    }
+    auto writerAssignmentsPtr = writerAssignments ? &*writerAssignments : nullptr;
+
+    _deriveOpsAndFillWriterVectors(
+        opCtx, ops, writerVectors, derivedOps, &sessionUpdateTracker, writerAssignmentsPtr);
 
     auto newOplogWrites = sessionUpdateTracker.flushAll();
     if (!newOplogWrites.empty()) {
         derivedOps->emplace_back(std::move(newOplogWrites));
-        _deriveOpsAndFillWriterVectors(
-            opCtx, &derivedOps->back(), writerVectors, derivedOps, nullptr);
+        _deriveOpsAndFillWriterVectors(opCtx,
+                                       &derivedOps->back(),
+                                       writerVectors,
+                                       derivedOps,
+                                       nullptr,
+                                       writerAssignmentsPtr);
     }
 }
 
@@ -44,6 +44,8 @@
 namespace mongo {
 namespace repl {
 
+class WriterAssignmentTracker;
+
 /**
  * Applies oplog entries.
  * Primarily used to apply batches of operations fetched from a sync source during steady state
@@ -106,7 +108,8 @@ private:
                                         std::vector<OplogEntry>* ops,
                                         std::vector<std::vector<const OplogEntry*>>* writerVectors,
                                         std::vector<std::vector<OplogEntry>>* derivedOps,
-                                        SessionUpdateTracker* sessionUpdateTracker) noexcept;
+                                        SessionUpdateTracker* sessionUpdateTracker,
+                                        WriterAssignmentTracker* writerAssignments) noexcept;
 
     // Not owned by us.
     ReplicationCoordinator* const _replCoord;
@@ -688,6 +688,56 @@ TEST_F(OplogApplierImplTest,
                   secondDerivedOp.getObject()["lastWriteOpTime"]["ts"].timestamp());
 }
 
+TEST_F(OplogApplierImplTest, FillWriterVectorsKeepsUnrelatedOpsOffTheWriterOfAHotDocument) {
+    RAIIServerParameterControllerForTest balanceWriterLoad{"oplogApplierBalanceWriterLoad", true};
+    const NamespaceString nss{"test", "foo"};
+    const auto hotDoc = BSON("_id" << 0);
+
+    // Every other op updates the same document. The ops on the other documents are spread over
+    // the remaining writers rather than hashed, possibly onto the writer of the hot document.
+    std::vector<OplogEntry> ops;
+    int ts = 0;
+    ops.push_back(makeUpdateDocumentOplogEntry(
+        {Timestamp(Seconds(1), ++ts), 1LL}, nss, hotDoc, BSON("$set" << BSON("x" << 0))));
+    for (int i = 1; i <= 12; ++i) {
+        ops.push_back(makeInsertDocumentOplogEntry(
+            {Timestamp(Seconds(1), ++ts), 1LL}, nss, BSON("_id" << i)));
+        ops.push_back(makeUpdateDocumentOplogEntry(
+            {Timestamp(Seconds(1), ++ts), 1LL}, nss, hotDoc, BSON("$set" << BSON("x" << i))));
+    }
+
+    auto writerPool = makeReplWriterPool();
+    NoopOplogApplierObserver observer;
+    OplogApplierImpl oplogApplier(
+        nullptr,  // executor
+        nullptr,  // oplogBuffer
+        &observer,
+        ReplicationCoordinator::get(_opCtx.get()),
+        getConsistencyMarkers(),
+        getStorageInterface(),
+        repl::OplogApplier::Options(repl::OplogApplication::Mode::kSecondary),
+        writerPool.get());
+
+    std::vector<std::vector<const OplogEntry*>> writerVectors(4);
+    std::vector<std::vector<OplogEntry>> derivedOps;
+    oplogApplier.fillWriterVectors_forTest(_opCtx.get(), &ops, &writerVectors, &derivedOps);
+
+    const auto& hotWriter =
+        *std::find_if(writerVectors.begin(), writerVectors.end(), [&](const auto& writer) {
+            return !writer.empty() && writer.front() == &ops.front();
+        });
+    ASSERT_EQUALS(13U, hotWriter.size());
+    for (size_t i = 0; i < hotWriter.size(); ++i) {
+        ASSERT_BSONOBJ_EQ(hotDoc, hotWriter[i]->getIdElement().wrap());
+        ASSERT_EQUALS(ops[2 * i].getOpTime(), hotWriter[i]->getOpTime());
+    }
+    for (const auto& writer : writerVectors) {
+        if (&writer != &hotWriter) {
+            ASSERT_EQUALS(4U, writer.size());
+        }
+    }
+}
+
 class MultiOplogEntryOplogApplierImplTest : public OplogApplierImplTest {
 public:
     MultiOplogEntryOplogApplierImplTest()
@@ -158,6 +158,48 @@ TEST_F(OplogApplierTest, GetNextApplierBatchReturnsSystemDotViewsOpInOwnBatch) {
     ASSERT_EQUALS(srcOps[0], batch[0]);
 }
 
+TEST_F(OplogApplierTest, GetNextApplierBatchStartsWithOpThatEndedPreviousBatch) {
+    std::vector<OplogEntry> srcOps;
+    srcOps.push_back(makeInsertOplogEntry(1, NamespaceString(dbName, "bar")));
+    srcOps.push_back(makeInsertOplogEntry(
+        2, NamespaceString(dbName, NamespaceString::kSystemDotViewsCollectionName)));
+    srcOps.push_back(makeInsertOplogEntry(3, NamespaceString(dbName, "bar")));
+    _applier->enqueue(opCtx(), srcOps.cbegin(), srcOps.cend());
+
+    auto batch = unittest::assertGet(_applier->getNextApplierBatch(opCtx(), _limits));
+    ASSERT_EQUALS(1U, batch.size()) << toString(batch);
+    ASSERT_EQUALS(srcOps[0], batch[0]);
+
+    batch = unittest::assertGet(_applier->getNextApplierBatch(opCtx(), _limits));
+    ASSERT_EQUALS(1U, batch.size()) << toString(batch);
+    ASSERT_EQUALS(srcOps[1], batch[0]);
+
+    batch = unittest::assertGet(_applier->getNextApplierBatch(opCtx(), _limits));
+    ASSERT_EQUALS(1U, batch.size()) << toString(batch);
+    ASSERT_EQUALS(srcOps[2], batch[0]);
+}
+
+TEST_F(OplogApplierTest, GetNextApplierBatchDoesNotReuseOpThatEndedPreviousBatchAfterClear) {
+    std::vector<OplogEntry> srcOps;
+    srcOps.push_back(makeInsertOplogEntry(1, NamespaceString(dbName, "bar")));
+    srcOps.push_back(makeInsertOplogEntry(
+        2, NamespaceString(dbName, NamespaceString::kSystemDotViewsCollectionName)));
+    _applier->enqueue(opCtx(), srcOps.cbegin(), srcOps.cend());
+
+    auto batch = unittest::assertGet(_applier->getNextApplierBatch(opCtx(), _limits));
+    ASSERT_EQUALS(1U, batch.size()) << toString(batch);
+    ASSERT_EQUALS(srcOps[0], batch[0]);
+
+    _buffer->clear(opCtx());
+    srcOps.clear();
+    srcOps.push_back(makeInsertOplogEntry(3, NamespaceString(dbName, "bar")));
+    _applier->enqueue(opCtx(), srcOps.cbegin(), srcOps.cend());
+
+    batch = unittest::assertGet(_applier->getNextApplierBatch(opCtx(), _limits));
+    ASSERT_EQUALS(1U, batch.size()) << toString(batch);
+    ASSERT_EQUALS(srcOps[0], batch[0]);
+}
+
 TEST_F(OplogApplierTest, GetNextApplierBatchReturnsServerConfigurationOpInOwnBatch) {
     std::vector<OplogEntry> srcOps;
     srcOps.push_back(makeInsertOplogEntry(1, NamespaceString::kServerConfigurationNamespace));
@@ -512,6 +554,20 @@ TEST_F(OplogApplierDelayTest, GetNextApplierBatchInterrupted) {
     insertThread.join();
 }
 
+TEST(OplogBatchTest, TracksTotalSizeOfEntries) {
+    auto first = makeInsertOplogEntry(1, NamespaceString("test.foo"));
+    auto second = makeInsertOplogEntry(2, NamespaceString("test.foo"));
+
+    OplogBatch batch(2);
+    ASSERT_EQ(0U, batch.byteSize());
+    batch.emplace_back(first);
+    batch.emplace_back(second);
+    ASSERT_EQ(std::size_t(first.getRawObjSizeBytes() + second.getRawObjSizeBytes()),
+              batch.byteSize());
+    batch.pop_back();
+    ASSERT_EQ(std::size_t(first.getRawObjSizeBytes()), batch.byteSize());
+}
+
 }  // namespace
 }  // namespace repl
 }  // namespace mongo
@@ -80,6 +80,31 @@ CachedCollectionProperties::getCollectionPropertiesImpl(OperationContext* opCtx,
     return collProperties;
 }
 
+uint32_t WriterAssignmentTracker::assign(
+    uint32_t hash, const std::vector<std::vector<const OplogEntry*>>& writerVectors) {
+    auto it = _writerIdByHash.find(hash);
+    if (it != _writerIdByHash.end()) {
+        return it->second;
+    }
+
+    // Start the search at the writer the key hashes to, so that ties are broken the same way as
+    // without tracking.
+    const uint32_t numWriters = writerVectors.size();
+    uint32_t writerId = hash % numWriters;
+    for (uint32_t i = 1; i < numWriters; ++i) {
+        auto candidate = (hash + i) % numWriters;
+        if (writerVectors[candidate].size() < writerVectors[writerId].size()) {
+            writerId = candidate;
+        }
+    }
+    _writerIdByHash.emplace(hash, writerId);
+    return writerId;
+}
+
+void WriterAssignmentTracker::pin(uint32_t hash, uint32_t writerId) {
+    _writerIdByHash.emplace(hash, writerId);
+}
+
 void OplogApplierUtils::processCrudOp(OperationContext* opCtx,
                                       OplogEntry* op,
                                       uint32_t* hash,
@@ -113,7 +138,8 @@ uint32_t OplogApplierUtils::addToWriterVector(
     OplogEntry* op,
     std::vector<std::vector<const OplogEntry*>>* writerVectors,
     CachedCollectionProperties* collPropertiesCache,
-    boost::optional<uint32_t> forceWriterId) {
+    boost::optional<uint32_t> forceWriterId,
+    WriterAssignmentTracker* writerAssignments) {
     auto hashedNs = StringMapHasher().hashed_key(op->getNss().ns());
 
     // Reduce the hash from 64bit down to 32bit, just to allow combinations with murmur3 later
@@ -125,7 +151,15 @@ uint32_t OplogApplierUtils::addToWriterVector(
         processCrudOp(opCtx, op, &hash, &hashedNs, collPropertiesCache);
 
     const uint32_t numWriters = writerVectors->size();
-    auto writerId = (forceWriterId ? *forceWriterId : hash) % numWriters;
+    uint32_t writerId;
+    if (!writerAssignments) {
+        writerId = (forceWriterId ? *forceWriterId : hash) % numWriters;
+    } else if (forceWriterId) {
+        writerId = *forceWriterId % numWriters;
+        writerAssignments->pin(hash, writerId);
+    } else {
+        writerId = writerAssignments->assign(hash, *writerVectors);
+    }
     auto& writer = (*writerVectors)[writerId];
     if (writer.empty()) {
         writer.reserve(8);  // Skip a few growth rounds
@@ -155,13 +189,14 @@ void OplogApplierUtils::addDerivedOps(OperationContext* opCtx,
                                       std::vector<OplogEntry>* derivedOps,
                                       std::vector<std::vector<const OplogEntry*>>* writerVectors,
                                       CachedCollectionProperties* collPropertiesCache,
-                                      bool serial) {
+                                      bool serial,
+                                      WriterAssignmentTracker* writerAssignments) {
     boost::optional<uint32_t>
         serialWriterId;  // Used to determine which writer vector to assign serial ops.
 
     for (auto&& op : *derivedOps) {
-        auto writerId =
-            addToWriterVector(opCtx, &op, writerVectors, collPropertiesCache, serialWriterId);
+        auto writerId = addToWriterVector(
+            opCtx, &op, writerVectors, collPropertiesCache, serialWriterId, writerAssignments);
         if (serial && !serialWriterId) {
             serialWriterId.emplace(writerId);
         }
@@ -30,6 +30,7 @@
 #pragma once
 
 #include "mongo/db/repl/insert_group.h"
+#include "mongo/stdx/unordered_map.h"
 
 namespace mongo {
 class CollatorInterface;
@@ -59,6 +60,31 @@ private:
     StringMap<CollectionProperties> _cache;
 };
 
+/**
+ * Remembers the writer vector that each write key of a batch was assigned to. A write key is the
+ * hash computed for an op by OplogApplierUtils::addToWriterVector(), i.e. the namespace and, where
+ * the collection allows it, the _id of the document. Keys which are new to the batch are assigned
+ * to the writer with the fewest ops, so that a few hot documents do not also draw unrelated ops
+ * onto their writers, while all ops with the same key are still applied in order by one writer.
+ * Hash collisions merely serialize unrelated ops.
+ */
+class WriterAssignmentTracker {
+public:
+    /**
+     * Returns the writer vector for the ops with 'hash', choosing one if 'hash' was not seen yet.
+     */
+    uint32_t assign(uint32_t hash,
+                    const std::vector<std::vector<const OplogEntry*>>& writerVectors);
+
+    /**
+     * Records that the ops with 'hash' were placed on 'writerId', unless 'hash' was already seen.
+     */
+    void pin(uint32_t hash, uint32_t writerId);
+
+private:
+    stdx::unordered_map<uint32_t, uint32_t> _writerIdByHash;
+};
+
 /**
  * This class contains some static methods common to ordinary oplog application and oplog
  * application as part of tenant migration.
@@ -86,13 +112,15 @@ public:
 
     /**
      * Adds a single oplog entry to the appropriate writer vector.  Returns the index of the
-     * writer vector the entry was written to.
+     * writer vector the entry was written to. If 'writerAssignments' is provided, it chooses the
+     * writer instead of the op's hash modulo the number of writers.
      */
     static uint32_t addToWriterVector(OperationContext* opCtx,
                                       OplogEntry* op,
                                       std::vector<std::vector<const OplogEntry*>>* writerVectors,
                                       CachedCollectionProperties* collPropertiesCache,
-                                      boost::optional<uint32_t> forceWriterId = boost::none);
+                                      boost::optional<uint32_t> forceWriterId = boost::none,
+                                      WriterAssignmentTracker* writerAssignments = nullptr);
     /**
      * Adds a set of derivedOps to writerVectors.
      * If `serial` is true, assign all derived operations to the writer vector corresponding to the
@@ -102,7 +130,8 @@ public:
                               std::vector<OplogEntry>* derivedOps,
                               std::vector<std::vector<const OplogEntry*>>* writerVectors,
                               CachedCollectionProperties* collPropertiesCache,
-                              bool serial);
+                              bool serial,
+                              WriterAssignmentTracker* writerAssignments = nullptr);
 
     /**
      * Returns the namespace string for this oplogEntry; if it has a UUID it looks up the
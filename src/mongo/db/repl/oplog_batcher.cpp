@@ -45,30 +45,33 @@ MONGO_FAIL_POINT_DEFINE(skipOplogBatcherWaitForData);
 MONGO_FAIL_POINT_DEFINE(oplogBatcherPauseAfterSuccessfulPeek);
 
 OplogBatcher::OplogBatcher(OplogApplier* oplogApplier, OplogBuffer* oplogBuffer)
-    : _oplogApplier(oplogApplier), _oplogBuffer(oplogBuffer), _ops(0) {}
+    : _oplogApplier(oplogApplier), _oplogBuffer(oplogBuffer) {}
 OplogBatcher::~OplogBatcher() {
     invariant(!_thread);
 }
 
 OplogBatch OplogBatcher::getNextBatch(Seconds maxWaitTime) {
     stdx::unique_lock<Latch> lk(_mutex);
-    // _ops can indicate the following cases:
+    // The oldest ready batch can indicate the following cases:
     // 1. A new batch is ready to consume.
     // 2. Shutdown.
     // 3. The batch has (or had) exhausted the buffer in draining mode.
-    // 4. Empty batch since the batch has/had exhausted the buffer but not in draining mode,
-    //    so there could be new oplog entries coming.
-    // 5. Empty batch since the batcher is still running.
     //
-    // In case (4) and (5), we wait for up to "maxWaitTime".
-    if (_ops.empty() && !_ops.mustShutdown() && !_ops.termWhenExhausted()) {
+    // If there is no ready batch, either the batcher has exhausted the buffer but not in draining
+    // mode, so there could be new oplog entries coming, or it is still forming a batch. In both
+    // cases, we wait for up to "maxWaitTime".
+    if (_readyBatches.empty()) {
         // We intentionally don't care about whether this returns due to signaling or timeout
-        // since we do the same thing either way: return whatever is in _ops.
+        // since we do the same thing either way: return whatever is ready.
         (void)_cv.wait_for(lk, maxWaitTime.toSystemDuration());
+        if (_readyBatches.empty()) {
+            return OplogBatch(0);
+        }
     }
 
-    OplogBatch ops = std::move(_ops);
-    _ops = OplogBatch(0);
+    OplogBatch ops = std::move(_readyBatches.front());
+    _readyBatches.pop_front();
+    _readyBatchesBytes -= ops.byteSize();
     _cv.notify_all();
     return ops;
 }
@@ -169,7 +172,7 @@ StatusWith<std::vector<OplogEntry>> OplogBatcher::getNextApplierBatch(
     }
     while (_oplogBuffer->peek(opCtx, &op)) {
         oplogBatcherPauseAfterSuccessfulPeek.pauseWhileSet();
-        auto entry = OplogEntry(op);
+        auto entry = _parsePeekedEntry(op);
 
         // Check for oplog version change.
         if (entry.getVersion() != OplogEntry::kOplogVersion) {
@@ -195,6 +198,7 @@ StatusWith<std::vector<OplogEntry>> OplogBatcher::getNextApplierBatch(
                     // reconfigs and shutdown to occur.
                     sleepsecs(1);
                 }
+                _deferredEntry.emplace(std::move(entry));
                 return std::move(ops);
             }
         }
@@ -206,6 +210,7 @@ StatusWith<std::vector<OplogEntry>> OplogBatcher::getNextApplierBatch(
             }
 
             // Otherwise, apply what we have so far and come back for this entry.
+            _deferredEntry.emplace(std::move(entry));
             return std::move(ops);
         }
 
@@ -214,6 +219,7 @@ StatusWith<std::vector<OplogEntry>> OplogBatcher::getNextApplierBatch(
         auto opBytes = entry.getRawObjSizeBytes();
         if (totalOps > 0) {
             if (totalOps + opCount > batchLimits.ops || totalBytes + opBytes > batchLimits.bytes) {
+                _deferredEntry.emplace(std::move(entry));
                 return std::move(ops);
             }
         }
@@ -222,6 +228,7 @@ StatusWith<std::vector<OplogEntry>> OplogBatcher::getNextApplierBatch(
         if (totalOps > 0 && !batchLimits.forceBatchBoundaryAfter.isNull() &&
             entry.getOpTime().getTimestamp() > batchLimits.forceBatchBoundaryAfter &&
             ops.back().getOpTime().getTimestamp() <= batchLimits.forceBatchBoundaryAfter) {
+            _deferredEntry.emplace(std::move(entry));
             return std::move(ops);
         }
 
@@ -268,6 +275,17 @@ boost::optional<Date_t> OplogBatcher::_calculateSecondaryDelaySecsLatestTimestam
     return fastClockSource->now() - secondaryDelaySecs;
 }
 
+OplogEntry OplogBatcher::_parsePeekedEntry(const BSONObj& op) {
+    // The deferred entry shares ownership of the document it was parsed from, so as long as it is
+    // kept, no other document can be peeked at the same address.
+    boost::optional<OplogEntry> deferredEntry;
+    std::swap(deferredEntry, _deferredEntry);
+    if (deferredEntry && deferredEntry->getEntry().getRaw().objdata() == op.objdata()) {
+        return std::move(*deferredEntry);
+    }
+    return OplogEntry(op);
+}
+
 void OplogBatcher::_consume(OperationContext* opCtx, OplogBuffer* oplogBuffer) {
     // This is just to get the op off the buffer; it's been peeked at and queued for application
     // already.
@@ -376,11 +394,22 @@ void OplogBatcher::_run(StorageInterface* storageInterface) {
         }
 
         stdx::unique_lock<Latch> lk(_mutex);
-        // Block until the previous batch has been taken.
-        _cv.wait(lk, [&] { return _ops.empty() && !_ops.termWhenExhausted(); });
-        _ops = std::move(ops);
+        // Block until there is room for this batch. A batch which signals that the buffer was
+        // drained must be taken before anything else is queued, since the applier may not be
+        // draining any more by the time the next batch is formed.
+        _cv.wait(lk, [&] {
+            if (_readyBatches.empty()) {
+                return true;
+            }
+            return !_readyBatches.back().termWhenExhausted() &&
+                _readyBatches.size() < std::size_t(oplogBatcherMaxReadyBatches.load()) &&
+                _readyBatchesBytes + ops.byteSize() <= batchLimits.bytes;
+        });
+        const bool mustShutdown = ops.mustShutdown();
+        _readyBatchesBytes += ops.byteSize();
+        _readyBatches.push_back(std::move(ops));
         _cv.notify_all();
-        if (_ops.mustShutdown()) {
+        if (mustShutdown) {
             return;
         }
     }
@@ -29,6 +29,8 @@
 
 #pragma once
 
+#include <deque>
+
 #include "mongo/db/repl/oplog_buffer.h"
 #include "mongo/db/repl/oplog_entry.h"
 #include "mongo/db/repl/storage_interface.h"
@@ -64,11 +66,20 @@ public:
         return _batch;
     }
 
+    /**
+     * The total size of the raw oplog entries in this batch.
+     */
+    std::size_t byteSize() const {
+        return _byteSize;
+    }
+
     void emplace_back(OplogEntry oplog) {
         invariant(!_mustShutdown);
+        _byteSize += oplog.getRawObjSizeBytes();
         _batch.emplace_back(std::move(oplog));
     }
     void pop_back() {
+        _byteSize -= _batch.back().getRawObjSizeBytes();
         _batch.pop_back();
     }
 
@@ -107,6 +118,7 @@ public:
 
 private:
     std::vector<OplogEntry> _batch;
+    std::size_t _byteSize = 0;
     bool _mustShutdown = false;
     boost::optional<long long> _termWhenExhausted;
 };
@@ -147,7 +159,8 @@ public:
     virtual ~OplogBatcher();
 
     /**
-     * Returns the batch of oplog entries and clears _ops so the batcher can store a new batch.
+     * Returns the oldest batch of oplog entries that is ready for the applier, waiting up to
+     * 'maxWaitTime' for one if there is none. Returns an empty batch on timeout.
      */
     OplogBatch getNextBatch(Seconds maxWaitTime);
 
@@ -204,6 +217,12 @@ private:
      */
     void _consume(OperationContext* opCtx, OplogBuffer* oplogBuffer);
 
+    /**
+     * Returns the OplogEntry for the document peeked at the front of the OplogBuffer, reusing
+     * '_deferredEntry' if it was parsed from the same document.
+     */
+    OplogEntry _parsePeekedEntry(const BSONObj& op);
+
     void _run(StorageInterface* storageInterface);
 
     OplogApplier* _oplogApplier;
@@ -213,11 +232,26 @@ private:
     stdx::condition_variable _cv;
 
     /**
-     * The latest batch of oplog entries ready for the applier.
+     * The batches of oplog entries ready for the applier, oldest first. The batcher keeps forming
+     * batches while the applier applies earlier ones, up to 'oplogBatcherMaxReadyBatches' batches
+     * whose total size fits into a single batch's byte limit. Nothing is queued after a batch
+     * which signals shutdown or that the buffer was drained.
+     */
+    std::deque<OplogBatch> _readyBatches;
+
+    /**
+     * The total byteSize() of '_readyBatches'.
      */
-    OplogBatch _ops;
+    std::size_t _readyBatchesBytes = 0;
 
     std::unique_ptr<stdx::thread> _thread;
+
+    /**
+     * The entry at the front of the OplogBuffer which ended the previous batch without being
+     * consumed, such as a command following CRUD ops. It begins the next batch, which then need
+     * not parse it again. Only accessed by the caller of getNextApplierBatch().
+     */
+    boost::optional<OplogEntry> _deferredEntry;
 };
 
 /**
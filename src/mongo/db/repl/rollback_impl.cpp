@@ -39,6 +39,7 @@
 #include "mongo/db/catalog/collection_catalog.h"
 #include "mongo/db/catalog/database_holder.h"
 #include "mongo/db/catalog/import_collection_oplog_entry_gen.h"
+#include "mongo/db/catalog/truncate_range_oplog_entry_gen.h"
 #include "mongo/db/commands.h"
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/exception_util.h"
@@ -442,7 +443,8 @@ StatusWith<std::set<NamespaceString>> RollbackImpl::_namespacesForOp(const Oplog
             case OplogEntry::CommandType::kStartIndexBuild:
             case OplogEntry::CommandType::kAbortIndexBuild:
             case OplogEntry::CommandType::kCommitIndexBuild:
-            case OplogEntry::CommandType::kCollMod: {
+            case OplogEntry::CommandType::kCollMod:
+            case OplogEntry::CommandType::kTruncateRange: {
                 // For all other command types, we should be able to parse the collection name from
                 // the first command argument.
                 try {
@@ -965,6 +967,12 @@ Status RollbackImpl::_processRollbackOp(OperationContext* opCtx, const OplogEntr
             _countDiffs.erase(oplogEntry.getUuid().get());
             _pendingDrops.erase(oplogEntry.getUuid().get());
             _newCounts.erase(oplogEntry.getUuid().get());
+        } else if (oplogEntry.getCommandType() == OplogEntry::CommandType::kTruncateRange) {
+            // Rolling back a range truncate must increment the count by the number of documents
+            // it removed.
+            auto truncateRangeEntry = TruncateRangeOplogEntry::parse(
+                IDLParserErrorContext("truncateRangeOplogEntry"), oplogEntry.getObject());
+            _countDiffs[oplogEntry.getUuid().get()] += truncateRangeEntry.getDocsDeleted();
         } else if (oplogEntry.getCommandType() == OplogEntry::CommandType::kImportCollection) {
             auto importEntry = mongo::ImportCollectionOplogEntry::parse(
                 IDLParserErrorContext("importCollectionOplogEntry"), oplogEntry.getObject());
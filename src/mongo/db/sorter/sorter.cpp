@@ -56,6 +56,7 @@
 #include "mongo/config.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/service_context.h"
+#include "mongo/db/sorter/sorter_file_io.h"
 #include "mongo/db/storage/encryption_hooks.h"
 #include "mongo/db/storage/storage_options.h"
 #include "mongo/logv2/log.h"
@@ -64,6 +65,7 @@
 #include "mongo/s/is_mongos.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/destructor_guard.h"
+#include "mongo/util/future.h"
 #include "mongo/util/str.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kDefault
@@ -188,6 +190,10 @@ private:
  * Returns results from a sorted range within a file. Each instance is given a file name and start
  * and end offsets.
  *
+ * While the caller consumes one block of the range, the next block is read, decrypted and
+ * decompressed in the background, so that a merge over many ranges does not wait on the disk for
+ * each of them in turn.
+ *
  * This class is NOT responsible for file clean up / deletion. There are openSource() and
  * closeSource() functions to ensure the FileIterator is not holding the file open when the file is
  * deleted. Since it is one among many FileIterators, it cannot close a file that may still be in
@@ -206,14 +212,16 @@ public:
                  std::streamoff fileEndOffset,
                  const Settings& settings,
                  const boost::optional<std::string>& dbName,
-                 const uint32_t checksum)
+                 const uint32_t checksum,
+                 SorterSpillCompressorEnum compressor)
         : _settings(settings),
           _file(std::move(file)),
           _fileStartOffset(fileStartOffset),
           _fileCurrentOffset(fileStartOffset),
           _fileEndOffset(fileEndOffset),
           _dbName(dbName),
-          _originalChecksum(checksum) {}
+          _originalChecksum(checksum),
+          _compressor(compressor) {}
 
     void openSource() {}
 
@@ -265,10 +273,23 @@ public:
     }
 
     SorterRange getRange() const {
-        return {_fileStartOffset, _fileEndOffset, _originalChecksum};
+        SorterRange range{_fileStartOffset, _fileEndOffset, _originalChecksum};
+        if (_compressor != SorterSpillCompressorEnum::kSnappy) {
+            range.setCompressor(_compressor);
+        }
+        return range;
     }
 
 private:
+    /**
+     * A decrypted and decompressed block of the range, along with the offset of the next block.
+     */
+    struct Block {
+        std::unique_ptr<char[]> data;
+        std::size_t size = 0;
+        std::streamoff nextOffset = 0;
+    };
+
     /**
      * Attempts to refill the _bufferReader if it is empty. Expects _done to be false.
      */
@@ -284,73 +305,129 @@ private:
      * read, then _done is set to true and the function returns immediately.
      */
     void _fillBufferFromDisk() {
-        int32_t rawSize;
-        _read(&rawSize, sizeof(rawSize));
-        if (_done)
+        if (_fileCurrentOffset == _fileEndOffset) {
+            _done = true;
+            return;
+        }
+
+        auto readAhead = std::exchange(_readAhead, boost::none);
+        Block block = readAhead ? std::move(*readAhead).get()
+                                : _readBlock(*_file,
+                                             _fileCurrentOffset,
+                                             _fileEndOffset,
+                                             _compressor,
+                                             _dbName);
+
+        _fileCurrentOffset = block.nextOffset;
+        _buffer = std::move(block.data);
+        _bufferReader.reset(new BufReader(_buffer.get(), block.size));
+
+        _scheduleReadAhead();
+    }
+
+    /**
+     * Starts reading the block at _fileCurrentOffset in the background, if there is one and
+     * read-ahead is enabled.
+     */
+    void _scheduleReadAhead() {
+        if (_fileCurrentOffset == _fileEndOffset) {
             return;
+        }
+
+        auto pf = makePromiseFuture<Block>();
+        // The task shares ownership of the file, so it is safe for this iterator to be destroyed
+        // before the read completes.
+        bool scheduled = sorter::scheduleReadAhead([promise = std::move(pf.promise),
+                                                    file = _file,
+                                                    offset = _fileCurrentOffset,
+                                                    endOffset = _fileEndOffset,
+                                                    compressor = _compressor,
+                                                    dbName = _dbName]() mutable {
+            promise.setWith(
+                [&] { return _readBlock(*file, offset, endOffset, compressor, dbName); });
+        });
+        if (scheduled) {
+            _readAhead.emplace(std::move(pf.future));
+        }
+    }
+
+    /**
+     * Reads the block that starts at 'offset' and returns its decrypted and decompressed contents.
+     * May run on a read-ahead thread, so it must not touch any state of the iterator.
+     */
+    static Block _readBlock(typename Sorter<Key, Value>::File& file,
+                            std::streamoff offset,
+                            std::streamoff endOffset,
+                            SorterSpillCompressorEnum compressor,
+                            const boost::optional<std::string>& dbName) {
+        invariant(offset < endOffset,
+                  str::stream() << "Current file offset (" << offset
+                                << ") greater than end offset (" << endOffset << ")");
+
+        int32_t rawSize;
+        file.read(offset, sizeof(rawSize), &rawSize);
+        offset += sizeof(rawSize);
+        uassert(16816, "file too short?", offset < endOffset);
 
         // negative size means compressed
         const bool compressed = rawSize < 0;
         int32_t blockSize = std::abs(rawSize);
 
-        _buffer.reset(new char[blockSize]);
-        _read(_buffer.get(), blockSize);
-        uassert(16816, "file too short?", !_done);
+        Block block;
+        block.data.reset(new char[blockSize]);
+        file.read(offset, blockSize, block.data.get());
+        block.nextOffset = offset + blockSize;
 
         if (auto encryptionHooks = getEncryptionHooksIfEnabled()) {
             std::unique_ptr<char[]> out(new char[blockSize]);
             size_t outLen;
-            Status status =
-                encryptionHooks->unprotectTmpData(reinterpret_cast<const uint8_t*>(_buffer.get()),
-                                                  blockSize,
-                                                  reinterpret_cast<uint8_t*>(out.get()),
-                                                  blockSize,
-                                                  &outLen,
-                                                  _dbName);
+            Status status = encryptionHooks->unprotectTmpData(
+                reinterpret_cast<const uint8_t*>(block.data.get()),
+                blockSize,
+                reinterpret_cast<uint8_t*>(out.get()),
+                blockSize,
+                &outLen,
+                dbName);
             uassert(28841,
                     str::stream() << "Failed to unprotect data: " << status.toString(),
                     status.isOK());
             blockSize = outLen;
-            _buffer.swap(out);
+            block.data.swap(out);
         }
 
         if (!compressed) {
-            _bufferReader.reset(new BufReader(_buffer.get(), blockSize));
-            return;
+            block.size = blockSize;
+            return block;
         }
 
-        dassert(snappy::IsValidCompressedBuffer(_buffer.get(), blockSize));
-
-        size_t uncompressedSize;
-        uassert(17061,
-                "couldn't get uncompressed length",
-                snappy::GetUncompressedLength(_buffer.get(), blockSize, &uncompressedSize));
-
-        std::unique_ptr<char[]> decompressionBuffer(new char[uncompressedSize]);
-        uassert(17062,
-                "decompression failed",
-                snappy::RawUncompress(_buffer.get(), blockSize, decompressionBuffer.get()));
-
-        // hold on to decompressed data and throw out compressed data at block exit
-        _buffer.swap(decompressionBuffer);
-        _bufferReader.reset(new BufReader(_buffer.get(), uncompressedSize));
-    }
-
-    /**
-     * Attempts to read data from disk. Sets _done to true when file offset reaches _fileEndOffset.
-     */
-    void _read(void* out, size_t size) {
-        if (_fileCurrentOffset == _fileEndOffset) {
-            _done = true;
-            return;
+        std::unique_ptr<char[]> decompressionBuffer;
+        switch (compressor) {
+            case SorterSpillCompressorEnum::kSnappy: {
+                dassert(snappy::IsValidCompressedBuffer(block.data.get(), blockSize));
+
+                size_t uncompressedSize;
+                uassert(17061,
+                        "couldn't get uncompressed length",
+                        snappy::GetUncompressedLength(
+                            block.data.get(), blockSize, &uncompressedSize));
+
+                decompressionBuffer.reset(new char[uncompressedSize]);
+                uassert(17062,
+                        "decompression failed",
+                        snappy::RawUncompress(
+                            block.data.get(), blockSize, decompressionBuffer.get()));
+                block.size = uncompressedSize;
+                break;
+            }
+            case SorterSpillCompressorEnum::kZstd:
+                block.size =
+                    sorter::zstdUncompress(block.data.get(), blockSize, &decompressionBuffer);
+                break;
         }
 
-        invariant(_fileCurrentOffset < _fileEndOffset,
-                  str::stream() << "Current file offset (" << _fileCurrentOffset
-                                << ") greater than end offset (" << _fileEndOffset << ")");
-
-        _file->read(_fileCurrentOffset, size, out);
-        _fileCurrentOffset += size;
+        // hold on to decompressed data and throw out compressed data at block exit
+        block.data.swap(decompressionBuffer);
+        return block;
     }
 
     const Settings _settings;
@@ -374,6 +451,12 @@ private:
     // to disk. This is not modified, and is only used for comparison against _afterReadChecksum
     // when the FileIterator is exhausted to ensure no data corruption.
     const uint32_t _originalChecksum;
+
+    // The algorithm with which the blocks of this range were compressed.
+    const SorterSpillCompressorEnum _compressor;
+
+    // The block after the one in _bufferReader, if it is being read in the background.
+    boost::optional<Future<Block>> _readAhead;
 };
 
 /**
@@ -563,6 +646,7 @@ public:
                       typename Value::SorterDeserializeSettings>
         Settings;
     typedef SortIteratorInterface<Key, Value> Iterator;
+    typedef typename Sorter<Key, Value>::File File;
 
     MergeableSorter(const SortOptions& opts, const Comparator& comp, const Settings& settings)
         : Sorter<Key, Value>(opts), _comp(comp), _settings(settings) {}
@@ -580,7 +664,10 @@ protected:
      * reduce the spills to that number if necessary by merging them iteratively.
      */
     void _mergeSpillsToRespectMemoryLimits() {
-        auto numTargetedSpills = std::max(this->_opts.maxMemoryUsageBytes / kSortedFileBufferSize,
+        // Each spill being merged holds a block in memory, and a second one while the next block
+        // is read ahead.
+        auto bytesPerSpill = kSortedFileBufferSize * (sorter::isReadAheadEnabled() ? 2 : 1);
+        auto numTargetedSpills = std::max(this->_opts.maxMemoryUsageBytes / bytesPerSpill,
                                           static_cast<std::size_t>(2));
         if (this->_iters.size() > numTargetedSpills) {
             this->_mergeSpills(numTargetedSpills);
@@ -600,11 +687,15 @@ protected:
      * {12, 3, 4, 5}
      * {12, 34, 5}
      * {1234, 5}
+     *
+     * The batches of one round are independent of each other, so they may be merged on several
+     * threads at once. Each thread writes to a file of its own and merges proportionally fewer
+     * spills at a time, so that together the threads stay within the memory limit. The ranges
+     * written by the last round are then gathered into a single file, since a sorter persists only
+     * one file when it shuts down.
      */
     void _mergeSpills(std::size_t numTargetedSpills) {
-        using File = typename Sorter<Key, Value>::File;
-
-        std::shared_ptr<File> file = std::move(this->_file);
+        std::vector<std::shared_ptr<File>> files{std::move(this->_file)};
         std::vector<std::shared_ptr<Iterator>> iterators = std::move(this->_iters);
 
         LOGV2_INFO(6033104,
@@ -614,40 +705,79 @@ protected:
                    "maxNumSpills"_attr = numTargetedSpills);
 
         while (iterators.size() > numTargetedSpills) {
-            std::shared_ptr<File> newSpillsFile = std::make_shared<File>(
-                this->_opts.tempDir + "/" + nextFileName(), this->_opts.sorterFileStats);
+            // Each thread merges at least two spills at a time.
+            auto numThreads =
+                std::min({sorter::getMaxParallelMergeThreads(),
+                          (iterators.size() + numTargetedSpills - 1) / numTargetedSpills,
+                          numTargetedSpills / 2});
+            auto spillsPerMerge = numTargetedSpills / numThreads;
+            auto numMerges = (iterators.size() + spillsPerMerge - 1) / spillsPerMerge;
+
+            std::vector<std::shared_ptr<File>> newSpillsFiles;
+            for (std::size_t t = 0; t < numThreads; ++t) {
+                newSpillsFiles.push_back(std::make_shared<File>(
+                    this->_opts.tempDir + "/" + nextFileName(), this->_opts.sorterFileStats));
+
+                LOGV2_DEBUG(6033103,
+                            1,
+                            "Created new intermediate file for merged spills",
+                            "path"_attr = newSpillsFiles.back()->path().string());
+            }
 
-            LOGV2_DEBUG(6033103,
-                        1,
-                        "Created new intermediate file for merged spills",
-                        "path"_attr = newSpillsFile->path().string());
-
-            std::vector<std::shared_ptr<Iterator>> mergedIterators;
-            for (std::size_t i = 0; i < iterators.size(); i += numTargetedSpills) {
-                std::vector<std::shared_ptr<Iterator>> spillsToMerge;
-                auto endIndex = std::min(i + numTargetedSpills, iterators.size());
-                std::move(iterators.begin() + i,
-                          iterators.begin() + endIndex,
-                          std::back_inserter(spillsToMerge));
-
-                LOGV2_DEBUG(6033102,
-                            2,
-                            "Merging spills",
-                            "beginIdx"_attr = i,
-                            "endIdx"_attr = endIndex - 1);
-
-                auto mergeIterator =
-                    std::unique_ptr<Iterator>(Iterator::merge(spillsToMerge, this->_opts, _comp));
-                mergeIterator->openSource();
-                SortedFileWriter<Key, Value> writer(this->_opts, newSpillsFile, _settings);
-                while (mergeIterator->more()) {
-                    auto pair = mergeIterator->next();
-                    writer.addAlreadySorted(pair.first, pair.second);
+            // Thread 't' performs every numThreads'th merge, starting with merge 't'.
+            std::vector<std::shared_ptr<Iterator>> mergedIterators(numMerges);
+            auto mergeOnThread = [&](std::size_t t) {
+                for (std::size_t m = t; m < numMerges; m += numThreads) {
+                    auto i = m * spillsPerMerge;
+                    std::vector<std::shared_ptr<Iterator>> spillsToMerge;
+                    auto endIndex = std::min(i + spillsPerMerge, iterators.size());
+                    std::move(iterators.begin() + i,
+                              iterators.begin() + endIndex,
+                              std::back_inserter(spillsToMerge));
+
+                    LOGV2_DEBUG(6033102,
+                                2,
+                                "Merging spills",
+                                "beginIdx"_attr = i,
+                                "endIdx"_attr = endIndex - 1);
+
+                    auto mergeIterator = std::unique_ptr<Iterator>(
+                        Iterator::merge(spillsToMerge, this->_opts, _comp));
+                    mergeIterator->openSource();
+                    SortedFileWriter<Key, Value> writer(this->_opts, newSpillsFiles[t], _settings);
+                    while (mergeIterator->more()) {
+                        auto pair = mergeIterator->next();
+                        writer.addAlreadySorted(pair.first, pair.second);
+                    }
+                    mergedIterators[m] = std::shared_ptr<Iterator>(writer.done());
+                    mergeIterator->closeSource();
                 }
-                auto iteratorPtr = std::shared_ptr<Iterator>(writer.done());
-                mergeIterator->closeSource();
-                mergedIterators.push_back(std::move(iteratorPtr));
-                this->_numSpills++;
+            };
+
+            std::vector<Status> statuses(numThreads, Status::OK());
+            auto runMerges = [&](std::size_t t) {
+                try {
+                    mergeOnThread(t);
+                } catch (...) {
+                    statuses[t] = exceptionToStatus();
+                }
+            };
+
+            std::vector<SemiFuture<void>> merges;
+            for (std::size_t t = 1; t < numThreads; ++t) {
+                merges.push_back(sorter::scheduleMerge([&runMerges, t] { runMerges(t); }));
+            }
+            runMerges(0);
+            for (auto& merge : merges) {
+                merge.wait();
+            }
+            for (const auto& status : statuses) {
+                uassertStatusOK(status);
+            }
+            this->_numSpills += numMerges;
+
+            if (numThreads > 1 && numMerges <= numTargetedSpills) {
+                _moveRangesToFirstFile(newSpillsFiles, mergedIterators);
             }
 
             LOGV2_DEBUG(6033101,
@@ -657,14 +787,53 @@ protected:
                         "targetSpills"_attr = numTargetedSpills);
 
             iterators = std::move(mergedIterators);
-            file = std::move(newSpillsFile);
+            files = std::move(newSpillsFiles);
         }
-        this->_file = std::move(file);
+
+        this->_file = std::move(files.front());
         this->_iters = std::move(iterators);
 
         LOGV2_INFO(6033100, "Finished merging spills");
     }
 
+    /**
+     * Copies the ranges of 'iterators' which a round of parallel merges wrote to the files of the
+     * threads other than the first to the end of the first file, and replaces those iterators with
+     * ones over the copies. Only the first file is left in 'files'. Merge 'm' of the round was
+     * written to the file of thread m % files.size().
+     */
+    void _moveRangesToFirstFile(std::vector<std::shared_ptr<File>>& files,
+                                std::vector<std::shared_ptr<Iterator>>& iterators) {
+        const auto& destination = files.front();
+        std::vector<char> buffer(kSortedFileBufferSize);
+        for (std::size_t m = 0; m < iterators.size(); ++m) {
+            const auto& source = files[m % files.size()];
+            if (source == destination) {
+                continue;
+            }
+
+            // The blocks of a range do not depend on where the range starts in its file, so the
+            // range is copied as is and keeps its checksum.
+            auto range = iterators[m]->getRange();
+            auto startOffset = destination->currentOffset();
+            for (std::streamoff offset = range.getStartOffset(); offset < range.getEndOffset();) {
+                auto size = std::min<std::streamoff>(buffer.size(), range.getEndOffset() - offset);
+                source->read(offset, size, buffer.data());
+                destination->write(buffer.data(), size);
+                offset += size;
+            }
+            iterators[m] = std::make_shared<sorter::FileIterator<Key, Value>>(
+                destination,
+                startOffset,
+                destination->currentOffset(),
+                _settings,
+                this->_opts.dbName,
+                range.getChecksum(),
+                range.getCompressor().value_or(SorterSpillCompressorEnum::kSnappy));
+        }
+        files.resize(1);
+    }
+
     const Comparator _comp;
     const Settings _settings;
 };
@@ -706,7 +875,9 @@ public:
                                range.getEndOffset(),
                                this->_settings,
                                this->_opts.dbName,
-                               range.getChecksum());
+                               range.getChecksum(),
+                               range.getCompressor().value_or(
+                                   SorterSpillCompressorEnum::kSnappy));
                        });
         this->_numSpills = this->_iters.size();
     }
@@ -1137,6 +1308,9 @@ typename Sorter<Key, Value>::PersistedState Sorter<Key, Value>::persistDataForSh
 
 template <typename Key, typename Value>
 Sorter<Key, Value>::File::~File() {
+    // Closes the read handle first, since on some platforms an open file cannot be removed.
+    _reader.reset();
+
     if (_stats && _file.is_open()) {
         _stats->closed.addAndFetch(1);
     }
@@ -1155,42 +1329,39 @@ Sorter<Key, Value>::File::~File() {
 
 template <typename Key, typename Value>
 void Sorter<Key, Value>::File::read(std::streamoff offset, std::streamsize size, void* out) {
-    if (!_file.is_open()) {
-        _open();
-    }
-
-    // If the _offset is not -1, we may have written data to it, so we must flush.
-    if (_offset != -1) {
-        _file.exceptions(std::ios::goodbit);
-        _file.flush();
-        _offset = -1;
-
-        uassert(5479100,
-                str::stream() << "Error flushing file " << _path.string() << ": "
-                              << sorter::myErrnoWithDescription(),
-                _file);
-    }
+    sorter::SpillFileReader* reader;
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        if (!_file.is_open()) {
+            _open();
+        }
 
-    _file.seekg(offset);
-    _file.read(reinterpret_cast<char*>(out), size);
+        // If the _offset is not -1, we may have written data to it, so we must flush.
+        if (_offset != -1) {
+            _file.exceptions(std::ios::goodbit);
+            _file.flush();
+            _offset = -1;
 
-    uassert(16817,
-            str::stream() << "Error reading file " << _path.string() << ": "
-                          << sorter::myErrnoWithDescription(),
-            _file);
+            uassert(5479100,
+                    str::stream() << "Error flushing file " << _path.string() << ": "
+                                  << sorter::myErrnoWithDescription(),
+                    _file);
+        }
 
-    invariant(_file.gcount() == size,
-              str::stream() << "Number of bytes read (" << _file.gcount()
-                            << ") not equal to expected number (" << size << ")");
+        if (!_reader) {
+            _reader = std::make_unique<sorter::SpillFileReader>(_path.string());
+        }
+        reader = _reader.get();
+    }
 
-    uassert(51049,
-            str::stream() << "Error reading file " << _path.string() << ": "
-                          << sorter::myErrnoWithDescription(),
-            _file.tellg() >= 0);
+    // The read does not depend on a shared file position, so it does not hold _mutex and other
+    // threads may read ahead in the same file meanwhile.
+    reader->read(offset, size, out);
 }
 
 template <typename Key, typename Value>
 void Sorter<Key, Value>::File::write(const char* data, std::streamsize size) {
+    stdx::lock_guard<Latch> lk(_mutex);
     _ensureOpenForWriting();
 
     try {
@@ -1213,6 +1384,7 @@ void Sorter<Key, Value>::File::write(const char* data, std::streamsize size) {
 
 template <typename Key, typename Value>
 std::streamoff Sorter<Key, Value>::File::currentOffset() {
+    stdx::lock_guard<Latch> lk(_mutex);
     _ensureOpenForWriting();
     invariant(_offset >= 0);
     return _offset;
@@ -1264,6 +1436,7 @@ SortedFileWriter<Key, Value>::SortedFileWriter(
     const Settings& settings)
     : _settings(settings),
       _file(std::move(file)),
+      _compressor(sorter::getSpillCompressor()),
       _fileStartOffset(_file->currentOffset()),
       _dbName(opts.dbName) {
     // This should be checked by consumers, but if we get here don't allow writes.
@@ -1303,7 +1476,14 @@ void SortedFileWriter<Key, Value>::spill() {
         return;
 
     std::string compressed;
-    snappy::Compress(outBuffer, size, &compressed);
+    switch (_compressor) {
+        case SorterSpillCompressorEnum::kSnappy:
+            snappy::Compress(outBuffer, size, &compressed);
+            break;
+        case SorterSpillCompressorEnum::kZstd:
+            sorter::zstdCompress(outBuffer, size, &compressed);
+            break;
+    }
     verify(compressed.size() <= size_t(std::numeric_limits<int32_t>::max()));
 
     const bool shouldCompress = compressed.size() < size_t(_buffer.len() / 10 * 9);
@@ -1342,8 +1522,13 @@ template <typename Key, typename Value>
 SortIteratorInterface<Key, Value>* SortedFileWriter<Key, Value>::done() {
     spill();
 
-    return new sorter::FileIterator<Key, Value>(
-        _file, _fileStartOffset, _file->currentOffset(), _settings, _dbName, _checksum);
+    return new sorter::FileIterator<Key, Value>(_file,
+                                                _fileStartOffset,
+                                                _file->currentOffset(),
+                                                _settings,
+                                                _dbName,
+                                                _checksum,
+                                                _compressor);
 }
 
 template <typename Key, typename Value, typename Comparator, typename BoundMaker>
@@ -44,6 +44,7 @@
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/sorter/sorter_gen.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/bufreader.h"
 
@@ -95,6 +96,10 @@
 
 namespace mongo {
 
+namespace sorter {
+class SpillFileReader;
+}  // namespace sorter
+
 /**
  * For collecting file usage metrics.
  */
@@ -275,7 +280,8 @@ public:
 
     /**
      * Represents the file that a Sorter uses to spill to disk. Supports reading and writing
-     * (append-only).
+     * (append-only). Reads and writes may come from several threads, since ranges of the file are
+     * read ahead and merged in the background.
      */
     class File {
     public:
@@ -299,7 +305,7 @@ public:
 
         /**
          * Reads the requested data from the file. Cannot write more to the file once this has been
-         * called.
+         * called. Reads of several threads proceed in parallel.
          */
         void read(std::streamoff offset, std::streamsize size, void* out);
 
@@ -322,8 +328,15 @@ public:
         void _ensureOpenForWriting();
 
         boost::filesystem::path _path;
+
+        // Serializes access to _file, _offset and the creation of _reader.
+        Mutex _mutex = MONGO_MAKE_LATCH("Sorter::File::_mutex");
         std::fstream _file;
 
+        // Reads the file at given offsets without holding _mutex. Set on the first read, and never
+        // reset until this object is destructed.
+        std::unique_ptr<sorter::SpillFileReader> _reader;
+
         // The current offset of the end of the file if there may be unflushed data, or -1 if the
         // file either has not yet been opened or has been flushed.
         std::streamoff _offset = -1;
@@ -606,6 +619,9 @@ private:
     std::shared_ptr<typename Sorter<Key, Value>::File> _file;
     BufBuilder _buffer;
 
+    // The algorithm with which spilled blocks are compressed, fixed for the whole data range.
+    const SorterSpillCompressorEnum _compressor;
+
     // Keeps track of the hash of all data objects spilled to disk. Passed to the FileIterator
     // to ensure data has not been corrupted after reading from disk.
     uint32_t _checksum = 0;
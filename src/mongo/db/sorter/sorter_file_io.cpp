@@ -0,0 +1,286 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/sorter/sorter_file_io.h"
+
+#include <algorithm>
+#include <zstd.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "mongo/db/client.h"
+#include "mongo/db/server_options.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/sorter/sorter_parameters_gen.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_pool.h"
+#include "mongo/util/errno_util.h"
+#include "mongo/util/str.h"
+#include "mongo/util/text.h"
+
+namespace mongo::sorter {
+namespace {
+
+// Spilled data is written and read back once, so favor compression speed over ratio.
+constexpr int kZstdCompressionLevel = 1;
+
+// The upper bound of the sorterMaxParallelMergeThreads parameter.
+constexpr std::size_t kMaxParallelMergeThreads = 64;
+
+/**
+ * A pool of threads shared by every Sorter in the process, started on first use and shut down with
+ * the ServiceContext.
+ */
+struct SorterThreadPool {
+    Mutex mutex = MONGO_MAKE_LATCH("SorterThreadPool::mutex");
+    std::unique_ptr<ThreadPool> pool;
+};
+
+// The threads that read spilled blocks ahead of a merge.
+const auto getReadAheadPool = ServiceContext::declareDecoration<SorterThreadPool>();
+
+// The threads that merge spills in parallel.
+const auto getMergePool = ServiceContext::declareDecoration<SorterThreadPool>();
+
+ThreadPool* getOrStartPool(SorterThreadPool& sorterPool,
+                           const std::string& name,
+                           std::size_t maxThreads) {
+    stdx::lock_guard<Latch> lk(sorterPool.mutex);
+    if (!sorterPool.pool) {
+        ThreadPool::Options options;
+        options.poolName = name;
+        options.threadNamePrefix = name + "-";
+        options.minThreads = 0;
+        options.maxThreads = maxThreads;
+        options.onCreateThread = [](const std::string& threadName) {
+            Client::initThread(threadName);
+        };
+        sorterPool.pool = std::make_unique<ThreadPool>(options);
+        sorterPool.pool->startup();
+    }
+    return sorterPool.pool.get();
+}
+
+void shutDownPool(SorterThreadPool& sorterPool) {
+    ThreadPool* pool;
+    {
+        stdx::lock_guard<Latch> lk(sorterPool.mutex);
+        pool = sorterPool.pool.get();
+    }
+    // The pool is kept after it shuts down, so that later tasks run inline rather than on a new
+    // pool.
+    if (pool) {
+        pool->shutdown();
+        pool->join();
+    }
+}
+
+// The threads of the pools have Clients, which must be gone before the ServiceContext is destroyed.
+ServiceContext::ConstructorActionRegisterer sorterThreadPoolsRegisterer{
+    "SorterThreadPools",
+    [](ServiceContext*) {},
+    [](ServiceContext* service) {
+        shutDownPool(getReadAheadPool(service));
+        shutDownPool(getMergePool(service));
+    }};
+
+}  // namespace
+
+Status validateSpillCompressor(const std::string& value) {
+    try {
+        SorterSpillCompressor_parse(IDLParserErrorContext("sorterSpillCompressor"), value);
+    } catch (const DBException& ex) {
+        return ex.toStatus();
+    }
+    return Status::OK();
+}
+
+SorterSpillCompressorEnum getSpillCompressor() {
+    auto compressor = SorterSpillCompressor_parse(IDLParserErrorContext("sorterSpillCompressor"),
+                                                  gSorterSpillCompressor.get());
+    // A binary that does not know zstd spills cannot resume an index build whose ranges use it.
+    if (compressor == SorterSpillCompressorEnum::kZstd &&
+        !(serverGlobalParams.featureCompatibility.isVersionInitialized() &&
+          feature_flags::gSorterZstdSpills.isEnabled(serverGlobalParams.featureCompatibility))) {
+        return SorterSpillCompressorEnum::kSnappy;
+    }
+    return compressor;
+}
+
+void zstdCompress(const char* data, std::size_t size, std::string* out) {
+    out->resize(ZSTD_compressBound(size));
+    size_t compressedSize =
+        ZSTD_compress(out->data(), out->size(), data, size, kZstdCompressionLevel);
+    uassert(7086781,
+            str::stream() << "Failed to compress spilled data: "
+                          << ZSTD_getErrorName(compressedSize),
+            !ZSTD_isError(compressedSize));
+    out->resize(compressedSize);
+}
+
+std::size_t zstdUncompress(const char* data, std::size_t size, std::unique_ptr<char[]>* out) {
+    auto uncompressedSize = ZSTD_getFrameContentSize(data, size);
+    uassert(7086782,
+            "couldn't get uncompressed length",
+            uncompressedSize != ZSTD_CONTENTSIZE_ERROR &&
+                uncompressedSize != ZSTD_CONTENTSIZE_UNKNOWN);
+
+    out->reset(new char[uncompressedSize]);
+    size_t ret = ZSTD_decompress(out->get(), uncompressedSize, data, size);
+    uassert(7086783,
+            str::stream() << "decompression failed: " << ZSTD_getErrorName(ret),
+            !ZSTD_isError(ret) && ret == uncompressedSize);
+    return ret;
+}
+
+bool isReadAheadEnabled() {
+    return gSorterReadAheadMaxThreads > 0 && hasGlobalServiceContext();
+}
+
+bool scheduleReadAhead(unique_function<void()> task) {
+    if (!isReadAheadEnabled()) {
+        return false;
+    }
+
+    auto pool = getOrStartPool(getReadAheadPool(getGlobalServiceContext()),
+                               "SorterReadAhead",
+                               static_cast<std::size_t>(gSorterReadAheadMaxThreads));
+
+    // Once the pool has shut down, it runs tasks inline with an error status. The task still has
+    // to run then, since the caller waits for the block it reads.
+    pool->schedule([task = std::move(task)](Status) mutable { task(); });
+    return true;
+}
+
+std::size_t getMaxParallelMergeThreads() {
+    if (!hasGlobalServiceContext()) {
+        return 1;
+    }
+    return static_cast<std::size_t>(gSorterMaxParallelMergeThreads.load());
+}
+
+SemiFuture<void> scheduleMerge(unique_function<void()> task) {
+    // The merging thread performs one of the merges itself.
+    auto pool = getOrStartPool(
+        getMergePool(getGlobalServiceContext()), "SorterMerge", kMaxParallelMergeThreads - 1);
+
+    auto pf = makePromiseFuture<void>();
+    // As with read-ahead, the task runs inline once the pool has shut down.
+    pool->schedule([task = std::move(task), promise = std::move(pf.promise)](Status) mutable {
+        promise.setWith(std::move(task));
+    });
+    return std::move(pf.future).semi();
+}
+
+#ifdef _WIN32
+
+SpillFileReader::SpillFileReader(std::string path) : _path(std::move(path)) {
+    _handle = CreateFileW(toWideString(_path.c_str()).c_str(),
+                          GENERIC_READ,
+                          FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                          nullptr,
+                          OPEN_EXISTING,
+                          FILE_ATTRIBUTE_NORMAL,
+                          nullptr);
+    uassert(7086800,
+            str::stream() << "Error opening file " << _path << ": "
+                          << errorMessage(lastSystemError()),
+            _handle != INVALID_HANDLE_VALUE);
+}
+
+SpillFileReader::~SpillFileReader() {
+    CloseHandle(_handle);
+}
+
+void SpillFileReader::read(std::int64_t offset, std::size_t size, void* out) const {
+    auto data = static_cast<char*>(out);
+    while (size > 0) {
+        // A read with an explicit offset does not use the file position of the handle.
+        OVERLAPPED overlapped{};
+        overlapped.Offset = static_cast<DWORD>(offset);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        DWORD bytesRead;
+        auto toRead = static_cast<DWORD>(std::min<std::size_t>(size, 1 << 30));
+        uassert(7086801,
+                str::stream() << "Error reading file " << _path << ": "
+                              << errorMessage(lastSystemError()),
+                ReadFile(_handle, data, toRead, &bytesRead, &overlapped));
+        uassert(7086802,
+                str::stream() << "Unexpected end of file " << _path << " at offset " << offset,
+                bytesRead > 0);
+        data += bytesRead;
+        offset += bytesRead;
+        size -= bytesRead;
+    }
+}
+
+#else
+
+SpillFileReader::SpillFileReader(std::string path) : _path(std::move(path)) {
+    _fd = ::open(_path.c_str(), O_RDONLY);
+    uassert(7086804,
+            str::stream() << "Error opening file " << _path << ": "
+                          << errorMessage(lastSystemError()),
+            _fd >= 0);
+}
+
+SpillFileReader::~SpillFileReader() {
+    ::close(_fd);
+}
+
+void SpillFileReader::read(std::int64_t offset, std::size_t size, void* out) const {
+    auto data = static_cast<char*>(out);
+    while (size > 0) {
+        ssize_t bytesRead = ::pread(_fd, data, size, offset);
+        if (bytesRead < 0 && errno == EINTR) {
+            continue;
+        }
+        uassert(7086805,
+                str::stream() << "Error reading file " << _path << ": "
+                              << errorMessage(lastSystemError()),
+                bytesRead >= 0);
+        uassert(7086806,
+                str::stream() << "Unexpected end of file " << _path << " at offset " << offset,
+                bytesRead > 0);
+        data += bytesRead;
+        offset += bytesRead;
+        size -= bytesRead;
+    }
+}
+
+#endif
+
+}  // namespace mongo::sorter
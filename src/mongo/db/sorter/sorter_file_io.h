@@ -0,0 +1,128 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/base/status.h"
+#include "mongo/db/sorter/sorter_gen.h"
+#include "mongo/util/functional.h"
+#include "mongo/util/future.h"
+
+/**
+ * Support for the Sorter's spill files that does not depend on the Sorter's template parameters,
+ * and so lives in its own translation unit rather than in sorter.cpp.
+ */
+namespace mongo::sorter {
+
+/**
+ * Validates a new value for the sorterSpillCompressor server parameter.
+ */
+Status validateSpillCompressor(const std::string& value);
+
+/**
+ * Returns the algorithm with which newly spilled data should be compressed. This is snappy until
+ * the feature compatibility version allows zstd, whatever the sorterSpillCompressor parameter says,
+ * since the compressor of each range is persisted in the resumable state of index builds.
+ */
+SorterSpillCompressorEnum getSpillCompressor();
+
+/**
+ * Compresses the 'size' bytes at 'data' with zstd into 'out'.
+ */
+void zstdCompress(const char* data, std::size_t size, std::string* out);
+
+/**
+ * Decompresses a block produced by zstdCompress(), returning a new buffer in 'out' and its size.
+ * Throws if the block is corrupt.
+ */
+std::size_t zstdUncompress(const char* data, std::size_t size, std::unique_ptr<char[]>* out);
+
+/**
+ * Returns whether FileIterators read blocks ahead of a merge.
+ */
+bool isReadAheadEnabled();
+
+/**
+ * Runs 'task' on the pool of threads that read spilled blocks ahead of a merge. Returns false
+ * without running 'task' if read-ahead is disabled or there is no global ServiceContext, in which
+ * case the caller should read the block itself.
+ */
+bool scheduleReadAhead(unique_function<void()> task);
+
+/**
+ * Returns the maximum number of threads that may merge spills in parallel, which is one if there is
+ * no global ServiceContext.
+ */
+std::size_t getMaxParallelMergeThreads();
+
+/**
+ * Runs 'task' on the pool of threads that merge spills in parallel. The returned future becomes
+ * ready once 'task' has run, with the error it threw if any. Requires a global ServiceContext.
+ */
+SemiFuture<void> scheduleMerge(unique_function<void()> task);
+
+/**
+ * Reads a spill file at given offsets without moving a shared file position, so that several
+ * threads may read from the same file at once.
+ */
+class SpillFileReader {
+public:
+    /**
+     * Opens the existing file at 'path' for reading. Throws if it cannot be opened.
+     */
+    explicit SpillFileReader(std::string path);
+    ~SpillFileReader();
+
+    SpillFileReader(const SpillFileReader&) = delete;
+    SpillFileReader& operator=(const SpillFileReader&) = delete;
+
+    /**
+     * Reads exactly 'size' bytes starting at 'offset' into 'out'. Throws on error or if the file
+     * ends first.
+     */
+    void read(std::int64_t offset, std::size_t size, void* out) const;
+
+private:
+    const std::string _path;
+#ifdef _WIN32
+    HANDLE _handle;
+#else
+    int _fd;
+#endif
+};
+
+}  // namespace mongo::sorter
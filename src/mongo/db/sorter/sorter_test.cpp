@@ -34,17 +34,22 @@
 #include <boost/filesystem.hpp>
 #include <fstream>
 #include <memory>
+#include <numeric>
 
 #include "mongo/base/data_type_endian.h"
 #include "mongo/base/static_assert.h"
 #include "mongo/config.h"
+#include "mongo/db/server_options.h"
+#include "mongo/db/service_context_test_fixture.h"
 #include "mongo/db/sorter/sorter.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/logv2/log.h"
 #include "mongo/platform/random.h"
 #include "mongo/stdx/thread.h"
 #include "mongo/unittest/death_test.h"
 #include "mongo/unittest/temp_dir.h"
 #include "mongo/unittest/unittest.h"
+#include "mongo/util/scopeguard.h"
 
 
 namespace mongo {
@@ -982,6 +987,127 @@ TEST_F(SorterMakeFromExistingRangesTest, RoundTrip) {
     }
 }
 
+/**
+ * Installs a global ServiceContext, which the Sorter needs in order to read spilled blocks ahead on
+ * background threads.
+ */
+class SorterSpillTest : public ServiceContextTest {};
+
+TEST_F(SorterSpillTest, ZstdRangesRoundTripThroughPersistedState) {
+    unittest::TempDir tempDir(_agent.getSuiteName() + "_" + _agent.getTestName());
+    auto opts = SortOptions().ExtSortAllowed().TempDir(tempDir.path()).MaxMemoryUsageBytes(1024);
+
+    const int numItems = 10 * 1000;
+    IWSorter::PersistedState state;
+    {
+        RAIIServerParameterControllerForTest compressor("sorterSpillCompressor", "zstd");
+        auto sorter = std::unique_ptr<IWSorter>(IWSorter::make(opts, IWComparator(ASC)));
+        for (int i = numItems - 1; i >= 0; --i) {
+            sorter->add(i, -i);
+        }
+        state = sorter->persistDataForShutdown();
+    }
+    ASSERT_GT(state.ranges.size(), 1U);
+    for (const auto& range : state.ranges) {
+        ASSERT(range.getCompressor() == SorterSpillCompressorEnum::kZstd);
+    }
+
+    // The ranges are read back with the compressor they were written with, whatever the current
+    // setting of the parameter.
+    auto sorter = std::unique_ptr<IWSorter>(
+        IWSorter::makeFromExistingRanges(state.fileName, state.ranges, opts, IWComparator(ASC)));
+    ASSERT_ITERATORS_EQUIVALENT(std::shared_ptr<IWIterator>(sorter->done()),
+                                std::make_shared<IntIterator>(0, numItems));
+}
+
+TEST_F(SorterSpillTest, SpillsWithSnappyUntilFCVAllowsZstd) {
+    RAIIServerParameterControllerForTest compressor("sorterSpillCompressor", "zstd");
+    serverGlobalParams.mutableFeatureCompatibility.setVersion(multiversion::GenericFCV::kLastLTS);
+    ON_BLOCK_EXIT([] {
+        serverGlobalParams.mutableFeatureCompatibility.setVersion(
+            multiversion::GenericFCV::kLatest);
+    });
+
+    unittest::TempDir tempDir(_agent.getSuiteName() + "_" + _agent.getTestName());
+    auto opts = SortOptions().ExtSortAllowed().TempDir(tempDir.path()).MaxMemoryUsageBytes(1024);
+    auto sorter = std::unique_ptr<IWSorter>(IWSorter::make(opts, IWComparator(ASC)));
+    for (int i = 0; i < 1000; ++i) {
+        sorter->add(i, -i);
+    }
+    auto state = sorter->persistDataForShutdown();
+    ASSERT_GT(state.ranges.size(), 1U);
+    for (const auto& range : state.ranges) {
+        ASSERT_FALSE(range.getCompressor());
+    }
+}
+
+TEST_F(SorterSpillTest, MergesSpillsInParallelWithReadAhead) {
+    RAIIServerParameterControllerForTest compressor("sorterSpillCompressor", "zstd");
+    RAIIServerParameterControllerForTest mergeThreads("sorterMaxParallelMergeThreads", 4);
+    RAIIServerParameterControllerForTest readAheadThreads("sorterReadAheadMaxThreads", 4);
+    ASSERT(isReadAheadEnabled());
+
+    unittest::TempDir tempDir(_agent.getSuiteName() + "_" + _agent.getTestName());
+    // Allows merging four spills at a time, so that the merges are split between two threads.
+    auto opts = SortOptions()
+                    .ExtSortAllowed()
+                    .TempDir(tempDir.path())
+                    .MaxMemoryUsageBytes(8 * kSortedFileBufferSize);
+
+    const int numItems = 500 * 1000;
+    std::vector<int> values(numItems);
+    std::iota(values.begin(), values.end(), 0);
+    PseudoRandom random(int64_t(time(nullptr)));
+    std::shuffle(values.begin(), values.end(), random.urbg());
+
+    auto sorter = std::unique_ptr<IWSorter>(IWSorter::make(opts, IWComparator(ASC)));
+    for (int value : values) {
+        sorter->add(value, -value);
+    }
+    ASSERT_ITERATORS_EQUIVALENT(std::shared_ptr<IWIterator>(sorter->done()),
+                                std::make_shared<IntIterator>(0, numItems));
+    ASSERT_GT(sorter->numSpills(), numItems * sizeof(IWPair) / (8 * kSortedFileBufferSize));
+}
+
+TEST_F(SorterSpillTest, ResumesFromSpillsMergedInParallel) {
+    RAIIServerParameterControllerForTest mergeThreads("sorterMaxParallelMergeThreads", 4);
+    RAIIServerParameterControllerForTest readAheadThreads("sorterReadAheadMaxThreads", 4);
+
+    unittest::TempDir tempDir(_agent.getSuiteName() + "_" + _agent.getTestName());
+    auto opts = SortOptions()
+                    .ExtSortAllowed()
+                    .TempDir(tempDir.path())
+                    .MaxMemoryUsageBytes(8 * kSortedFileBufferSize);
+
+    const int numItems = 500 * 1000;
+    std::vector<int> values(numItems);
+    std::iota(values.begin(), values.end(), 0);
+    PseudoRandom random(int64_t(time(nullptr)));
+    std::shuffle(values.begin(), values.end(), random.urbg());
+
+    IWSorter::PersistedState state;
+    {
+        auto sorter = std::unique_ptr<IWSorter>(IWSorter::make(opts, IWComparator(ASC)));
+        for (int value : values) {
+            sorter->add(value, -value);
+        }
+        state = sorter->persistDataForShutdown();
+        // Some of the persisted ranges were written by merges.
+        ASSERT_GT(sorter->numSpills(), state.ranges.size());
+    }
+
+    // The ranges merged on every thread were gathered into the one persisted file, which is all
+    // that is left once the sorter is gone.
+    ASSERT_EQ(std::distance(boost::filesystem::directory_iterator(tempDir.path()),
+                            boost::filesystem::directory_iterator()),
+              1);
+
+    auto sorter = std::unique_ptr<IWSorter>(
+        IWSorter::makeFromExistingRanges(state.fileName, state.ranges, opts, IWComparator(ASC)));
+    ASSERT_ITERATORS_EQUIVALENT(std::shared_ptr<IWIterator>(sorter->done()),
+                                std::make_shared<IntIterator>(0, numItems));
+}
+
 class BoundedSorterTest : public unittest::Test {
 public:
     using Key = IntWrapper;
@@ -36,6 +36,7 @@
 #include "mongo/db/catalog/validate_results.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/record_id.h"
+#include "mongo/db/storage/compact_options.h"
 #include "mongo/db/storage/ident.h"
 
 namespace mongo {
@@ -293,7 +294,7 @@ public:
     //
     // Whole ColumnStore ops
     //
-    virtual Status compact(OperationContext* opCtx) = 0;
+    virtual Status compact(OperationContext* opCtx, const CompactOptions& options) = 0;
     virtual void fullValidate(OperationContext* opCtx,
                               int64_t* numKeysOut,
                               IndexValidateResults* fullResults) const = 0;
@@ -481,6 +481,21 @@ std::unique_ptr<SeekableRecordCursor> EphemeralForTestRecordStore::getCursor(
     return std::make_unique<ReverseCursor>(opCtx, *this);
 }
 
+Status EphemeralForTestRecordStore::doRangeTruncate(OperationContext* opCtx,
+                                                    const RecordId& minRecordId,
+                                                    const RecordId& maxRecordId,
+                                                    int64_t hintDataSizeIncrement,
+                                                    int64_t hintNumRecordsIncrement) {
+    // The size information is maintained by deleteRecord(), so the hints are not needed.
+    stdx::lock_guard<stdx::recursive_mutex> lock(_data->recordsMutex);
+    Records::iterator it = _data->records.lower_bound(minRecordId);
+    while (it != _data->records.end() && it->first <= maxRecordId) {
+        RecordId id = (it++)->first;
+        deleteRecord(lock, opCtx, id);
+    }
+    return Status::OK();
+}
+
 Status EphemeralForTestRecordStore::doTruncate(OperationContext* opCtx) {
     // Unlike other changes, TruncateChange mutates _data on construction to perform the
     // truncate
@@ -90,6 +90,12 @@ public:
 
     Status doTruncate(OperationContext* opCtx) override;
 
+    Status doRangeTruncate(OperationContext* opCtx,
+                           const RecordId& minRecordId,
+                           const RecordId& maxRecordId,
+                           int64_t hintDataSizeIncrement,
+                           int64_t hintNumRecordsIncrement) override;
+
     void doCappedTruncateAfter(OperationContext* opCtx, RecordId end, bool inclusive) override;
 
     virtual void appendNumericCustomStats(OperationContext* opCtx,
@@ -33,6 +33,7 @@
 #include "mongo/db/storage/key_string.h"
 
 #include <cmath>
+#include <cstring>
 #include <type_traits>
 
 #include "mongo/base/data_cursor.h"
@@ -245,10 +246,23 @@ const uint8_t kGreater = 254;
 // some utility functions
 namespace {
 
+/**
+ * Copies 'bytes' bytes from 'src' to 'dst', inverting every bit. 'dst' may equal 'src' to invert
+ * a buffer in place. Descending index keys are encoded and decoded through here, so the bytes are
+ * flipped a machine word at a time, which the compiler is free to widen to vector instructions.
+ */
 void memcpy_flipBits(void* dst, const void* src, size_t bytes) {
     const char* input = static_cast<const char*>(src);
     char* output = static_cast<char*>(dst);
     const char* const end = input + bytes;
+    while (end - input >= static_cast<ptrdiff_t>(sizeof(uint64_t))) {
+        uint64_t word;
+        std::memcpy(&word, input, sizeof(word));
+        word = ~word;
+        std::memcpy(output, &word, sizeof(word));
+        input += sizeof(word);
+        output += sizeof(word);
+    }
     while (input != end) {
         *output++ = ~(*input++);
     }
@@ -300,10 +314,8 @@ string readInvertedCString(BufReader* reader) {
     const char* end = static_cast<const char*>(memchr(start, 0xFF, reader->remaining()));
     keyStringAssert(50817, "Failed to find '0xFF' in inverted string.", end);
     size_t actualBytes = end - start;
-    string s(start, actualBytes);
-    for (size_t i = 0; i < s.size(); i++) {
-        s[i] = ~s[i];
-    }
+    string s(actualBytes, '\0');
+    memcpy_flipBits(&s[0], start, actualBytes);
     reader->skip(1 + actualBytes);
     return s;
 }
@@ -330,10 +342,7 @@ string readInvertedCStringWithNuls(BufReader* reader) {
         reader->skip(1 + actualBytes);
     } while (reader->peek<unsigned char>() == 0x00);
 
-    for (size_t i = 0; i < out.size(); i++) {
-        out[i] = ~out[i];
-    }
-
+    memcpy_flipBits(&out[0], out.data(), out.size());
     return out;
 }
 }  // namespace
@@ -1764,6 +1764,21 @@ TEST_F(KeyStringBuilderTest, VeryLargeString) {
     ROUNDTRIP(version, obj);
 }
 
+TEST_F(KeyStringBuilderTest, StringsOfEveryLengthAroundWordSize) {
+    // Inverted bytes are flipped a word at a time, so cover strings whose length is not a multiple
+    // of the word size, with NUL bytes on either side of a word boundary.
+    for (size_t len = 0; len <= 3 * sizeof(uint64_t); ++len) {
+        std::string str(len, 'x');
+        ROUNDTRIP(version, BSON("" << str));
+        ROUNDTRIP(version, BSON("" << BSON(str << str)));
+        if (len > sizeof(uint64_t)) {
+            str[sizeof(uint64_t) - 1] = '\0';
+            str[sizeof(uint64_t)] = '\0';
+            ROUNDTRIP(version, BSON("" << str));
+        }
+    }
+}
+
 TEST_F(KeyStringBuilderTest, ToBsonSafeShouldNotTerminate) {
     KeyString::TypeBits typeBits(KeyString::Version::V1);
 
@@ -193,6 +193,18 @@ public:
                                     const IndexDescriptor* desc,
                                     bool isForceUpdateMetadata) {}
 
+    /**
+     * Sets whether the storage engine keeps the data of 'ident' in its cache instead of evicting
+     * it under cache pressure. This is not transactional. Waits for the table to be no longer in
+     * use if needed, so that it only fails on unexpected errors. Storage engines that cannot pin
+     * data in their cache ignore it.
+     */
+    virtual Status setIdentCacheResident(OperationContext* opCtx,
+                                         StringData ident,
+                                         bool cacheResident) {
+        return Status::OK();
+    }
+
     /**
      * See StorageEngine::flushAllFiles for details
      */
@@ -32,6 +32,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/storage/record_store.h"
 #include "mongo/db/storage/storage_options.h"
+#include "mongo/util/str.h"
 
 namespace mongo {
 namespace {
@@ -76,14 +77,27 @@ Status RecordStore::truncate(OperationContext* opCtx) {
     return doTruncate(opCtx);
 }
 
+Status RecordStore::rangeTruncate(OperationContext* opCtx,
+                                  const RecordId& minRecordId,
+                                  const RecordId& maxRecordId,
+                                  int64_t hintDataSizeIncrement,
+                                  int64_t hintNumRecordsIncrement) {
+    validateWriteAllowed(opCtx);
+    invariant(minRecordId <= maxRecordId,
+              str::stream() << "Start position cannot be after end position. minRecordId: "
+                            << minRecordId << ", maxRecordId: " << maxRecordId);
+    return doRangeTruncate(
+        opCtx, minRecordId, maxRecordId, hintDataSizeIncrement, hintNumRecordsIncrement);
+}
+
 void RecordStore::cappedTruncateAfter(OperationContext* opCtx, RecordId end, bool inclusive) {
     validateWriteAllowed(opCtx);
     doCappedTruncateAfter(opCtx, end, inclusive);
 }
 
-Status RecordStore::compact(OperationContext* opCtx) {
+Status RecordStore::compact(OperationContext* opCtx, const CompactOptions& options) {
     validateWriteAllowed(opCtx);
-    return doCompact(opCtx);
+    return doCompact(opCtx, options);
 }
 
 
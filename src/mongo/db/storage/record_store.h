@@ -29,12 +29,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <boost/optional.hpp>
+#include <functional>
 
 #include "mongo/bson/mutable/damage_vector.h"
+#include "mongo/bson/util/builder.h"
 #include "mongo/db/exec/collection_scan_common.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/record_id.h"
+#include "mongo/db/storage/compact_options.h"
 #include "mongo/db/storage/ident.h"
 #include "mongo/db/storage/key_format.h"
 #include "mongo/db/storage/record_data.h"
@@ -60,6 +64,64 @@ struct Record {
     RecordData data;
 };
 
+/**
+ * A buffer of Records filled by RecordCursor::nextBatch(). The data of the records is copied into
+ * an arena owned by the batch, which keeps its memory when cleared so that it can be refilled
+ * without allocating. The Records returned by operator[] are unowned, and remain valid until the
+ * batch is cleared or destroyed.
+ */
+class RecordBatch {
+public:
+    /**
+     * Once the data of the records in the batch amounts to 'maxBytes', the batch is full.
+     */
+    explicit RecordBatch(size_t maxBytes = kDefaultMaxBytes) : _maxBytes(maxBytes) {}
+
+    Record operator[](size_t i) const {
+        const auto& [offset, size] = _extents[i];
+        return {_ids[i], RecordData(_arena.buf() + offset, size)};
+    }
+
+    size_t size() const {
+        return _ids.size();
+    }
+
+    bool empty() const {
+        return _ids.empty();
+    }
+
+    bool full() const {
+        return static_cast<size_t>(_arena.len()) >= _maxBytes;
+    }
+
+    /**
+     * Copies a record to the end of the batch.
+     */
+    void append(const RecordId& id, const char* data, int size) {
+        _extents.emplace_back(_arena.len(), size);
+        _arena.appendBuf(data, size);
+        _ids.push_back(id);
+    }
+
+    void clear() {
+        _arena.reset(kMaxRetainedBytes);
+        _extents.clear();
+        _ids.clear();
+    }
+
+private:
+    static constexpr size_t kDefaultMaxBytes = 1024 * 1024;
+
+    // The arena is freed when cleared if it has grown past this size, e.g. due to a single large
+    // record, rather than retained for the lifetime of the batch.
+    static constexpr size_t kMaxRetainedBytes = 4 * 1024 * 1024;
+
+    const size_t _maxBytes;
+    BufBuilder _arena;
+    std::vector<std::pair<int, int>> _extents;
+    std::vector<RecordId> _ids;
+};
+
 /**
  * Retrieves Records from a RecordStore.
  *
@@ -114,6 +176,28 @@ public:
      */
     virtual boost::optional<Record> next() = 0;
 
+    /**
+     * Clears 'batch', then moves forward over up to 'maxRecords' records, copying each of them into
+     * 'batch', as if by calling next() that many times. Stops early once the batch is full, or at
+     * EOF. Returns the number of records in the batch, which is zero only at EOF.
+     *
+     * The cursor is left positioned on the last record in the batch. If this throws, the cursor is
+     * left positioned as it was before the call, so that none of the records read are lost.
+     *
+     * The default implementation reads a single record per call, since the state of a cursor
+     * after next() throws can't be rolled back. Storage engines should override it to avoid the
+     * cost of a call to next() for each record.
+     */
+    virtual size_t nextBatch(size_t maxRecords, RecordBatch* batch) {
+        batch->clear();
+        if (maxRecords > 0) {
+            if (auto record = next()) {
+                batch->append(record->id, record->data.data(), record->data.size());
+            }
+        }
+        return batch->size();
+    }
+
     //
     // Saving and restoring state
     //
@@ -184,6 +268,28 @@ public:
      */
     virtual boost::optional<Record> seekExact(const RecordId& id) = 0;
 
+    /**
+     * Clears 'batch', then looks up each of 'ids', which must be sorted in ascending order without
+     * duplicates, copying the records that exist into 'batch' in the same order. Returns the
+     * number of records found. The resulting position of the cursor is unspecified.
+     *
+     * Looking up records in RecordId order, rather than in the order that an index returns them,
+     * lets the storage engine reuse the pages it has already read for neighboring records.
+     *
+     * The default implementation calls seekExact() for each id.
+     */
+    virtual size_t seekExactMany(const std::vector<RecordId>& ids, RecordBatch* batch) {
+        dassert(std::adjacent_find(ids.begin(), ids.end(), std::greater_equal<RecordId>()) ==
+                ids.end());
+        batch->clear();
+        for (auto&& id : ids) {
+            if (auto record = seekExact(id)) {
+                batch->append(record->id, record->data.data(), record->data.size());
+            }
+        }
+        return batch->size();
+    }
+
     /**
      * Positions this cursor near 'start' or an adjacent record if 'start' does not exist. If there
      * is not an exact match, the cursor is positioned on the directionally previous Record. If no
@@ -381,6 +487,31 @@ public:
         return inOutRecords.front().id;
     }
 
+    /**
+     * Appends records to an empty RecordStore, bypassing the transactional insert path. Records
+     * inserted through a BulkLoader are not part of any WriteUnitOfWork and are never rolled back,
+     * so it is only suitable for populating a collection that is discarded as a whole on failure.
+     * The load finishes when the BulkLoader is destroyed, and no other reads or writes of the
+     * RecordStore are allowed until then.
+     */
+    class BulkLoader {
+    public:
+        virtual ~BulkLoader() = default;
+
+        /**
+         * Appends a record and returns the RecordId generated for it.
+         */
+        virtual StatusWith<RecordId> insertRecord(const char* data, int len) = 0;
+    };
+
+    /**
+     * Returns a BulkLoader for this RecordStore, or nullptr if the storage engine cannot bulk load
+     * it, for instance because it is not empty. Callers must then use insertRecords() instead.
+     */
+    virtual std::unique_ptr<BulkLoader> makeBulkLoader(OperationContext* opCtx) {
+        return nullptr;
+    }
+
     /**
      * Updates the record with id 'recordId', replacing its contents with those described by
      * 'data' and 'len'.
@@ -452,6 +583,20 @@ public:
      */
     Status truncate(OperationContext* opCtx);
 
+    /**
+     * Removes all Records with ids in the range ['minRecordId', 'maxRecordId'], in one storage
+     * engine operation rather than one per Record. Neither bound needs to exist. Counting the
+     * removed Records would require visiting them, so the caller passes the changes to the number
+     * and size of the Records, which are applied to the size information of the RecordStore.
+     *
+     * Must be called within a WriteUnitOfWork.
+     */
+    Status rangeTruncate(OperationContext* opCtx,
+                         const RecordId& minRecordId,
+                         const RecordId& maxRecordId,
+                         int64_t hintDataSizeIncrement,
+                         int64_t hintNumRecordsIncrement);
+
     /**
      * Truncate documents newer than the document at 'end' from the capped
      * collection.  The collection cannot be completely emptied using this
@@ -483,7 +628,7 @@ public:
      *
      * Only called if compactSupported() returns true.
      */
-    Status compact(OperationContext* opCtx);
+    Status compact(OperationContext* opCtx, const CompactOptions& options);
 
     /**
      * Performs record store specific validation to ensure consistency of underlying data
@@ -624,8 +769,13 @@ protected:
         const char* damageSource,
         const mutablebson::DamageVector& damages) = 0;
     virtual Status doTruncate(OperationContext* opCtx) = 0;
+    virtual Status doRangeTruncate(OperationContext* opCtx,
+                                   const RecordId& minRecordId,
+                                   const RecordId& maxRecordId,
+                                   int64_t hintDataSizeIncrement,
+                                   int64_t hintNumRecordsIncrement) = 0;
     virtual void doCappedTruncateAfter(OperationContext* opCtx, RecordId end, bool inclusive) = 0;
-    virtual Status doCompact(OperationContext* opCtx) {
+    virtual Status doCompact(OperationContext* opCtx, const CompactOptions& options) {
         MONGO_UNREACHABLE;
     }
 
@@ -479,5 +479,59 @@ TEST(RecordStoreTestHarness, SeekExactForMissingRecordReturnsNone) {
     ASSERT_FALSE(recordStore->findRecord(opCtx.get(), recordIds[1], &outputData));
 }
 
+// Insert multiple records and read them back in batches. Each batch holds at most the requested
+// number of records, the cursor is left on the last record of a batch so that next() resumes after
+// it, and reading a batch at EOF returns no records.
+TEST(RecordStoreTestHarness, NextBatchReturnsRecordsInOrder) {
+    const auto harnessHelper(newRecordStoreHarnessHelper());
+    unique_ptr<RecordStore> rs(harnessHelper->newRecordStore());
+
+    const int nToInsert = 10;
+    RecordId locs[nToInsert];
+    std::string datas[nToInsert];
+    for (int i = 0; i < nToInsert; i++) {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        stringstream ss;
+        ss << "record " << i;
+        string data = ss.str();
+
+        WriteUnitOfWork uow(opCtx.get());
+        StatusWith<RecordId> res =
+            rs->insertRecord(opCtx.get(), data.c_str(), data.size() + 1, Timestamp());
+        ASSERT_OK(res.getStatus());
+        locs[i] = res.getValue();
+        datas[i] = data;
+        uow.commit();
+    }
+
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        auto cursor = rs->getCursor(opCtx.get());
+        RecordBatch batch;
+        const size_t maxRecords = 4;
+        int i = 0;
+        while (i < nToInsert - 1) {
+            const size_t n = cursor->nextBatch(maxRecords, &batch);
+            ASSERT_GTE(n, 1U);
+            ASSERT_LTE(n, maxRecords);
+            ASSERT_EQUALS(n, batch.size());
+            for (size_t j = 0; j < n; j++, i++) {
+                ASSERT_EQUALS(locs[i], batch[j].id);
+                ASSERT_EQUALS(datas[i], batch[j].data.data());
+            }
+        }
+
+        // Interleaving next() with nextBatch() continues from the end of the last batch.
+        if (i < nToInsert) {
+            const auto record = cursor->next();
+            ASSERT(record);
+            ASSERT_EQUALS(locs[i], record->id);
+            ASSERT_EQUALS(datas[i], record->data.data());
+        }
+        ASSERT_EQUALS(0U, cursor->nextBatch(maxRecords, &batch));
+        ASSERT(batch.empty());
+    }
+}
+
 }  // namespace
 }  // namespace mongo
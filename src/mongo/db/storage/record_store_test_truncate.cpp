@@ -34,6 +34,7 @@
 
 #include "mongo/db/storage/record_store.h"
 #include "mongo/unittest/unittest.h"
+#include "mongo/util/str.h"
 
 namespace mongo {
 namespace {
@@ -114,5 +115,53 @@ TEST(RecordStoreTestHarness, TruncateNonEmpty) {
     }
 }
 
+// Insert multiple records, and verify that calling rangeTruncate() removes the records in the
+// given range, including when the bounds of the range do not exist.
+TEST(RecordStoreTestHarness, RangeTruncate) {
+    const auto harnessHelper(newRecordStoreHarnessHelper());
+    unique_ptr<RecordStore> rs(harnessHelper->newRecordStore());
+
+    std::vector<RecordId> ids;
+    int64_t recordSize = 0;
+    for (int i = 0; i < 10; i++) {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        string data = str::stream() << "record " << i;
+        recordSize = data.size() + 1;
+
+        WriteUnitOfWork uow(opCtx.get());
+        StatusWith<RecordId> res =
+            rs->insertRecord(opCtx.get(), data.c_str(), data.size() + 1, Timestamp());
+        ASSERT_OK(res.getStatus());
+        ids.push_back(res.getValue());
+        uow.commit();
+    }
+
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        WriteUnitOfWork uow(opCtx.get());
+        ASSERT_OK(rs->rangeTruncate(opCtx.get(), ids[2], ids[5], -4 * recordSize, -4));
+        ASSERT_OK(
+            rs->rangeTruncate(opCtx.get(), ids[8], RecordId::maxLong(), -2 * recordSize, -2));
+        uow.commit();
+    }
+
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        ASSERT_EQUALS(4, rs->numRecords(opCtx.get()));
+        ASSERT_EQUALS(4 * recordSize, rs->dataSize(opCtx.get()));
+
+        std::vector<RecordId> remaining;
+        auto cursor = rs->getCursor(opCtx.get());
+        while (auto record = cursor->next()) {
+            remaining.push_back(record->id);
+        }
+        ASSERT_EQ(4U, remaining.size());
+        ASSERT_EQ(ids[0], remaining[0]);
+        ASSERT_EQ(ids[1], remaining[1]);
+        ASSERT_EQ(ids[6], remaining[2]);
+        ASSERT_EQ(ids[7], remaining[3]);
+    }
+}
+
 }  // namespace
 }  // namespace mongo
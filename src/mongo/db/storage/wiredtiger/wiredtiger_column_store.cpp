@@ -449,7 +449,7 @@ long long WiredTigerColumnStore::getFreeStorageBytes(OperationContext* opCtx) co
     return 27017;
 }
 
-Status WiredTigerColumnStore::compact(OperationContext* opCtx) {
+Status WiredTigerColumnStore::compact(OperationContext* opCtx, const CompactOptions& options) {
     // TODO: SERVER-65980.
     uasserted(ErrorCodes::NotImplemented, "WiredTigerColumnStore::compact");
 }
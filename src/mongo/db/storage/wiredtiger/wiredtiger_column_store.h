@@ -69,7 +69,7 @@ public:
     //
     // Whole ColumnStore ops
     //
-    Status compact(OperationContext* opCtx) override;
+    Status compact(OperationContext* opCtx, const CompactOptions& options) override;
     void fullValidate(OperationContext* opCtx,
                       int64_t* numKeysOut,
                       IndexValidateResults* fullResults) const override;
@@ -175,6 +175,9 @@ StatusWith<std::string> WiredTigerIndex::generateCreateString(
               ->getTableCreateConfig(collectionNamespace.ns());
     ss << sysIndexConfig << ",";
     ss << collIndexConfig << ",";
+    if (desc.cacheResident()) {
+        ss << "cache_resident=true,";
+    }
 
     // Validate configuration object.
     // Raise an error about unrecognized fields that may be introduced in newer versions of
@@ -496,13 +499,13 @@ Status WiredTigerIndex::initAsEmpty(OperationContext* opCtx) {
     return Status::OK();
 }
 
-Status WiredTigerIndex::compact(OperationContext* opCtx) {
+Status WiredTigerIndex::compact(OperationContext* opCtx, const CompactOptions& options) {
     dassert(opCtx->lockState()->isWriteLocked());
     WiredTigerSessionCache* cache = WiredTigerRecoveryUnit::get(opCtx)->getSessionCache();
     if (!cache->isEphemeral()) {
         WT_SESSION* s = WiredTigerRecoveryUnit::get(opCtx)->getSession()->getSession();
         opCtx->recoveryUnit()->abandonSnapshot();
-        int ret = s->compact(s, uri().c_str(), "timeout=0");
+        int ret = s->compact(s, uri().c_str(), WiredTigerUtil::compactConfig(options).c_str());
         if (MONGO_unlikely(WTCompactIndexEBUSY.shouldFail())) {
             ret = EBUSY;
         }
@@ -512,6 +515,10 @@ Status WiredTigerIndex::compact(OperationContext* opCtx) {
                           str::stream() << "Compaction interrupted on " << uri().c_str()
                                         << " due to cache eviction pressure");
         }
+        if (ret == ETIMEDOUT) {
+            return Status(ErrorCodes::ExceededTimeLimit,
+                          str::stream() << "Compaction of " << uri() << " ran out of time");
+        }
         invariantWTOK(ret, s);
     }
     return Status::OK();
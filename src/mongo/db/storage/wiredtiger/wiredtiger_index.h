@@ -155,7 +155,7 @@ public:
 
     virtual Status initAsEmpty(OperationContext* opCtx);
 
-    Status compact(OperationContext* opCtx) override;
+    Status compact(OperationContext* opCtx, const CompactOptions& options) override;
 
     const std::string& uri() const {
         return _uri;
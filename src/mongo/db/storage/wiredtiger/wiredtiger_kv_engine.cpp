@@ -1649,6 +1649,10 @@ Status WiredTigerKVEngine::createSortedDataInterface(OperationContext* opCtx,
             dps::extractElementAtPath(*storageEngineOptions, _canonicalName + ".configString")
                 .str();
     }
+    if (collOptions.cacheResident) {
+        // The indexes of a cache resident collection are kept in cache as well.
+        collIndexOptions += ",cache_resident=true";
+    }
     // Some unittests use a OperationContextNoop that can't support such lookups.
     StatusWith<std::string> result =
         WiredTigerIndex::generateCreateString(_canonicalName,
@@ -1834,6 +1838,37 @@ Status WiredTigerKVEngine::alterMetadata(StringData uri, StringData config) {
     return wtRCToStatus(ret, sessionPtr);
 }
 
+Status WiredTigerKVEngine::setIdentCacheResident(OperationContext* opCtx,
+                                                 StringData ident,
+                                                 bool cacheResident) {
+    std::string uri = _uri(ident);
+
+    // Unlike alterMetadata(), do not checkpoint when the table is busy: the caller holds the
+    // collection lock exclusively, which a checkpoint of the whole database would hold for too
+    // long. Back off and retry until whoever uses the table lets go of it instead.
+    WiredTigerSession session(_conn);
+    auto sessionPtr = session.getSession();
+    std::string config = str::stream() << "cache_resident=" << (cacheResident ? "true" : "false");
+    int ret = 0;
+    size_t attempt = 0;
+    do {
+        // Altering a table needs exclusive access to it, which cached cursors would prevent.
+        WiredTigerRecoveryUnit::get(opCtx)->getSessionNoTxn()->closeAllCursors(uri);
+        _sessionCache->closeAllCursors(uri);
+
+        ret = sessionPtr->alter(sessionPtr, uri.c_str(), config.c_str());
+        if (ret == EBUSY) {
+            logAndBackoff(7086808,
+                          ::mongo::logv2::LogComponent::kStorage,
+                          logv2::LogSeverity::Debug(1),
+                          ++attempt,
+                          "WiredTiger table is busy, retrying to change its cache residency",
+                          "uri"_attr = uri);
+        }
+    } while (ret == EBUSY);
+    return wtRCToStatus(ret, sessionPtr);
+}
+
 Status WiredTigerKVEngine::dropIdent(RecoveryUnit* ru,
                                      StringData ident,
                                      StorageEngine::DropIdentCallback&& onDrop) {
@@ -196,6 +196,10 @@ public:
 
     Status alterMetadata(StringData uri, StringData config);
 
+    Status setIdentCacheResident(OperationContext* opCtx,
+                                 StringData ident,
+                                 bool cacheResident) override;
+
     void flushAllFiles(OperationContext* opCtx, bool callerHoldsReadLock) override;
 
     Status beginBackup(OperationContext* opCtx) override;
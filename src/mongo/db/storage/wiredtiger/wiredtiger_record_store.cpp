@@ -830,6 +830,10 @@ StatusWith<std::string> WiredTigerRecordStore::generateCreateString(
     ss << WiredTigerCustomizationHooks::get(getGlobalServiceContext())
               ->getTableCreateConfig(nss.ns());
 
+    if (options.cacheResident) {
+        ss << "cache_resident=true,";
+    }
+
     ss << extraStrings << ",";
 
     StatusWith<std::string> customOptions =
@@ -1436,6 +1440,89 @@ Status WiredTigerRecordStore::_insertRecords(OperationContext* opCtx,
     return Status::OK();
 }
 
+/**
+ * Appends records to an empty table through a WiredTiger bulk cursor, which writes them straight
+ * into new pages instead of going through a transaction. The cursor lives in a session of its own,
+ * so the load is not part of any transaction of the caller.
+ */
+class WiredTigerRecordStore::BulkRecordLoader final : public RecordStore::BulkLoader {
+public:
+    BulkRecordLoader(WiredTigerRecordStore* rs,
+                     OperationContext* opCtx,
+                     UniqueWiredTigerSession session,
+                     WT_CURSOR* cursor)
+        : _rs(rs), _opCtx(opCtx), _session(std::move(session)), _cursor(cursor) {}
+
+    ~BulkRecordLoader() {
+        // Closing the bulk cursor finishes the load and makes the records visible.
+        _cursor->close(_cursor);
+    }
+
+    StatusWith<RecordId> insertRecord(const char* data, int len) override {
+        // RecordIds are generated in increasing order, as a bulk cursor requires.
+        RecordId id(_rs->_reserveIdBlock(_opCtx, 1));
+        CursorKey key = makeCursorKey(id, _rs->_keyFormat);
+        _rs->setKey(_cursor, &key);
+        WiredTigerItem value(data, len);
+        _cursor->set_value(_cursor, value.Get());
+
+        // Not wiredTigerCursorInsert(), as the write is not part of the transaction of _opCtx.
+        int ret = WT_OP_CHECK(_cursor->insert(_cursor));
+        if (ret)
+            return wtRCToStatus(ret, _cursor->session, "WiredTigerRecordStore::BulkRecordLoader");
+
+        // The record is never rolled back, so neither are the size adjustments for it.
+        _rs->_changeNumRecords(nullptr, 1);
+        _rs->_increaseDataSize(nullptr, len);
+
+        auto& metricsCollector = ResourceConsumption::MetricsCollector::get(_opCtx);
+        metricsCollector.incrementOneDocWritten(_rs->_uri, value.size + computeRecordIdSize(id));
+
+        return id;
+    }
+
+private:
+    WiredTigerRecordStore* const _rs;
+    OperationContext* const _opCtx;
+    const UniqueWiredTigerSession _session;
+    WT_CURSOR* const _cursor;
+};
+
+std::unique_ptr<RecordStore::BulkLoader> WiredTigerRecordStore::makeBulkLoader(
+    OperationContext* opCtx) {
+    // A bulk cursor can only append to a table, in key order. That rules out the oplog and capped
+    // collections, which delete as they insert, and clustered collections, whose RecordIds come
+    // from the documents in whatever order the caller inserts them.
+    if (opCtx->readOnly() || _isCapped || _isOplog || _keyFormat != KeyFormat::Long ||
+        numRecords(opCtx) != 0) {
+        return nullptr;
+    }
+
+    // Looking up the highest RecordId opens a cursor on the table, which must happen before the
+    // bulk cursor is opened.
+    _initNextIdIfNeeded(opCtx);
+
+    // Open cursors cause the bulk open_cursor to fail with EBUSY.
+    WiredTigerRecoveryUnit::get(opCtx)->getSession()->closeAllCursors(_uri);
+
+    auto session = WiredTigerRecoveryUnit::get(opCtx)->getSessionCache()->getSession();
+    WT_SESSION* wtSession = session->getSession();
+    WT_CURSOR* cursor;
+    int ret = wtSession->open_cursor(
+        wtSession, _uri.c_str(), nullptr, "bulk,checkpoint_wait=false", &cursor);
+    if (ret) {
+        LOGV2_DEBUG(7086784,
+                    1,
+                    "Failed to open a WiredTiger bulk cursor, falling back to transactional "
+                    "inserts",
+                    "error"_attr = wiredtiger_strerror(ret),
+                    "uri"_attr = _uri);
+        return nullptr;
+    }
+
+    return std::make_unique<BulkRecordLoader>(this, opCtx, std::move(session), cursor);
+}
+
 bool WiredTigerRecordStore::isOpHidden_forTest(const RecordId& id) const {
     invariant(_isOplog);
     invariant(id.getLong() > 0);
@@ -1752,14 +1839,44 @@ Status WiredTigerRecordStore::doTruncate(OperationContext* opCtx) {
     return Status::OK();
 }
 
-Status WiredTigerRecordStore::doCompact(OperationContext* opCtx) {
+Status WiredTigerRecordStore::doRangeTruncate(OperationContext* opCtx,
+                                              const RecordId& minRecordId,
+                                              const RecordId& maxRecordId,
+                                              int64_t hintDataSizeIncrement,
+                                              int64_t hintNumRecordsIncrement) {
+    // WiredTiger does not require the keys of the start and stop cursors to exist, it removes
+    // whatever records fall between them.
+    WiredTigerCursor startWrap(_uri, _tableId, true, opCtx);
+    WT_CURSOR* start = startWrap.get();
+    CursorKey startKey = makeCursorKey(minRecordId, _keyFormat);
+    setKey(start, &startKey);
+
+    WiredTigerCursor stopWrap(_uri, _tableId, true, opCtx);
+    WT_CURSOR* stop = stopWrap.get();
+    CursorKey stopKey = makeCursorKey(maxRecordId, _keyFormat);
+    setKey(stop, &stopKey);
+
+    WT_SESSION* session = WiredTigerRecoveryUnit::get(opCtx)->getSession()->getSession();
+    int ret = WT_OP_CHECK(session->truncate(session, nullptr, start, stop, nullptr));
+    // There is nothing to remove when the range is empty.
+    if (ret == WT_NOTFOUND) {
+        return Status::OK();
+    }
+    invariantWTOK(ret, session);
+
+    _changeNumRecords(opCtx, hintNumRecordsIncrement);
+    _increaseDataSize(opCtx, hintDataSizeIncrement);
+    return Status::OK();
+}
+
+Status WiredTigerRecordStore::doCompact(OperationContext* opCtx, const CompactOptions& options) {
     dassert(opCtx->lockState()->isWriteLocked());
 
     WiredTigerSessionCache* cache = WiredTigerRecoveryUnit::get(opCtx)->getSessionCache();
     if (!cache->isEphemeral()) {
         WT_SESSION* s = WiredTigerRecoveryUnit::get(opCtx)->getSession()->getSession();
         opCtx->recoveryUnit()->abandonSnapshot();
-        int ret = s->compact(s, getURI().c_str(), "timeout=0");
+        int ret = s->compact(s, getURI().c_str(), WiredTigerUtil::compactConfig(options).c_str());
         if (MONGO_unlikely(WTCompactRecordStoreEBUSY.shouldFail())) {
             ret = EBUSY;
         }
@@ -1769,6 +1886,10 @@ Status WiredTigerRecordStore::doCompact(OperationContext* opCtx) {
                           str::stream() << "Compaction interrupted on " << getURI().c_str()
                                         << " due to cache eviction pressure");
         }
+        if (ret == ETIMEDOUT) {
+            return Status(ErrorCodes::ExceededTimeLimit,
+                          str::stream() << "Compaction of " << getURI() << " ran out of time");
+        }
         invariantWTOK(ret, s);
     }
     return Status::OK();
@@ -1984,11 +2105,14 @@ void WiredTigerRecordStore::_changeNumRecords(OperationContext* opCtx, int64_t d
         return;
     }
 
-    opCtx->recoveryUnit()->onRollback([this, diff]() {
-        LOGV2_DEBUG(
-            22404, 3, "WiredTigerRecordStore: rolling back NumRecordsChange", "diff"_attr = -diff);
-        _sizeInfo->numRecords.addAndFetch(-diff);
-    });
+    if (opCtx)
+        opCtx->recoveryUnit()->onRollback([this, diff]() {
+            LOGV2_DEBUG(22404,
+                        3,
+                        "WiredTigerRecordStore: rolling back NumRecordsChange",
+                        "diff"_attr = -diff);
+            _sizeInfo->numRecords.addAndFetch(-diff);
+        });
     _sizeInfo->numRecords.addAndFetch(diff);
 }
 
@@ -2172,9 +2296,63 @@ boost::optional<Record> WiredTigerRecordStoreCursorBase::next() {
     // options we pass when we explicitly start transactions in the RecoveryUnit.
     WiredTigerRecoveryUnit::get(_opCtx)->getSession();
 
-    WT_CURSOR* c = _cursor->get();
+    RecordId id;
+    WT_ITEM value;
+    if (!advance(&id, &value)) {
+        return {};
+    }
+
+    auto& metricsCollector = ResourceConsumption::MetricsCollector::get(_opCtx);
+
+    auto keyLength = computeRecordIdSize(id);
+    metricsCollector.incrementOneDocRead(_rs.getURI(), value.size + keyLength);
+
+    _lastReturnedId = id;
+    return {{std::move(id), {static_cast<const char*>(value.data), static_cast<int>(value.size)}}};
+}
+
+size_t WiredTigerRecordStoreCursorBase::nextBatch(size_t maxRecords, RecordBatch* batch) {
+    invariant(_hasRestored);
+    batch->clear();
+    if (_eof)
+        return 0;
+
+    // Ensure an active transaction is open. While WiredTiger supports using cursors on a session
+    // without an active transaction (i.e. an implicit transaction), that would bypass configuration
+    // options we pass when we explicitly start transactions in the RecoveryUnit.
+    WiredTigerRecoveryUnit::get(_opCtx)->getSession();
+
+    // If reading a record throws, e.g. a WriteConflictException, the records already copied into
+    // the batch have not been returned to the caller. Forget them, so that the caller's restore()
+    // repositions the cursor on the last record it was actually returned.
+    ScopeGuard resetPosition([&, lastReturnedId = _lastReturnedId] {
+        _lastReturnedId = lastReturnedId;
+        batch->clear();
+    });
 
     RecordId id;
+    WT_ITEM value;
+    while (batch->size() < maxRecords && !batch->full() && advance(&id, &value)) {
+        batch->append(id, static_cast<const char*>(value.data), static_cast<int>(value.size));
+        _lastReturnedId = std::move(id);
+        id = RecordId();
+    }
+    resetPosition.dismiss();
+
+    auto& metricsCollector = ResourceConsumption::MetricsCollector::get(_opCtx);
+    for (size_t i = 0; i < batch->size(); ++i) {
+        auto record = (*batch)[i];
+        metricsCollector.incrementOneDocRead(_rs.getURI(),
+                                             record.data.size() + computeRecordIdSize(record.id));
+    }
+
+    return batch->size();
+}
+
+bool WiredTigerRecordStoreCursorBase::advance(RecordId* outId, WT_ITEM* outValue) {
+    WT_CURSOR* c = _cursor->get();
+
+    RecordId& id = *outId;
     if (!_skipNextAdvance) {
         // Nothing after the next line can throw WCEs.
         // Note that an unpositioned (or eof) WT_CURSOR returns the first/last entry in the
@@ -2183,7 +2361,7 @@ boost::optional<Record> WiredTigerRecordStoreCursorBase::next() {
             _opCtx, [&] { return _forward ? c->next(c) : c->prev(c); });
         if (advanceRet == WT_NOTFOUND) {
             _eof = true;
-            return {};
+            return false;
         }
         invariantWTOK(advanceRet, c->session);
         id = getKey(c);
@@ -2203,7 +2381,7 @@ boost::optional<Record> WiredTigerRecordStoreCursorBase::next() {
             int advanceRet = wiredTigerPrepareConflictRetry(_opCtx, [&] { return c->prev(c); });
             if (advanceRet == WT_NOTFOUND) {
                 _eof = true;
-                return {};
+                return false;
             }
             invariantWTOK(advanceRet, c->session);
             id = getKey(c);
@@ -2212,12 +2390,12 @@ boost::optional<Record> WiredTigerRecordStoreCursorBase::next() {
 
     if (_readTimestampForOplog && id.getLong() > *_readTimestampForOplog) {
         _eof = true;
-        return {};
+        return false;
     }
 
     if (_forward && _oplogVisibleTs && id.getLong() > *_oplogVisibleTs) {
         _eof = true;
-        return {};
+        return false;
     }
 
     if (_forward && _lastReturnedId >= id) {
@@ -2236,16 +2414,8 @@ boost::optional<Record> WiredTigerRecordStoreCursorBase::next() {
         throwWriteConflictException();
     }
 
-    WT_ITEM value;
-    invariantWTOK(c->get_value(c, &value), c->session);
-
-    auto& metricsCollector = ResourceConsumption::MetricsCollector::get(_opCtx);
-
-    auto keyLength = computeRecordIdSize(id);
-    metricsCollector.incrementOneDocRead(_rs.getURI(), value.size + keyLength);
-
-    _lastReturnedId = id;
-    return {{std::move(id), {static_cast<const char*>(value.data), static_cast<int>(value.size)}}};
+    invariantWTOK(c->get_value(c, outValue), c->session);
+    return true;
 }
 
 boost::optional<Record> WiredTigerRecordStoreCursorBase::seekExact(const RecordId& id) {
@@ -2291,6 +2461,58 @@ boost::optional<Record> WiredTigerRecordStoreCursorBase::seekExact(const RecordI
     return {{id, {static_cast<const char*>(value.data), static_cast<int>(value.size)}}};
 }
 
+size_t WiredTigerRecordStoreCursorBase::seekExactMany(const std::vector<RecordId>& ids,
+                                                      RecordBatch* batch) {
+    invariant(_hasRestored);
+    dassert(std::adjacent_find(ids.begin(), ids.end(), std::greater_equal<RecordId>()) ==
+            ids.end());
+    batch->clear();
+
+    // Ensure an active transaction is open. While WiredTiger supports using cursors on a session
+    // without an active transaction (i.e. an implicit transaction), that would bypass configuration
+    // options we pass when we explicitly start transactions in the RecoveryUnit.
+    WiredTigerRecoveryUnit::get(_opCtx)->getSession();
+
+    // Leave the cursor unpositioned if this throws, as the batch is discarded.
+    ScopeGuard clearBatch([&] {
+        batch->clear();
+        _lastReturnedId = RecordId();
+        _eof = true;
+    });
+
+    _skipNextAdvance = false;
+    WT_CURSOR* c = _cursor->get();
+    auto& metricsCollector = ResourceConsumption::MetricsCollector::get(_opCtx);
+    for (auto&& id : ids) {
+        // The ids are sorted, so none of those that follow an invisible oplog entry are visible.
+        if ((_readTimestampForOplog && id.getLong() > *_readTimestampForOplog) ||
+            (_forward && _oplogVisibleTs && id.getLong() > *_oplogVisibleTs)) {
+            break;
+        }
+
+        // While the cursor stays positioned, WiredTiger first searches the leaf page it is
+        // positioned on, so looking up neighboring ids in order avoids descending the tree again.
+        auto key = makeCursorKey(id, _rs.keyFormat());
+        setKey(c, &key);
+        int seekRet = wiredTigerPrepareConflictRetry(_opCtx, [&] { return c->search(c); });
+        if (seekRet == WT_NOTFOUND) {
+            continue;
+        }
+        invariantWTOK(seekRet, c->session);
+        metricsCollector.incrementOneCursorSeek(std::string(c->uri));
+
+        WT_ITEM value;
+        invariantWTOK(c->get_value(c, &value), c->session);
+        metricsCollector.incrementOneDocRead(_rs.getURI(), value.size + computeRecordIdSize(id));
+        batch->append(id, static_cast<const char*>(value.data), static_cast<int>(value.size));
+        _lastReturnedId = id;
+    }
+    clearBatch.dismiss();
+
+    _eof = batch->empty();
+    return batch->size();
+}
+
 boost::optional<Record> WiredTigerRecordStoreCursorBase::seekNear(const RecordId& id) {
     dassert(_opCtx->lockState()->isReadLocked());
 
@@ -155,6 +155,8 @@ public:
                            std::vector<Record>* records,
                            const std::vector<Timestamp>& timestamps) final;
 
+    std::unique_ptr<BulkLoader> makeBulkLoader(OperationContext* opCtx) final;
+
     Status doUpdateRecord(OperationContext* opCtx,
                           const RecordId& recordId,
                           const char* data,
@@ -177,6 +179,12 @@ public:
 
     Status doTruncate(OperationContext* opCtx) final;
 
+    Status doRangeTruncate(OperationContext* opCtx,
+                           const RecordId& minRecordId,
+                           const RecordId& maxRecordId,
+                           int64_t hintDataSizeIncrement,
+                           int64_t hintNumRecordsIncrement) final;
+
     virtual bool compactSupported() const {
         return !_isEphemeral;
     }
@@ -186,7 +194,7 @@ public:
 
     virtual Timestamp getPinnedOplog() const final;
 
-    Status doCompact(OperationContext* opCtx) final;
+    Status doCompact(OperationContext* opCtx, const CompactOptions& options) final;
 
     virtual void validate(OperationContext* opCtx,
                           ValidateResults* results,
@@ -287,6 +295,7 @@ protected:
 
 private:
     class RandomCursor;
+    class BulkRecordLoader;
 
     Status _insertRecords(OperationContext* opCtx,
                           Record* records,
@@ -397,8 +406,12 @@ public:
 
     boost::optional<Record> next();
 
+    size_t nextBatch(size_t maxRecords, RecordBatch* batch) override;
+
     boost::optional<Record> seekExact(const RecordId& id);
 
+    size_t seekExactMany(const std::vector<RecordId>& ids, RecordBatch* batch) override;
+
     boost::optional<Record> seekNear(const RecordId& start);
 
     void save();
@@ -438,6 +451,13 @@ private:
     bool isVisible(const RecordId& id);
     void initOplogVisibility(OperationContext* opCtx);
 
+    /**
+     * Moves the cursor to the next visible record, and returns its id and value. The value is only
+     * valid until the cursor is next moved. Returns false at EOF. Does not update
+     * '_lastReturnedId'.
+     */
+    bool advance(RecordId* outId, WT_ITEM* outValue);
+
     /**
      * This value is used for visibility calculations on what oplog entries can be returned to a
      * client. This value *must* be initialized/updated *before* a WiredTiger snapshot is
@@ -205,6 +205,44 @@ TEST(WiredTigerRecordStoreTest, Isolation2) {
     }
 }
 
+TEST(WiredTigerRecordStoreTest, BulkLoaderAppendsToEmptyRecordStore) {
+    const auto harnessHelper(newRecordStoreHarnessHelper());
+    unique_ptr<RecordStore> rs(harnessHelper->newRecordStore());
+    ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+
+    std::vector<RecordId> ids;
+    {
+        auto bulkLoader = rs->makeBulkLoader(opCtx.get());
+        ASSERT(bulkLoader);
+        for (int i = 0; i < 10; ++i) {
+            auto data = std::to_string(i);
+            auto res = bulkLoader->insertRecord(data.c_str(), data.size() + 1);
+            ASSERT_OK(res.getStatus());
+            if (!ids.empty()) {
+                ASSERT_LT(ids.back(), res.getValue());
+            }
+            ids.push_back(res.getValue());
+        }
+    }
+
+    ASSERT_EQ(10, rs->numRecords(opCtx.get()));
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_EQ(std::to_string(i), rs->dataFor(opCtx.get(), ids[i]).data());
+    }
+
+    // Records inserted afterwards are ordered after the bulk loaded ones.
+    {
+        WriteUnitOfWork uow(opCtx.get());
+        auto res = rs->insertRecord(opCtx.get(), "a", 2, Timestamp());
+        ASSERT_OK(res.getStatus());
+        ASSERT_LT(ids.back(), res.getValue());
+        uow.commit();
+    }
+
+    // Bulk cursors can only be opened on empty tables.
+    ASSERT_FALSE(rs->makeBulkLoader(opCtx.get()));
+}
+
 StatusWith<RecordId> insertBSON(ServiceContext::UniqueOperationContext& opCtx,
                                 unique_ptr<RecordStore>& rs,
                                 const Timestamp& opTime) {
@@ -43,12 +43,19 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
 #include "mongo/logv2/log.h"
 #include "mongo/stdx/thread.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/scopeguard.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
 
 
 namespace mongo {
+namespace {
+
+// More partitions than this only add to the cost of operations over all cached sessions.
+const size_t kMaxSessionCachePartitions = 64;
+
+}  // namespace
 
 WiredTigerSession::WiredTigerSession(WT_CONNECTION* conn, uint64_t epoch, uint64_t cursorEpoch)
     : _epoch(epoch),
@@ -217,6 +224,7 @@ WiredTigerSessionCache::WiredTigerSessionCache(WiredTigerKVEngine* engine)
       _conn(engine->getConnection()),
       _clockSource(_engine->getClockSource()),
       _shuttingDown(0),
+      _partitions(_makePartitions()),
       _prepareCommitOrAbortCounter(0) {}
 
 WiredTigerSessionCache::WiredTigerSessionCache(WT_CONNECTION* conn, ClockSource* cs)
@@ -224,6 +232,7 @@ WiredTigerSessionCache::WiredTigerSessionCache(WT_CONNECTION* conn, ClockSource*
       _conn(conn),
       _clockSource(cs),
       _shuttingDown(0),
+      _partitions(_makePartitions()),
       _prepareCommitOrAbortCounter(0) {}
 
 WiredTigerSessionCache::~WiredTigerSessionCache() {
@@ -391,9 +400,11 @@ void WiredTigerSessionCache::notifyPreparedUnitOfWorkHasCommittedOrAborted() {
 
 
 void WiredTigerSessionCache::closeAllCursors(const std::string& uri) {
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeAllCursors(uri);
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lock(partition->lock);
+        for (auto session : partition->sessions) {
+            session->closeAllCursors(uri);
+        }
     }
 }
 
@@ -401,15 +412,21 @@ void WiredTigerSessionCache::closeCursorsForQueuedDrops() {
     // Increment the cursor epoch so that all cursors from this epoch are closed.
     _cursorEpoch.fetchAndAdd(1);
 
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeCursorsForQueuedDrops(_engine);
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lock(partition->lock);
+        for (auto session : partition->sessions) {
+            session->closeCursorsForQueuedDrops(_engine);
+        }
     }
 }
 
 size_t WiredTigerSessionCache::getIdleSessionsCount() {
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    return _sessions.size();
+    size_t count = 0;
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lock(partition->lock);
+        count += partition->sessions.size();
+    }
+    return count;
 }
 
 void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
@@ -421,14 +438,14 @@ void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
     auto cutoffTime = _clockSource->now() - Milliseconds(idleTimeMillis);
     SessionCache sessionsToClose;
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lock(partition->lock);
         // Discard all sessions that became idle before the cutoff time
-        for (auto it = _sessions.begin(); it != _sessions.end();) {
+        for (auto it = partition->sessions.begin(); it != partition->sessions.end();) {
             auto session = *it;
             invariant(session->getIdleExpireTime() != Date_t::min());
             if (session->getIdleExpireTime() < cutoffTime) {
-                it = _sessions.erase(it);
+                it = partition->sessions.erase(it);
                 sessionsToClose.push_back(session);
             } else {
                 ++it;
@@ -447,10 +464,13 @@ void WiredTigerSessionCache::closeAll() {
     // Increment the epoch as we are now closing all sessions with this epoch.
     SessionCache swap;
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
-        _epoch.fetchAndAdd(1);
-        _sessions.swap(swap);
+    // Sessions released concurrently check the epoch under their partition's lock, so once the
+    // epoch is bumped no session of the old epoch can be added to a partition after it's emptied.
+    _epoch.fetchAndAdd(1);
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lock(partition->lock);
+        swap.insert(swap.end(), partition->sessions.begin(), partition->sessions.end());
+        partition->sessions.clear();
     }
 
     for (SessionCache::iterator i = swap.begin(); i != swap.end(); i++) {
@@ -467,13 +487,17 @@ UniqueWiredTigerSession WiredTigerSessionCache::getSession() {
     // operations should be allowed to start.
     invariant(!(_shuttingDown.loadRelaxed() & kShuttingDownMask));
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
-        if (!_sessions.empty()) {
+    // Look in the partition of this thread first, then take a session from any other partition
+    // before opening a new one.
+    const size_t firstPartition = _partitionIndexForCurrentThread();
+    for (size_t i = 0; i < _partitions.size(); ++i) {
+        auto& partition = *_partitions[(firstPartition + i) % _partitions.size()];
+        stdx::lock_guard<Latch> lock(partition.lock);
+        if (!partition.sessions.empty()) {
             // Get the most recently used session so that if we discard sessions, we're
             // discarding older ones
-            WiredTigerSession* cachedSession = _sessions.back();
-            _sessions.pop_back();
+            WiredTigerSession* cachedSession = partition.sessions.back();
+            partition.sessions.pop_back();
             // Reset the idle time
             cachedSession->setIdleExpireTime(Date_t::min());
             return UniqueWiredTigerSession(cachedSession);
@@ -535,10 +559,11 @@ void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
     session->setIdleExpireTime(_clockSource->now());
 
     if (session->_getEpoch() == currentEpoch) {  // check outside of lock to reduce contention
-        stdx::lock_guard<Latch> lock(_cacheLock);
+        auto& partition = *_partitions[_partitionIndexForCurrentThread()];
+        stdx::lock_guard<Latch> lock(partition.lock);
         if (session->_getEpoch() == _epoch.load()) {  // recheck inside the lock for correctness
             returnedToCache = true;
-            _sessions.push_back(session);
+            partition.sessions.push_back(session);
         }
     } else
         invariant(session->_getEpoch() < currentEpoch);
@@ -551,6 +576,21 @@ void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
 }
 
 
+std::vector<std::unique_ptr<WiredTigerSessionCache::CachePartition>>
+WiredTigerSessionCache::_makePartitions() {
+    auto numPartitions = std::max<size_t>(
+        1, std::min<size_t>(ProcessInfo::getNumAvailableCores(), kMaxSessionCachePartitions));
+    std::vector<std::unique_ptr<CachePartition>> partitions;
+    for (size_t i = 0; i < numPartitions; ++i) {
+        partitions.push_back(std::make_unique<CachePartition>());
+    }
+    return partitions;
+}
+
+size_t WiredTigerSessionCache::_partitionIndexForCurrentThread() const {
+    return std::hash<stdx::thread::id>()(stdx::this_thread::get_id()) % _partitions.size();
+}
+
 void WiredTigerSessionCache::setJournalListener(JournalListener* jl) {
     stdx::unique_lock<Latch> lk(_journalListenerMutex);
 
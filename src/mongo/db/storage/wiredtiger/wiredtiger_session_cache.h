@@ -30,7 +30,9 @@
 #pragma once
 
 #include <list>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <wiredtiger.h>
 
@@ -394,9 +396,17 @@ private:
     AtomicWord<unsigned> _shuttingDown;
     static const uint32_t kShuttingDownMask = 1 << 31;
 
-    Mutex _cacheLock = MONGO_MAKE_LATCH("WiredTigerSessionCache::_cacheLock");
     typedef std::vector<WiredTigerSession*> SessionCache;
-    SessionCache _sessions;
+
+    // The idle sessions are split between partitions, about one per core, so that concurrent
+    // operations don't all contend on one mutex. A thread gets sessions from and releases them to
+    // the partition its thread id maps to, and takes sessions from other partitions only when its
+    // own has none.
+    struct CachePartition {
+        Mutex lock = MONGO_MAKE_LATCH("WiredTigerSessionCache::CachePartition::lock");
+        SessionCache sessions;
+    };
+    std::vector<std::unique_ptr<CachePartition>> _partitions;
 
     // Bumped when all open sessions need to be closed
     AtomicWord<unsigned long long> _epoch;  // atomic so we can check it outside of the lock
@@ -433,6 +443,13 @@ private:
      * session and releasing it, the session is directly released. This method is thread safe.
      */
     void releaseSession(WiredTigerSession* session);
+
+    static std::vector<std::unique_ptr<CachePartition>> _makePartitions();
+
+    /**
+     * Returns the index of the cache partition that the current thread uses.
+     */
+    size_t _partitionIndexForCurrentThread() const;
 };
 
 /**
@@ -31,11 +31,13 @@
 
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "mongo/base/string_data.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_cursor.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/temp_dir.h"
 #include "mongo/unittest/unittest.h"
 #include "mongo/util/system_clock_source.h"
@@ -114,6 +116,53 @@ TEST(WiredTigerSessionCacheTest, CheckSessionCacheCleanup) {
     ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
 }
 
+TEST(WiredTigerSessionCacheTest, ThreadsReuseSessionsReleasedByOtherThreads) {
+    WiredTigerSessionCacheHarnessHelper harnessHelper("");
+    WiredTigerSessionCache* sessionCache = harnessHelper.getSessionCache();
+
+    WiredTigerSession* released;
+    {
+        UniqueWiredTigerSession session = sessionCache->getSession();
+        released = session.get();
+    }
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 1U);
+
+    // Another thread takes the idle session rather than opening a new one, whichever partition
+    // of the cache it was released to.
+    WiredTigerSession* reused;
+    size_t idleSessionsWhileInUse;
+    stdx::thread([&] {
+        UniqueWiredTigerSession session = sessionCache->getSession();
+        reused = session.get();
+        idleSessionsWhileInUse = sessionCache->getIdleSessionsCount();
+    }).join();
+    ASSERT_EQUALS(reused, released);
+    ASSERT_EQUALS(idleSessionsWhileInUse, 0U);
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 1U);
+
+    // Sessions released from many threads are all closed by closeAll().
+    std::vector<stdx::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&] {
+            UniqueWiredTigerSession first = sessionCache->getSession();
+            UniqueWiredTigerSession second = sessionCache->getSession();
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_GTE(sessionCache->getIdleSessionsCount(), 2U);
+
+    sessionCache->closeAll();
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
+
+    // A session opened before closeAll() is not returned to the cache.
+    UniqueWiredTigerSession session = sessionCache->getSession();
+    sessionCache->closeAll();
+    session.reset();
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
+}
+
 TEST(WiredTigerSessionCacheTest, ReleaseCursorDuringShutdown) {
     WiredTigerSessionCacheHarnessHelper harnessHelper("");
     WiredTigerSessionCache* sessionCache = harnessHelper.getSessionCache();
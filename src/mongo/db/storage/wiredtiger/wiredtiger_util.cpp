@@ -1167,6 +1167,10 @@ StatusWith<std::string> WiredTigerUtil::generateImportString(const StringData& i
     return StatusWith<std::string>(ss.str());
 }
 
+std::string WiredTigerUtil::compactConfig(const CompactOptions& options) {
+    return str::stream() << "timeout=" << durationCount<Seconds>(options.timeSlice);
+}
+
 std::string WiredTigerUtil::generateRestoreConfig() {
     std::stringstream ss;
     ss << "backup_restore_target=[";
@@ -36,6 +36,7 @@
 #include "mongo/base/status_with.h"
 #include "mongo/bson/bsonobj.h"
 #include "mongo/db/namespace_string.h"
+#include "mongo/db/storage/compact_options.h"
 #include "mongo/db/storage/durable_catalog.h"
 #include "mongo/util/assert_util.h"
 
@@ -202,6 +203,11 @@ public:
      */
     static std::string generateRestoreConfig();
 
+    /**
+     * Creates the configuration string passed into WT_SESSION::compact().
+     */
+    static std::string compactConfig(const CompactOptions& options);
+
     /**
      * Returns true if WiredTiger startup will restore from a backup.
      */
@@ -80,6 +80,7 @@ std::unique_ptr<CollMod> makeTimeseriesBucketsCollModCommand(OperationContext* o
     request.setPipeline(origCmd.getPipeline());
     request.setRecordPreImages(origCmd.getRecordPreImages());
     request.setChangeStreamPreAndPostImages(origCmd.getChangeStreamPreAndPostImages());
+    request.setCacheResident(origCmd.getCacheResident());
     request.setExpireAfterSeconds(origCmd.getExpireAfterSeconds());
     request.setTimeseries(origCmd.getTimeseries());
     request.setDryRun(origCmd.getDryRun());
@@ -39,9 +39,11 @@
 #include "mongo/db/catalog/collection_catalog.h"
 #include "mongo/db/catalog/database_holder.h"
 #include "mongo/db/catalog/index_catalog.h"
+#include "mongo/db/catalog/truncate_range.h"
 #include "mongo/db/client.h"
 #include "mongo/db/commands/fsync_locked.h"
 #include "mongo/db/commands/server_status_metric.h"
+#include "mongo/db/concurrency/exception_util.h"
 #include "mongo/db/db_raii.h"
 #include "mongo/db/exec/delete_stage.h"
 #include "mongo/db/index/index_descriptor.h"
@@ -590,6 +592,69 @@ bool TTLMonitor::_deleteExpiredWithCollscan(OperationContext* opCtx,
     const auto expirationDate = safeExpirationDate(opCtx, collection, *expireAfterSeconds);
     const auto endId = makeCollScanEndBound(collection, expirationDate);
 
+    if (canTruncateRange(opCtx, collection)) {
+        // Truncates the expired range in chunks of at most 'batchedDeletesTargetBatchDocs'
+        // documents, each in its own WriteUnitOfWork and logged as its own 'truncateRange' oplog
+        // entry, so that neither the transaction nor the oplog entry grows with the range.
+        const auto docsPerChunk = BatchedDeleteStageParams().targetBatchDocs;
+        const auto passParams = getBatchedDeleteStageParams(isBatchingEnabled());
+
+        Timer timer;
+        RecordId chunkStart = startId.recordId();
+        int64_t numDeleted = 0;
+        int64_t numChunks = 0;
+        bool passTargetMet = false;
+        while (true) {
+            RecordId chunkEnd;
+            const auto chunkDeleted =
+                writeConflictRetry(opCtx, "ttlTruncateRange", collection->ns().ns(), [&] {
+                    WriteUnitOfWork wuow(opCtx);
+                    auto chunkDeleted = truncateRange(opCtx,
+                                                      collection,
+                                                      chunkStart,
+                                                      endId.recordId(),
+                                                      docsPerChunk,
+                                                      &chunkEnd);
+                    wuow.commit();
+                    return chunkDeleted;
+                });
+            numDeleted += chunkDeleted;
+            ttlDeletedDocuments.increment(chunkDeleted);
+            if (chunkDeleted == 0) {
+                break;
+            }
+            ++numChunks;
+            if (docsPerChunk <= 0 || chunkDeleted < docsPerChunk) {
+                // The rest of the expired range was removed by this chunk.
+                break;
+            }
+
+            if (passParams &&
+                ((passParams->targetPassDocs > 0 &&
+                  numDeleted >= passParams->targetPassDocs) ||
+                 (passParams->targetPassTimeMS > Milliseconds(0) &&
+                  Milliseconds(timer.millis()) >= passParams->targetPassTimeMS))) {
+                // There may be more expired documents left for the next pass.
+                passTargetMet = true;
+                break;
+            }
+
+            // The last truncated record no longer exists, so the next chunk starts after it.
+            chunkStart = chunkEnd;
+            opCtx->checkForInterrupt();
+        }
+
+        LOGV2_DEBUG(7086795,
+                    1,
+                    "Truncated the range of expired documents",
+                    logAttrs(collection->ns()),
+                    "numDeleted"_attr = numDeleted,
+                    "numChunks"_attr = numChunks,
+                    "passTargetMet"_attr = passTargetMet,
+                    "duration"_attr = Milliseconds(timer.millis()));
+        return passTargetMet;
+    }
+
     auto params = std::make_unique<DeleteStageParams>();
     params->isMulti = true;
 
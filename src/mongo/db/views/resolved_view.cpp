@@ -202,6 +202,7 @@ AggregateCommandRequest ResolvedView::asExpandedViewAggregation(
     expandedRequest.setBypassDocumentValidation(request.getBypassDocumentValidation());
     expandedRequest.setAllowDiskUse(request.getAllowDiskUse());
     expandedRequest.setIsMapReduceCommand(request.getIsMapReduceCommand());
+    expandedRequest.setMaxDegreeOfParallelism(request.getMaxDegreeOfParallelism());
     expandedRequest.setLet(request.getLet());
 
     // Operations on a view must always use the default collation of the view. We must have already
@@ -197,7 +197,9 @@ BSONObj MockRemoteDBServer::project(projection_executor::ProjectionExecutor* pro
 
 mongo::BSONArray MockRemoteDBServer::findImpl(InstanceID id,
                                               const NamespaceStringOrUUID& nsOrUuid,
-                                              BSONObj projection) {
+                                              BSONObj projection,
+                                              const BSONObj& min,
+                                              const BSONObj& max) {
     checkIfUp(id);
 
     if (_delayMilliSec > 0) {
@@ -217,6 +219,13 @@ mongo::BSONArray MockRemoteDBServer::findImpl(InstanceID id,
     const vector<BSONObj>& coll = _dataMgr[ns];
     BSONArrayBuilder result;
     for (vector<BSONObj>::const_iterator iter = coll.begin(); iter != coll.end(); ++iter) {
+        if (!min.isEmpty() && iter->extractFields(min, true).woCompare(min, BSONObj(), false) < 0) {
+            continue;
+        }
+        if (!max.isEmpty() &&
+            iter->extractFields(max, true).woCompare(max, BSONObj(), false) >= 0) {
+            continue;
+        }
         result.append(project(projectionExecutor.get(), *iter));
     }
 
@@ -225,7 +234,11 @@ mongo::BSONArray MockRemoteDBServer::findImpl(InstanceID id,
 
 mongo::BSONArray MockRemoteDBServer::find(MockRemoteDBServer::InstanceID id,
                                           const FindCommandRequest& findRequest) {
-    return findImpl(id, findRequest.getNamespaceOrUUID(), findRequest.getProjection());
+    return findImpl(id,
+                    findRequest.getNamespaceOrUUID(),
+                    findRequest.getProjection(),
+                    findRequest.getMin(),
+                    findRequest.getMax());
 }
 
 mongo::BSONArray MockRemoteDBServer::query(MockRemoteDBServer::InstanceID id,
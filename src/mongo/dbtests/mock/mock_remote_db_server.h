@@ -164,7 +164,8 @@ public:
     rpc::UniqueReply runCommand(InstanceID id, const OpMsgRequest& request);
 
     /**
-     * Finds documents from this mock server according to 'findRequest'.
+     * Finds documents from this mock server according to 'findRequest'. Only the projection and
+     * the 'min' and 'max' bounds of the request are applied.
      */
     mongo::BSONArray find(InstanceID id, const FindCommandRequest& findRequest);
 
@@ -245,11 +246,14 @@ private:
 
     /**
      * Logic shared between 'find()' and 'query()'. This can go away when the legacy 'query()' API
-     * is removed.
+     * is removed. Non-empty 'min' and 'max' bound the returned documents the same way as the find
+     * command options, comparing the fields they name.
      */
     mongo::BSONArray findImpl(InstanceID id,
                               const NamespaceStringOrUUID& nsOrUuid,
-                              BSONObj projection);
+                              BSONObj projection,
+                              const BSONObj& min = BSONObj(),
+                              const BSONObj& max = BSONObj());
 
     typedef stdx::unordered_map<std::string, std::shared_ptr<CircularBSONIterator>> CmdToReplyObj;
     typedef stdx::unordered_map<std::string, std::vector<BSONObj>> MockDataMgr;
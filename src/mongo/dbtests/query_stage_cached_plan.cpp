@@ -52,6 +52,7 @@
 #include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/query_planner_params.h"
 #include "mongo/dbtests/dbtests.h"
+#include "mongo/idl/server_parameter_test_util.h"
 
 namespace QueryStageCachedPlan {
 
@@ -162,6 +163,7 @@ public:
                                         cq,
                                         plannerParams,
                                         decisionWorks,
+                                        0,  // decisionResults
                                         std::move(mockChild));
 
         // This should succeed after triggering a replan.
@@ -217,6 +219,7 @@ TEST_F(QueryStageCachedPlan, QueryStageCachedPlanFailureMemoryLimitExceeded) {
                                     cq.get(),
                                     plannerParams,
                                     decisionWorks,
+                                    0,  // decisionResults
                                     std::move(mockChild));
 
     // This should succeed after triggering a replan.
@@ -271,6 +274,7 @@ TEST_F(QueryStageCachedPlan, QueryStageCachedPlanHitMaxWorks) {
                                     cq.get(),
                                     plannerParams,
                                     decisionWorks,
+                                    0,  // decisionResults
                                     std::move(mockChild));
 
     // This should succeed after triggering a replan.
@@ -284,6 +288,78 @@ TEST_F(QueryStageCachedPlan, QueryStageCachedPlanHitMaxWorks) {
     ASSERT_EQ(cache->get(key).state, PlanCache::CacheEntryState::kPresentInactive);
 }
 
+/**
+ * Test that, with adaptive replanning enabled, a cached plan which produces far fewer results than
+ * it did when it was cached is replanned before it hits the works threshold, and that the results
+ * it produced during the trial period are returned exactly once.
+ */
+TEST_F(QueryStageCachedPlan, QueryStageCachedPlanReplansEarlyWhenCardinalityDiverges) {
+    RAIIServerParameterControllerForTest controller("internalQueryCacheEnableAdaptiveReplanning",
+                                                    true);
+    AutoGetCollectionForReadCommand collection(&_opCtx, nss);
+    ASSERT(collection);
+
+    // Query can be answered by either index on "a" or index on "b".
+    auto findCommand = std::make_unique<FindCommandRequest>(nss);
+    findCommand->setFilter(fromjson("{a: {$gte: 8}, b: 1}"));
+    auto statusWithCQ = CanonicalQuery::canonicalize(opCtx(), std::move(findCommand));
+    ASSERT_OK(statusWithCQ.getStatus());
+    const std::unique_ptr<CanonicalQuery> cq = std::move(statusWithCQ.getValue());
+    auto key = plan_cache_key_factory::make<PlanCacheKey>(*cq, collection.getCollection());
+
+    PlanCache* cache = CollectionQueryInfo::get(collection.getCollection()).getPlanCache();
+    ASSERT(cache);
+    ASSERT_EQ(cache->get(key).state, PlanCache::CacheEntryState::kNotPresent);
+
+    QueryPlannerParams plannerParams;
+    fillOutPlannerParams(&_opCtx, collection.getCollection(), cq.get(), &plannerParams);
+
+    // The mock stage returns one of the two matching documents, and then keeps working without
+    // producing any more results, though far fewer times than needed to trigger a replan based
+    // on works.
+    auto mockChild = std::make_unique<MockStage>(_expCtx.get(), &_ws);
+    auto cursor = collection.getCollection()->getCursor(&_opCtx);
+    while (auto record = cursor->next()) {
+        auto obj = record->data.toBson().getOwned();
+        if (obj["_id"].numberInt() == 8) {
+            WorkingSetID id = _ws.allocate();
+            WorkingSetMember* member = _ws.get(id);
+            member->recordId = record->id;
+            member->doc = {SnapshotId(), Document{obj}};
+            _ws.transitionToRecordIdAndObj(id);
+            mockChild->enqueueAdvanced(id);
+        }
+    }
+    cursor.reset();
+
+    const size_t decisionWorks = 10;
+    const size_t decisionResults = 20;
+    for (size_t i = 0; i < 2 * decisionWorks; i++) {
+        mockChild->enqueueStateCode(PlanStage::NEED_TIME);
+    }
+
+    CachedPlanStage cachedPlanStage(_expCtx.get(),
+                                    collection.getCollection(),
+                                    &_ws,
+                                    cq.get(),
+                                    plannerParams,
+                                    decisionWorks,
+                                    decisionResults,
+                                    std::move(mockChild));
+
+    NoopYieldPolicy yieldPolicy(_opCtx.getServiceContext()->getFastClockSource());
+    ASSERT_OK(cachedPlanStage.pickBestPlan(&yieldPolicy));
+
+    // The query was replanned after 'decisionWorks' works, rather than after
+    // 'internalQueryCacheEvictionRatio' times as many.
+    auto stats = static_cast<const CachedPlanStats*>(cachedPlanStage.getSpecificStats());
+    ASSERT(stats->replanReason);
+    ASSERT_EQ(cache->get(key).state, PlanCache::CacheEntryState::kPresentInactive);
+
+    // The document returned during the trial period is not returned again by the new plan.
+    ASSERT_EQ(getNumResultsForStage(_ws, &cachedPlanStage, cq.get()), 2U);
+}
+
 /**
  * Test the way cache entries are added (either "active" or "inactive") to the plan cache.
  */
@@ -491,6 +567,7 @@ TEST_F(QueryStageCachedPlan, ThrowsOnYieldRecoveryWhenIndexIsDroppedBeforePlanSe
                                     cq.get(),
                                     plannerParams,
                                     decisionWorks,
+                                    0,  // decisionResults
                                     std::make_unique<MockStage>(_expCtx.get(), &_ws));
 
     // Drop an index while the CachedPlanStage is in a saved state. Restoring should fail, since we
@@ -535,6 +612,7 @@ TEST_F(QueryStageCachedPlan, DoesNotThrowOnYieldRecoveryWhenIndexIsDroppedAferPl
                                     cq.get(),
                                     plannerParams,
                                     decisionWorks,
+                                    0,  // decisionResults
                                     std::make_unique<MockStage>(_expCtx.get(), &_ws));
 
     NoopYieldPolicy yieldPolicy(_opCtx.getServiceContext()->getFastClockSource());
@@ -47,6 +47,7 @@
 #include "mongo/db/json.h"
 #include "mongo/db/matcher/expression_parser.h"
 #include "mongo/dbtests/dbtests.h"
+#include "mongo/idl/server_parameter_test_util.h"
 
 namespace QueryStageFetch {
 
@@ -226,6 +227,63 @@ public:
     }
 };
 
+//
+// Test that a batched fetch returns the members in the order the child returned them, and drops
+// those whose document is gone.
+//
+class FetchStageBatched : public QueryStageFetchBase {
+public:
+    void run() {
+        RAIIServerParameterControllerForTest batchSize("internalQueryFetchBatchSize", 3);
+
+        dbtests::WriteContextForTests ctx(&_opCtx, ns());
+        Database* db = ctx.db();
+        CollectionPtr coll =
+            CollectionCatalog::get(&_opCtx)->lookupCollectionByNamespace(&_opCtx, nss());
+        if (!coll) {
+            WriteUnitOfWork wuow(&_opCtx);
+            coll = db->createCollection(&_opCtx, nss());
+            wuow.commit();
+        }
+
+        WorkingSet ws;
+
+        for (int i = 0; i < 5; ++i) {
+            insert(BSON("foo" << i));
+        }
+        set<RecordId> recordIds;
+        getRecordIds(&recordIds, coll);
+        ASSERT_EQUALS(size_t(5), recordIds.size());
+
+        // Queue the RecordIds in reverse order, with a RecordId whose document doesn't exist in
+        // the middle.
+        auto mockStage = std::make_unique<QueuedDataStage>(_expCtx.get(), &ws);
+        std::vector<RecordId> queued(recordIds.rbegin(), recordIds.rend());
+        queued.insert(queued.begin() + 2, RecordId(recordIds.rbegin()->getLong() + 1));
+        for (auto&& recordId : queued) {
+            WorkingSetID id = ws.allocate();
+            WorkingSetMember* mockMember = ws.get(id);
+            mockMember->recordId = recordId;
+            ws.transitionToRecordIdAndIdx(id);
+            mockStage->pushBack(id);
+        }
+
+        auto fetchStage =
+            std::make_unique<FetchStage>(_expCtx.get(), &ws, std::move(mockStage), nullptr, coll);
+
+        std::vector<int> results;
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        PlanStage::StageState state;
+        while ((state = fetchStage->work(&id)) != PlanStage::IS_EOF) {
+            if (state == PlanStage::ADVANCED) {
+                results.push_back(ws.get(id)->doc.value()["foo"].getInt());
+            }
+        }
+
+        ASSERT(results == std::vector<int>({4, 3, 2, 1, 0}));
+    }
+};
+
 class All : public OldStyleSuiteSpecification {
 public:
     All() : OldStyleSuiteSpecification("query_stage_fetch") {}
@@ -233,6 +291,7 @@ public:
     void setupTests() {
         add<FetchStageAlreadyFetched>();
         add<FetchStageFilter>();
+        add<FetchStageBatched>();
     }
 };
 